@@ -141,6 +141,16 @@ uint64_t FileAccessMemory::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Span<uint8_t> FileAccessMemory::get_buffer_mapped(uint64_t p_length) const {
+	if (!data || !p_length || p_length > length - pos) {
+		return Span<uint8_t>();
+	}
+
+	Span<uint8_t> mapped(&data[pos], p_length);
+	pos += p_length;
+	return mapped;
+}
+
 Error FileAccessMemory::get_error() const {
 	return pos >= length ? ERR_FILE_EOF : OK;
 }
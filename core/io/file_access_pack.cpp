@@ -35,6 +35,8 @@
 #include "core/os/os.h"
 #include "core/version.h"
 
+#include <zstd.h>
+
 Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t p_offset) {
 	for (int i = 0; i < sources.size(); i++) {
 		if (sources[i]->try_open_pack(p_path, p_replace_files, p_offset)) {
@@ -45,7 +47,7 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_compressed, const Vector<uint8_t> &p_dictionary) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
@@ -54,6 +56,8 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
 	pf.bundle = p_bundle;
+	pf.compressed = p_compressed;
+	pf.dictionary = p_dictionary;
 	pf.pack = p_pkg_path;
 	pf.offset = p_ofs;
 	pf.size = p_size;
@@ -270,15 +274,27 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 	bool enc_directory = (pack_flags & PACK_DIR_ENCRYPTED);
 	bool rel_filebase = (pack_flags & PACK_REL_FILEBASE); // Note: Always enabled for V3.
 	bool sparse_bundle = (pack_flags & PACK_SPARSE_BUNDLE);
+	bool compressed_files = (pack_flags & PACK_COMPRESSED_FILES);
 
 	uint64_t file_base = f->get_64();
 	if ((version == PACK_FORMAT_VERSION_V3) || (version == PACK_FORMAT_VERSION_V2 && rel_filebase)) {
 		file_base += pck_start_pos;
 	}
 
+	Vector<uint8_t> dictionary;
 	if (version == PACK_FORMAT_VERSION_V3) {
 		// V3: Read directory offset and skip reserved part of the header.
 		uint64_t dir_offset = f->get_64() + pck_start_pos;
+		if (compressed_files) {
+			// The first reserved fields hold the location of the dictionary used by the compressed files.
+			uint64_t dictionary_offset = f->get_64() + pck_start_pos;
+			uint64_t dictionary_size = f->get_64();
+			if (dictionary_size > 0) {
+				f->seek(dictionary_offset);
+				dictionary = f->get_buffer(dictionary_size);
+				ERR_FAIL_COND_V_MSG((uint64_t)dictionary.size() != dictionary_size, false, "Can't read pack compression dictionary.");
+			}
+		}
 		f->seek(dir_offset);
 	} else if (version == PACK_FORMAT_VERSION_V2) {
 		// V2: Directory directly after the header.
@@ -322,7 +338,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
 			PackedData::get_singleton()->remove_path(path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), sparse_bundle);
+			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), sparse_bundle, compressed_files && (flags & PACK_FILE_COMPRESSED), dictionary);
 		}
 	}
 
@@ -395,7 +411,9 @@ void FileAccessPack::seek(uint64_t p_position) {
 		eof = false;
 	}
 
-	f->seek(off + p_position);
+	if (!pf.compressed) {
+		f->seek(off + p_position);
+	}
 	pos = p_position;
 }
 
@@ -429,16 +447,96 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 		to_read = (int64_t)pf.size - (int64_t)pos;
 	}
 
-	pos += to_read;
-
 	if (to_read <= 0) {
 		return 0;
 	}
+
+	if (pf.compressed) {
+		// Only the frames covering the requested range are decompressed.
+		int64_t read = 0;
+		while (read < to_read) {
+			uint32_t frame = (pos + read) / frame_size;
+			if (!_decompress_frame(frame)) {
+				eof = true;
+				break;
+			}
+			uint64_t frame_pos = pos + read - (uint64_t)frame * frame_size;
+			int64_t to_copy = MIN(to_read - read, (int64_t)(frame_buffer.size() - frame_pos));
+			memcpy(p_dst + read, frame_buffer.ptr() + frame_pos, to_copy);
+			read += to_copy;
+		}
+		pos += read;
+		return read;
+	}
+
+	pos += to_read;
 	f->get_buffer(p_dst, to_read);
 
 	return to_read;
 }
 
+bool FileAccessPack::_decompress_frame(uint32_t p_frame) const {
+	if (current_frame == p_frame) {
+		return true;
+	}
+	ERR_FAIL_UNSIGNED_INDEX_V(p_frame + 1, frame_offsets.size(), false);
+
+	uint64_t compressed_size = frame_offsets[p_frame + 1] - frame_offsets[p_frame];
+	compressed_buffer.resize(compressed_size);
+	f->seek(frames_offset + frame_offsets[p_frame]);
+	ERR_FAIL_COND_V_MSG(f->get_buffer(compressed_buffer.ptr(), compressed_size) != compressed_size, false, vformat("Can't read compressed frame from pack '%s'.", String(pf.pack)));
+
+	uint64_t frame_start = (uint64_t)p_frame * frame_size;
+	uint64_t decompressed_size = MIN((uint64_t)frame_size, pf.size - frame_start);
+	frame_buffer.resize(decompressed_size);
+
+	if (!zstd_d_ctx) {
+		zstd_d_ctx = ZSTD_createDCtx();
+		ERR_FAIL_NULL_V(zstd_d_ctx, false);
+	}
+
+	size_t ret = ZSTD_decompress_usingDict(zstd_d_ctx, frame_buffer.ptr(), decompressed_size, compressed_buffer.ptr(), compressed_size, pf.dictionary.ptr(), pf.dictionary.size());
+	if (ZSTD_isError(ret) || ret != decompressed_size) {
+		current_frame = -1;
+		ERR_FAIL_V_MSG(false, vformat("Corrupt compressed frame in pack '%s'.", String(pf.pack)));
+	}
+
+	current_frame = p_frame;
+	return true;
+}
+
+bool FileAccessPack::_open_compressed() {
+	// Header: frame size, frame count and the offsets of each frame (plus the end of the last one),
+	// relative to the end of the header.
+	f->seek(off);
+	frame_size = f->get_32();
+	uint32_t frame_count = f->get_32();
+	ERR_FAIL_COND_V(frame_size == 0, false);
+	ERR_FAIL_COND_V((uint64_t)frame_count != (pf.size + frame_size - 1) / frame_size, false);
+
+	frame_offsets.resize(frame_count + 1);
+	for (uint64_t &frame_offset : frame_offsets) {
+		frame_offset = f->get_64();
+	}
+	frames_offset = f->get_position();
+	return true;
+}
+
+Span<uint8_t> FileAccessPack::get_buffer_mapped(uint64_t p_length) const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), Span<uint8_t>(), "File must be opened before use.");
+
+	if (eof || !p_length || p_length > pf.size - pos || pf.compressed) {
+		return Span<uint8_t>();
+	}
+
+	// Encrypted files are read through FileAccessEncrypted, which can't be mapped.
+	Span<uint8_t> mapped = f->get_buffer_mapped(p_length);
+	if (!mapped.is_empty()) {
+		pos += p_length;
+	}
+	return mapped;
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -499,10 +597,23 @@ FileAccessPack::FileAccessPack(const String &p_path, const PackedData::PackedFil
 		f = fae;
 		off = 0;
 	}
+
+	if (pf.compressed) {
+		if (pf.encrypted || !_open_compressed()) {
+			f = Ref<FileAccess>();
+			ERR_FAIL_MSG(vformat("Can't open compressed pack-referenced file '%s'.", String(pf.pack)));
+		}
+	}
 	pos = 0;
 	eof = false;
 }
 
+FileAccessPack::~FileAccessPack() {
+	if (zstd_d_ctx) {
+		ZSTD_freeDCtx(zstd_d_ctx);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////////////////
 // DIR ACCESS
 //////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,7 @@
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
@@ -45,15 +46,20 @@
 // The current packed file format version number.
 #define PACK_FORMAT_VERSION PACK_FORMAT_VERSION_V3
 
+// Uncompressed size of the independently decompressed frames of compressed files.
+#define PACK_COMPRESSED_FRAME_SIZE 65536
+
 enum PackFlags {
 	PACK_DIR_ENCRYPTED = 1 << 0,
 	PACK_REL_FILEBASE = 1 << 1,
 	PACK_SPARSE_BUNDLE = 1 << 2,
+	PACK_COMPRESSED_FILES = 1 << 3,
 };
 
 enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REMOVAL = 1 << 1,
+	PACK_FILE_COMPRESSED = 1 << 2,
 };
 
 class PackSource;
@@ -70,8 +76,10 @@ public:
 		uint64_t size;
 		uint8_t md5[16];
 		PackSource *src = nullptr;
-		bool encrypted;
-		bool bundle;
+		bool encrypted = false;
+		bool bundle = false;
+		bool compressed = false;
+		Vector<uint8_t> dictionary; // Zstd dictionary shared by the compressed files of the pack.
 	};
 
 private:
@@ -116,7 +124,7 @@ private:
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false, bool p_compressed = false, const Vector<uint8_t> &p_dictionary = Vector<uint8_t>()); // for PackSource
 	void remove_path(const String &p_path);
 	uint8_t *get_file_hash(const String &p_path);
 	HashSet<String> get_file_paths() const;
@@ -162,6 +170,8 @@ public:
 	virtual Ref<FileAccess> get_file(const String &p_path, PackedData::PackedFile *p_file) override;
 };
 
+struct ZSTD_DCtx_s;
+
 class FileAccessPack : public FileAccess {
 	GDSOFTCLASS(FileAccessPack, FileAccess);
 	PackedData::PackedFile pf;
@@ -171,6 +181,19 @@ class FileAccessPack : public FileAccess {
 	uint64_t off;
 
 	Ref<FileAccess> f;
+
+	// Compressed files are stored as a table of zstd frames, each one can be decompressed on its own.
+	uint32_t frame_size = 0;
+	uint64_t frames_offset = 0;
+	LocalVector<uint64_t> frame_offsets;
+	mutable LocalVector<uint8_t> frame_buffer;
+	mutable LocalVector<uint8_t> compressed_buffer;
+	mutable int64_t current_frame = -1;
+	mutable ZSTD_DCtx_s *zstd_d_ctx = nullptr;
+
+	bool _open_compressed();
+	bool _decompress_frame(uint32_t p_frame) const;
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override;
 	virtual uint64_t _get_modified_time(const String &p_file) override { return 0; }
 	virtual uint64_t _get_access_time(const String &p_file) override { return 0; }
@@ -194,6 +217,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_buffer_mapped(uint64_t p_length) const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -208,6 +232,7 @@ public:
 	virtual void close() override;
 
 	FileAccessPack(const String &p_path, const PackedData::PackedFile &p_file);
+	~FileAccessPack();
 };
 
 int64_t PackedData::get_size(const String &p_path) {
@@ -35,6 +35,7 @@
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
 
@@ -467,67 +468,109 @@ int Image::get_mipmap_count() const {
 	}
 }
 
+// Images with fewer pixels than this are processed on the calling thread,
+// as dispatching them to the worker threads costs more than it saves.
+static constexpr uint64_t IMAGE_THREADED_MIN_PIXELS = 256 * 256;
+
+// Calls `p_process(from, to)` on bands of `p_rows` rows in parallel using the worker thread pool.
+// Bands write to disjoint rows with the same arithmetic as a single pass, so the output doesn't depend on the split.
+template <typename F>
+static void _process_rows_threaded(uint32_t p_rows, uint64_t p_pixels, const F &p_process) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	// Waiting for a group task blocks, so don't dispatch from inside the pool to avoid starving it.
+	const uint32_t band_count = (pool && pool->get_thread_index() == -1) ? MIN(p_rows, uint32_t(pool->get_thread_count()) * 4) : 1;
+	if (p_pixels < IMAGE_THREADED_MIN_PIXELS || band_count <= 1) {
+		p_process(0, p_rows);
+		return;
+	}
+
+	struct Bands {
+		const F *process = nullptr;
+		uint32_t rows = 0;
+		uint32_t count = 0;
+
+		static void process_band(void *p_userdata, uint32_t p_band) {
+			const Bands *bands = (const Bands *)p_userdata;
+			const uint32_t from = uint64_t(bands->rows) * p_band / bands->count;
+			const uint32_t to = uint64_t(bands->rows) * (p_band + 1) / bands->count;
+			(*bands->process)(from, to);
+		}
+	};
+
+	Bands bands;
+	bands.process = &p_process;
+	bands.rows = p_rows;
+	bands.count = band_count;
+
+	WorkerThreadPool::GroupID group_task = pool->add_native_group_task(&Bands::process_band, &bands, band_count, -1, true, SNAME("ImageProcessRows"));
+	pool->wait_for_group_task_completion(group_task);
+}
+
 // Using template generates perfectly optimized code due to constant expression reduction and unused variable removal present in all compilers.
 template <uint32_t read_bytes, bool read_alpha, uint32_t write_bytes, bool write_alpha, bool read_gray, bool write_gray>
 static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
 	constexpr uint32_t max_bytes = MAX(read_bytes, write_bytes);
 
-	for (int y = 0; y < p_height; y++) {
-		for (int x = 0; x < p_width; x++) {
-			const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
-			uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
+	_process_rows_threaded(p_height, uint64_t(p_width) * p_height, [&](uint32_t p_from, uint32_t p_to) {
+		for (int y = p_from; y < int(p_to); y++) {
+			for (int x = 0; x < p_width; x++) {
+				const uint8_t *rofs = &p_src[((y * p_width) + x) * (read_bytes + (read_alpha ? 1 : 0))];
+				uint8_t *wofs = &p_dst[((y * p_width) + x) * (write_bytes + (write_alpha ? 1 : 0))];
 
-			uint8_t rgba[4] = { 0, 0, 0, 255 };
+				uint8_t rgba[4] = { 0, 0, 0, 255 };
 
-			if constexpr (read_gray) {
-				rgba[0] = rofs[0];
-				rgba[1] = rofs[0];
-				rgba[2] = rofs[0];
-			} else {
-				for (uint32_t i = 0; i < max_bytes; i++) {
-					rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+				if constexpr (read_gray) {
+					rgba[0] = rofs[0];
+					rgba[1] = rofs[0];
+					rgba[2] = rofs[0];
+				} else {
+					for (uint32_t i = 0; i < max_bytes; i++) {
+						rgba[i] = (i < read_bytes) ? rofs[i] : 0;
+					}
 				}
-			}
 
-			if constexpr (read_alpha || write_alpha) {
-				rgba[3] = read_alpha ? rofs[read_bytes] : 255;
-			}
+				if constexpr (read_alpha || write_alpha) {
+					rgba[3] = read_alpha ? rofs[read_bytes] : 255;
+				}
 
-			if constexpr (write_gray) {
-				// REC.709
-				const uint8_t luminance = (13938U * rgba[0] + 46869U * rgba[1] + 4729U * rgba[2] + 32768U) >> 16U;
-				wofs[0] = luminance;
-			} else {
-				for (uint32_t i = 0; i < write_bytes; i++) {
-					wofs[i] = rgba[i];
+				if constexpr (write_gray) {
+					// REC.709
+					const uint8_t luminance = (13938U * rgba[0] + 46869U * rgba[1] + 4729U * rgba[2] + 32768U) >> 16U;
+					wofs[0] = luminance;
+				} else {
+					for (uint32_t i = 0; i < write_bytes; i++) {
+						wofs[i] = rgba[i];
+					}
 				}
-			}
 
-			if constexpr (write_alpha) {
-				wofs[write_bytes] = rgba[3];
+				if constexpr (write_alpha) {
+					wofs[write_bytes] = rgba[3];
+				}
 			}
 		}
-	}
+	});
 }
 
 template <typename T, uint32_t read_channels, uint32_t write_channels, T def_zero, T def_one>
 static void _convert_fast(int p_width, int p_height, const T *p_src, T *p_dst) {
-	uint32_t dst_count = 0;
-	uint32_t src_count = 0;
+	_process_rows_threaded(p_height, uint64_t(p_width) * p_height, [&](uint32_t p_from, uint32_t p_to) {
+		uint64_t dst_count = uint64_t(p_from) * p_width * write_channels;
+		uint64_t src_count = uint64_t(p_from) * p_width * read_channels;
 
-	const int resolution = p_width * p_height;
+		const uint64_t resolution = uint64_t(p_to - p_from) * p_width;
 
-	for (int i = 0; i < resolution; i++) {
-		memcpy(p_dst + dst_count, p_src + src_count, MIN(read_channels, write_channels) * sizeof(T));
+		for (uint64_t i = 0; i < resolution; i++) {
+			memcpy(p_dst + dst_count, p_src + src_count, MIN(read_channels, write_channels) * sizeof(T));
 
-		if constexpr (write_channels > read_channels) {
-			const T def_value[4] = { def_zero, def_zero, def_zero, def_one };
-			memcpy(p_dst + dst_count + read_channels, &def_value[read_channels], (write_channels - read_channels) * sizeof(T));
-		}
+			if constexpr (write_channels > read_channels) {
+				const T def_value[4] = { def_zero, def_zero, def_zero, def_one };
+				memcpy(p_dst + dst_count + read_channels, &def_value[read_channels], (write_channels - read_channels) * sizeof(T));
+			}
 
-		dst_count += write_channels;
-		src_count += read_channels;
-	}
+			dst_count += write_channels;
+			src_count += read_channels;
+		}
+	});
 }
 
 static bool _are_formats_compatible(Image::Format p_format0, Image::Format p_format1) {
@@ -790,84 +833,87 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int height = p_src_height;
 	double xfac = (double)width / p_dst_width;
 	double yfac = (double)height / p_dst_height;
-	// coordinates of source points and coefficients
-	double ox, oy, dx, dy;
-	int ox1, oy1, ox2, oy2;
 	// destination pixel values
 	// width and height decreased by 1
 	int ymax = height - 1;
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
-		// Y coordinates
-		oy = (double)y * yfac - 0.5f;
-		oy1 = (int)oy;
-		dy = oy - (double)oy1;
-
-		for (uint32_t x = 0; x < p_dst_width; x++) {
-			// X coordinates
-			ox = (double)x * xfac - 0.5f;
-			ox1 = (int)ox;
-			dx = ox - (double)ox1;
+	_process_rows_threaded(p_dst_height, uint64_t(p_dst_width) * p_dst_height, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t y = p_from; y < p_to; y++) {
+			// coordinates of source points and coefficients
+			double ox, oy, dx, dy;
+			int ox1, oy1, ox2, oy2;
 
-			// initial pixel value
+			// Y coordinates
+			oy = (double)y * yfac - 0.5f;
+			oy1 = (int)oy;
+			dy = oy - (double)oy1;
 
-			T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
+			for (uint32_t x = 0; x < p_dst_width; x++) {
+				// X coordinates
+				ox = (double)x * xfac - 0.5f;
+				ox1 = (int)ox;
+				dx = ox - (double)ox1;
 
-			double color[CC];
-			for (int i = 0; i < CC; i++) {
-				color[i] = 0;
-			}
+				// initial pixel value
 
-			for (int n = -1; n < 3; n++) {
-				// get Y coefficient
-				[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
+				T *__restrict dst = ((T *)p_dst) + (y * p_dst_width + x) * CC;
 
-				oy2 = oy1 + n;
-				if (oy2 < 0) {
-					oy2 = 0;
-				}
-				if (oy2 > ymax) {
-					oy2 = ymax;
+				double color[CC];
+				for (int i = 0; i < CC; i++) {
+					color[i] = 0;
 				}
 
-				for (int m = -1; m < 3; m++) {
-					// get X coefficient
-					[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
+				for (int n = -1; n < 3; n++) {
+					// get Y coefficient
+					[[maybe_unused]] double k1 = _bicubic_interp_kernel(dy - (double)n);
 
-					ox2 = ox1 + m;
-					if (ox2 < 0) {
-						ox2 = 0;
+					oy2 = oy1 + n;
+					if (oy2 < 0) {
+						oy2 = 0;
 					}
-					if (ox2 > xmax) {
-						ox2 = xmax;
+					if (oy2 > ymax) {
+						oy2 = ymax;
 					}
 
-					// get pixel of original image
-					const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+					for (int m = -1; m < 3; m++) {
+						// get X coefficient
+						[[maybe_unused]] double k2 = k1 * _bicubic_interp_kernel((double)m - dx);
 
-					for (int i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2) { //half float
-							color[i] = Math::half_to_float(p[i]);
-						} else {
-							color[i] += p[i] * k2;
+						ox2 = ox1 + m;
+						if (ox2 < 0) {
+							ox2 = 0;
+						}
+						if (ox2 > xmax) {
+							ox2 = xmax;
+						}
+
+						// get pixel of original image
+						const T *__restrict p = ((T *)p_src) + (oy2 * p_src_width + ox2) * CC;
+
+						for (int i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2) { //half float
+								color[i] = Math::half_to_float(p[i]);
+							} else {
+								color[i] += p[i] * k2;
+							}
 						}
 					}
 				}
-			}
 
-			for (int i = 0; i < CC; i++) {
-				if constexpr (sizeof(T) == 1) { //byte
-					dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
-				} else if constexpr (sizeof(T) == 2) { //half float
-					dst[i] = Math::make_half_float(color[i]);
-				} else {
-					dst[i] = color[i];
+				for (int i = 0; i < CC; i++) {
+					if constexpr (sizeof(T) == 1) { //byte
+						dst[i] = CLAMP(Math::fast_ftoi(color[i]), 0, 255);
+					} else if constexpr (sizeof(T) == 2) { //half float
+						dst[i] = Math::make_half_float(color[i]);
+					} else {
+						dst[i] = color[i];
+					}
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T>
@@ -877,106 +923,110 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 	constexpr uint32_t FRAC_HALF = (FRAC_LEN >> 1);
 	constexpr uint32_t FRAC_MASK = FRAC_LEN - 1;
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		// Add 0.5 in order to interpolate based on pixel center
-		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
-		// Calculate nearest src pixel center above current, and truncate to get y index
-		uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
-		uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
-		if (src_yofs_down >= p_src_height) {
-			src_yofs_down = p_src_height - 1;
-		}
-		// Calculate distance to pixel center of src_yofs_up
-		uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
-		src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
-
-		uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
-		uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
-
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
-			uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
-			uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
-			if (src_xofs_right >= p_src_width) {
-				src_xofs_right = p_src_width - 1;
+	_process_rows_threaded(p_dst_height, uint64_t(p_dst_width) * p_dst_height, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			// Add 0.5 in order to interpolate based on pixel center
+			uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
+			// Calculate nearest src pixel center above current, and truncate to get y index
+			uint32_t src_yofs_up = src_yofs_up_fp >= FRAC_HALF ? (src_yofs_up_fp - FRAC_HALF) >> FRAC_BITS : 0;
+			uint32_t src_yofs_down = (src_yofs_up_fp + FRAC_HALF) >> FRAC_BITS;
+			if (src_yofs_down >= p_src_height) {
+				src_yofs_down = p_src_height - 1;
 			}
-			uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
-			src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
-
-			src_xofs_left *= CC;
-			src_xofs_right *= CC;
-
-			for (uint32_t l = 0; l < CC; l++) {
-				if constexpr (sizeof(T) == 1) { //uint8
-					uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
-					uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
-					uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
-
-					uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
-					uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
-					interp >>= FRAC_BITS;
-					p_dst[i * p_dst_width * CC + j * CC + l] = uint8_t(interp);
-				} else if constexpr (sizeof(T) == 2) { //half float
-
-					float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-					float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-					const T *src = ((const T *)p_src);
-					T *dst = ((T *)p_dst);
+			// Calculate distance to pixel center of src_yofs_up
+			uint32_t src_yofs_frac = src_yofs_up_fp & FRAC_MASK;
+			src_yofs_frac = src_yofs_frac >= FRAC_HALF ? src_yofs_frac - FRAC_HALF : src_yofs_frac + FRAC_HALF;
+
+			uint32_t y_ofs_up = src_yofs_up * p_src_width * CC;
+			uint32_t y_ofs_down = src_yofs_down * p_src_width * CC;
+
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				uint32_t src_xofs_left_fp = (j + 0.5) * p_src_width * FRAC_LEN / p_dst_width;
+				uint32_t src_xofs_left = src_xofs_left_fp >= FRAC_HALF ? (src_xofs_left_fp - FRAC_HALF) >> FRAC_BITS : 0;
+				uint32_t src_xofs_right = (src_xofs_left_fp + FRAC_HALF) >> FRAC_BITS;
+				if (src_xofs_right >= p_src_width) {
+					src_xofs_right = p_src_width - 1;
+				}
+				uint32_t src_xofs_frac = src_xofs_left_fp & FRAC_MASK;
+				src_xofs_frac = src_xofs_frac >= FRAC_HALF ? src_xofs_frac - FRAC_HALF : src_xofs_frac + FRAC_HALF;
+
+				src_xofs_left *= CC;
+				src_xofs_right *= CC;
+
+				for (uint32_t l = 0; l < CC; l++) {
+					if constexpr (sizeof(T) == 1) { //uint8
+						uint32_t p00 = p_src[y_ofs_up + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p10 = p_src[y_ofs_up + src_xofs_right + l] << FRAC_BITS;
+						uint32_t p01 = p_src[y_ofs_down + src_xofs_left + l] << FRAC_BITS;
+						uint32_t p11 = p_src[y_ofs_down + src_xofs_right + l] << FRAC_BITS;
+
+						uint32_t interp_up = p00 + (((p10 - p00) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp_down = p01 + (((p11 - p01) * src_xofs_frac) >> FRAC_BITS);
+						uint32_t interp = interp_up + (((interp_down - interp_up) * src_yofs_frac) >> FRAC_BITS);
+						interp >>= FRAC_BITS;
+						p_dst[i * p_dst_width * CC + j * CC + l] = uint8_t(interp);
+					} else if constexpr (sizeof(T) == 2) { //half float
 
-					float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
-					float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
-					float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
-					float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
+						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+						const T *src = ((const T *)p_src);
+						T *dst = ((T *)p_dst);
 
-					float interp_up = p00 + (p10 - p00) * xofs_frac;
-					float interp_down = p01 + (p11 - p01) * xofs_frac;
-					float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+						float p00 = Math::half_to_float(src[y_ofs_up + src_xofs_left + l]);
+						float p10 = Math::half_to_float(src[y_ofs_up + src_xofs_right + l]);
+						float p01 = Math::half_to_float(src[y_ofs_down + src_xofs_left + l]);
+						float p11 = Math::half_to_float(src[y_ofs_down + src_xofs_right + l]);
 
-					dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
-				} else if constexpr (sizeof(T) == 4) { //float
+						float interp_up = p00 + (p10 - p00) * xofs_frac;
+						float interp_down = p01 + (p11 - p01) * xofs_frac;
+						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
 
-					float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
-					float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
-					const T *src = ((const T *)p_src);
-					T *dst = ((T *)p_dst);
+						dst[i * p_dst_width * CC + j * CC + l] = Math::make_half_float(interp);
+					} else if constexpr (sizeof(T) == 4) { //float
+
+						float xofs_frac = float(src_xofs_frac) / (1 << FRAC_BITS);
+						float yofs_frac = float(src_yofs_frac) / (1 << FRAC_BITS);
+						const T *src = ((const T *)p_src);
+						T *dst = ((T *)p_dst);
 
-					float p00 = src[y_ofs_up + src_xofs_left + l];
-					float p10 = src[y_ofs_up + src_xofs_right + l];
-					float p01 = src[y_ofs_down + src_xofs_left + l];
-					float p11 = src[y_ofs_down + src_xofs_right + l];
+						float p00 = src[y_ofs_up + src_xofs_left + l];
+						float p10 = src[y_ofs_up + src_xofs_right + l];
+						float p01 = src[y_ofs_down + src_xofs_left + l];
+						float p11 = src[y_ofs_down + src_xofs_right + l];
 
-					float interp_up = p00 + (p10 - p00) * xofs_frac;
-					float interp_down = p01 + (p11 - p01) * xofs_frac;
-					float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
+						float interp_up = p00 + (p10 - p00) * xofs_frac;
+						float interp_down = p01 + (p11 - p01) * xofs_frac;
+						float interp = interp_up + ((interp_down - interp_up) * yofs_frac);
 
-					dst[i * p_dst_width * CC + j * CC + l] = interp;
+						dst[i * p_dst_width * CC + j * CC + l] = interp;
+					}
 				}
 			}
 		}
-	}
+	});
 }
 
 template <int CC, typename T>
 static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
-		uint32_t src_yofs = i * p_src_height / p_dst_height;
-		uint32_t y_ofs = src_yofs * p_src_width * CC;
+	_process_rows_threaded(p_dst_height, uint64_t(p_dst_width) * p_dst_height, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			uint32_t src_yofs = i * p_src_height / p_dst_height;
+			uint32_t y_ofs = src_yofs * p_src_width * CC;
 
-		for (uint32_t j = 0; j < p_dst_width; j++) {
-			uint32_t src_xofs = j * p_src_width / p_dst_width;
-			src_xofs *= CC;
+			for (uint32_t j = 0; j < p_dst_width; j++) {
+				uint32_t src_xofs = j * p_src_width / p_dst_width;
+				src_xofs *= CC;
 
-			for (uint32_t l = 0; l < CC; l++) {
-				const T *src = ((const T *)p_src);
-				T *dst = ((T *)p_dst);
+				for (uint32_t l = 0; l < CC; l++) {
+					const T *src = ((const T *)p_src);
+					T *dst = ((T *)p_dst);
 
-				T p = src[y_ofs + src_xofs + l];
-				dst[i * p_dst_width * CC + j * CC + l] = p;
+					T p = src[y_ofs + src_xofs + l];
+					dst[i * p_dst_width * CC + j * CC + l] = p;
+				}
 			}
 		}
-	}
+	});
 }
 
 #define LANCZOS_TYPE 3
@@ -1002,47 +1052,49 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(x_scale, 1); // A larger kernel is required only when downscaling
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		_process_rows_threaded(src_height, uint64_t(dst_width) * src_height, [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
-			// The corresponding point on the source image
-			float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
-			int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
-			int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
+			for (int32_t buffer_x = 0; buffer_x < dst_width; buffer_x++) {
+				// The corresponding point on the source image
+				float src_x = (buffer_x + 0.5f) * x_scale; // Offset by 0.5 so it uses the pixel's center
+				int32_t start_x = MAX(0, int32_t(src_x) - half_kernel + 1);
+				int32_t end_x = MIN(src_width - 1, int32_t(src_x) + half_kernel);
 
-			// Create the kernel used by all the pixels of the column
-			for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-				kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
-			}
+				// Create the kernel used by all the pixels of the column
+				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+					kernel[target_x - start_x] = _lanczos((target_x + 0.5f - src_x) / scale_factor);
+				}
 
-			for (int32_t buffer_y = 0; buffer_y < src_height; buffer_y++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t buffer_y = p_from; buffer_y < int32_t(p_to); buffer_y++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
-					float lanczos_val = kernel[target_x - start_x];
-					weight += lanczos_val;
+					for (int32_t target_x = start_x; target_x <= end_x; target_x++) {
+						float lanczos_val = kernel[target_x - start_x];
+						weight += lanczos_val;
 
-					const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
+						const T *__restrict src_data = ((const T *)p_src) + (buffer_y * src_width + target_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						if constexpr (sizeof(T) == 2) { //half float
-							pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
-						} else {
-							pixel[i] += src_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							if constexpr (sizeof(T) == 2) { //half float
+								pixel[i] += Math::half_to_float(src_data[i]) * lanczos_val;
+							} else {
+								pixel[i] += src_data[i] * lanczos_val;
+							}
 						}
 					}
-				}
 
-				float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
+					float *dst_data = ((float *)buffer) + (buffer_y * dst_width + buffer_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					for (uint32_t i = 0; i < CC; i++) {
+						dst_data[i] = pixel[i] / weight; // Normalize the sum of all the samples
+					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of first pass
 
 	{ // SECOND PASS (vertical + result)
@@ -1052,49 +1104,51 @@ static void _scale_lanczos(const uint8_t *__restrict p_src, uint8_t *__restrict
 		float scale_factor = MAX(y_scale, 1);
 		int32_t half_kernel = LANCZOS_TYPE * scale_factor;
 
-		float *kernel = memnew_arr(float, half_kernel * 2);
+		_process_rows_threaded(dst_height, uint64_t(dst_width) * dst_height, [&](uint32_t p_from, uint32_t p_to) {
+			float *kernel = memnew_arr(float, half_kernel * 2);
 
-		for (int32_t dst_y = 0; dst_y < dst_height; dst_y++) {
-			float buffer_y = (dst_y + 0.5f) * y_scale;
-			int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
-			int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
+			for (int32_t dst_y = p_from; dst_y < int32_t(p_to); dst_y++) {
+				float buffer_y = (dst_y + 0.5f) * y_scale;
+				int32_t start_y = MAX(0, int32_t(buffer_y) - half_kernel + 1);
+				int32_t end_y = MIN(src_height - 1, int32_t(buffer_y) + half_kernel);
 
-			for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-				kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
-			}
+				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+					kernel[target_y - start_y] = _lanczos((target_y + 0.5f - buffer_y) / scale_factor);
+				}
 
-			for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
-				float pixel[CC] = { 0 };
-				float weight = 0;
+				for (int32_t dst_x = 0; dst_x < dst_width; dst_x++) {
+					float pixel[CC] = { 0 };
+					float weight = 0;
 
-				for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
-					float lanczos_val = kernel[target_y - start_y];
-					weight += lanczos_val;
+					for (int32_t target_y = start_y; target_y <= end_y; target_y++) {
+						float lanczos_val = kernel[target_y - start_y];
+						weight += lanczos_val;
 
-					float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
+						float *buffer_data = ((float *)buffer) + (target_y * dst_width + dst_x) * CC;
 
-					for (uint32_t i = 0; i < CC; i++) {
-						pixel[i] += buffer_data[i] * lanczos_val;
+						for (uint32_t i = 0; i < CC; i++) {
+							pixel[i] += buffer_data[i] * lanczos_val;
+						}
 					}
-				}
-
-				T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-				for (uint32_t i = 0; i < CC; i++) {
-					pixel[i] /= weight;
+					T *dst_data = ((T *)p_dst) + (dst_y * dst_width + dst_x) * CC;
 
-					if constexpr (sizeof(T) == 1) { //byte
-						dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
-					} else if constexpr (sizeof(T) == 2) { //half float
-						dst_data[i] = Math::make_half_float(pixel[i]);
-					} else { // float
-						dst_data[i] = pixel[i];
+					for (uint32_t i = 0; i < CC; i++) {
+						pixel[i] /= weight;
+
+						if constexpr (sizeof(T) == 1) { //byte
+							dst_data[i] = CLAMP(Math::fast_ftoi(pixel[i]), 0, 255);
+						} else if constexpr (sizeof(T) == 2) { //half float
+							dst_data[i] = Math::make_half_float(pixel[i]);
+						} else { // float
+							dst_data[i] = pixel[i];
+						}
 					}
 				}
 			}
-		}
 
-		memdelete_arr(kernel);
+			memdelete_arr(kernel);
+		});
 	} // End of second pass
 
 	memdelete_arr(buffer);
@@ -1773,27 +1827,29 @@ static void _generate_po2_mipmap(const Component *p_src, Component *p_dst, uint3
 	int right_step = (p_width == 1) ? 0 : CC;
 	int down_step = (p_height == 1) ? 0 : (p_width * CC);
 
-	for (uint32_t i = 0; i < dst_h; i++) {
-		const Component *rup_ptr = &p_src[i * 2 * down_step];
-		const Component *rdown_ptr = rup_ptr + down_step;
-		Component *dst_ptr = &p_dst[i * dst_w * CC];
-		uint32_t count = dst_w;
+	_process_rows_threaded(dst_h, uint64_t(dst_w) * dst_h, [&](uint32_t p_from, uint32_t p_to) {
+		for (uint32_t i = p_from; i < p_to; i++) {
+			const Component *rup_ptr = &p_src[i * 2 * down_step];
+			const Component *rdown_ptr = rup_ptr + down_step;
+			Component *dst_ptr = &p_dst[i * dst_w * CC];
+			uint32_t count = dst_w;
+
+			while (count) {
+				count--;
+				for (int j = 0; j < CC; j++) {
+					average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
+				}
 
-		while (count) {
-			count--;
-			for (int j = 0; j < CC; j++) {
-				average_func(dst_ptr[j], rup_ptr[j], rup_ptr[j + right_step], rdown_ptr[j], rdown_ptr[j + right_step]);
-			}
+				if (renormalize) {
+					renormalize_func(dst_ptr);
+				}
 
-			if (renormalize) {
-				renormalize_func(dst_ptr);
+				dst_ptr += CC;
+				rup_ptr += right_step * 2;
+				rdown_ptr += right_step * 2;
 			}
-
-			dst_ptr += CC;
-			rup_ptr += right_step * 2;
-			rdown_ptr += right_step * 2;
 		}
-	}
+	});
 }
 
 void Image::_generate_mipmap_from_format(Image::Format p_format, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_width, uint32_t p_height, bool p_renormalize) {
@@ -3906,15 +3962,17 @@ void Image::premultiply_alpha() {
 
 	uint8_t *data_ptr = data.ptrw();
 
-	for (int i = 0; i < height; i++) {
-		for (int j = 0; j < width; j++) {
-			uint8_t *ptr = &data_ptr[(i * width + j) * 4];
+	_process_rows_threaded(height, uint64_t(width) * height, [&](uint32_t p_from, uint32_t p_to) {
+		for (int i = p_from; i < int(p_to); i++) {
+			for (int j = 0; j < width; j++) {
+				uint8_t *ptr = &data_ptr[(i * width + j) * 4];
 
-			ptr[0] = (uint16_t(ptr[0]) * uint16_t(ptr[3]) + 255U) >> 8;
-			ptr[1] = (uint16_t(ptr[1]) * uint16_t(ptr[3]) + 255U) >> 8;
-			ptr[2] = (uint16_t(ptr[2]) * uint16_t(ptr[3]) + 255U) >> 8;
+				ptr[0] = (uint16_t(ptr[0]) * uint16_t(ptr[3]) + 255U) >> 8;
+				ptr[1] = (uint16_t(ptr[1]) * uint16_t(ptr[3]) + 255U) >> 8;
+				ptr[2] = (uint16_t(ptr[2]) * uint16_t(ptr[3]) + 255U) >> 8;
+			}
 		}
-	}
+	});
 }
 
 void Image::fix_alpha_edges() {
@@ -47,15 +47,15 @@ const char *JSON::tk_name[TK_MAX] = {
 	"EOF",
 };
 
-void JSON::_add_indent(String &r_result, const String &p_indent, int p_size) {
+void JSON::_add_indent(StringBuilder &r_result, const String &p_indent, int p_size) {
 	for (int i = 0; i < p_size; i++) {
-		r_result += p_indent;
+		r_result.append(p_indent);
 	}
 }
 
-void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
+void JSON::_stringify(StringBuilder &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision) {
 	if (p_cur_indent > Variant::MAX_RECURSION_DEPTH) {
-		r_result += "...";
+		r_result.append("...");
 		ERR_FAIL_MSG("JSON structure is too deep. Bailing.");
 	}
 
@@ -64,13 +64,13 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 
 	switch (p_var.get_type()) {
 		case Variant::NIL:
-			r_result += "null";
+			r_result.append("null");
 			return;
 		case Variant::BOOL:
-			r_result += p_var.operator bool() ? "true" : "false";
+			r_result.append(p_var.operator bool() ? "true" : "false");
 			return;
 		case Variant::INT:
-			r_result += itos(p_var);
+			r_result.append(itos(p_var));
 			return;
 		case Variant::FLOAT: {
 			const double num = p_var;
@@ -78,7 +78,7 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 			// Only for exactly 0. If we have approximately 0 let the user decide how much
 			// precision they want.
 			if (num == double(0.0)) {
-				r_result += "0.0";
+				r_result.append("0.0");
 				return;
 			}
 
@@ -86,7 +86,7 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 			const int total_digits = p_full_precision ? 17 : 14;
 			const int precision = MAX(1, total_digits - (int)Math::floor(magnitude));
 
-			r_result += String::num(num, precision);
+			r_result.append(String::num(num, precision));
 			return;
 		}
 		case Variant::PACKED_INT32_ARRAY:
@@ -97,17 +97,17 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 		case Variant::ARRAY: {
 			Array a = p_var;
 			if (p_markers.has(a.id())) {
-				r_result += "\"[...]\"";
+				r_result.append("\"[...]\"");
 				ERR_FAIL_MSG("Converting circular structure to JSON.");
 			}
 
 			if (a.is_empty()) {
-				r_result += "[]";
+				r_result.append("[]");
 				return;
 			}
 
-			r_result += '[';
-			r_result += end_statement;
+			r_result.append("[");
+			r_result.append(end_statement);
 
 			p_markers.insert(a.id());
 
@@ -116,27 +116,27 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 				if (first) {
 					first = false;
 				} else {
-					r_result += ',';
-					r_result += end_statement;
+					r_result.append(",");
+					r_result.append(end_statement);
 				}
 				_add_indent(r_result, p_indent, p_cur_indent + 1);
 				_stringify(r_result, var, p_indent, p_cur_indent + 1, p_sort_keys, p_markers, p_full_precision);
 			}
-			r_result += end_statement;
+			r_result.append(end_statement);
 			_add_indent(r_result, p_indent, p_cur_indent);
-			r_result += ']';
+			r_result.append("]");
 			p_markers.erase(a.id());
 			return;
 		}
 		case Variant::DICTIONARY: {
 			Dictionary d = p_var;
 			if (p_markers.has(d.id())) {
-				r_result += "\"{...}\"";
+				r_result.append("\"{...}\"");
 				ERR_FAIL_MSG("Converting circular structure to JSON.");
 			}
 
-			r_result += '{';
-			r_result += end_statement;
+			r_result.append("{");
+			r_result.append(end_statement);
 			p_markers.insert(d.id());
 
 			LocalVector<Variant> keys = d.get_key_list();
@@ -150,25 +150,25 @@ void JSON::_stringify(String &r_result, const Variant &p_var, const String &p_in
 				if (first_key) {
 					first_key = false;
 				} else {
-					r_result += ',';
-					r_result += end_statement;
+					r_result.append(",");
+					r_result.append(end_statement);
 				}
 				_add_indent(r_result, p_indent, p_cur_indent + 1);
 				_stringify(r_result, String(key), p_indent, p_cur_indent + 1, p_sort_keys, p_markers, p_full_precision);
-				r_result += colon;
+				r_result.append(colon);
 				_stringify(r_result, d[key], p_indent, p_cur_indent + 1, p_sort_keys, p_markers, p_full_precision);
 			}
 
-			r_result += end_statement;
+			r_result.append(end_statement);
 			_add_indent(r_result, p_indent, p_cur_indent);
-			r_result += '}';
+			r_result.append("}");
 			p_markers.erase(d.id());
 			return;
 		}
 		default:
-			r_result += '"';
-			r_result += String(p_var).json_escape();
-			r_result += '"';
+			r_result.append("\"");
+			r_result.append(String(p_var).json_escape());
+			r_result.append("\"");
 			return;
 	}
 }
@@ -575,6 +575,510 @@ Error JSON::_parse_string(const String &p_json, Variant &r_ret, String &r_err_st
 	return err;
 }
 
+// Parses UTF-8 encoded JSON directly from a buffer, without converting it to a String first.
+// Plain runs of string characters and whitespace are skipped eight bytes at a time.
+struct JSONBufferParser {
+	const uint8_t *ptr = nullptr;
+	const uint8_t *end = nullptr;
+	int line = 0;
+	String err_str;
+
+	static constexpr uint64_t ONES = 0x0101010101010101ULL;
+	static constexpr uint64_t HIGHS = 0x8080808080808080ULL;
+
+	static _FORCE_INLINE_ uint64_t _has_byte(uint64_t p_word, uint8_t p_byte) {
+		const uint64_t x = p_word ^ (ONES * p_byte);
+		return (x - ONES) & ~x & HIGHS;
+	}
+
+	_FORCE_INLINE_ bool _is_eof() const {
+		return ptr >= end || *ptr == 0;
+	}
+
+	void _skip_whitespace() {
+		while (ptr < end) {
+			if (end - ptr >= 8) {
+				uint64_t word;
+				memcpy(&word, ptr, 8);
+				if (word == ONES * ' ') {
+					ptr += 8;
+					continue;
+				}
+			}
+			const uint8_t c = *ptr;
+			if (c == 0 || c > 32) {
+				return;
+			}
+			if (c == '\n') {
+				line++;
+			}
+			ptr++;
+		}
+	}
+
+	bool _parse_hex(char32_t &r_value) {
+		r_value = 0;
+		for (int j = 0; j < 4; j++) {
+			if (_is_eof()) {
+				err_str = "Unterminated string";
+				return false;
+			}
+			const char32_t c = *ptr++;
+			if (!is_hex_digit(c)) {
+				err_str = "Malformed hex constant in string";
+				return false;
+			}
+			char32_t v;
+			if (is_digit(c)) {
+				v = c - '0';
+			} else if (c >= 'a' && c <= 'f') {
+				v = c - 'a' + 10;
+			} else {
+				v = c - 'A' + 10;
+			}
+			r_value = (r_value << 4) | v;
+		}
+		return true;
+	}
+
+	Error _parse_string(String &r_str) {
+		ptr++; // Opening quote.
+		while (true) {
+			const uint8_t *run = ptr;
+			while (end - ptr >= 8) {
+				uint64_t word;
+				memcpy(&word, ptr, 8);
+				if (_has_byte(word, '"') | _has_byte(word, '\\') | _has_byte(word, '\n') | _has_byte(word, 0)) {
+					break;
+				}
+				ptr += 8;
+			}
+			while (ptr < end && *ptr != '"' && *ptr != '\\' && *ptr != '\n' && *ptr != 0) {
+				ptr++;
+			}
+			if (ptr > run) {
+				r_str.append_utf8((const char *)run, ptr - run);
+			}
+
+			if (_is_eof()) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+
+			const uint8_t c = *ptr++;
+			if (c == '"') {
+				return OK;
+			} else if (c == '\n') {
+				line++;
+				r_str += '\n';
+				continue;
+			}
+
+			// Escaped characters.
+			if (_is_eof()) {
+				err_str = "Unterminated string";
+				return ERR_PARSE_ERROR;
+			}
+			const uint8_t next = *ptr++;
+			char32_t res = 0;
+			switch (next) {
+				case 'b':
+					res = 8;
+					break;
+				case 't':
+					res = 9;
+					break;
+				case 'n':
+					res = 10;
+					break;
+				case 'f':
+					res = 12;
+					break;
+				case 'r':
+					res = 13;
+					break;
+				case 'u': {
+					if (!_parse_hex(res)) {
+						return ERR_PARSE_ERROR;
+					}
+					if ((res & 0xfffffc00) == 0xd800) {
+						if (end - ptr < 2 || ptr[0] != '\\' || ptr[1] != 'u') {
+							err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+							return ERR_PARSE_ERROR;
+						}
+						ptr += 2;
+						char32_t trail;
+						if (!_parse_hex(trail)) {
+							return ERR_PARSE_ERROR;
+						}
+						if ((trail & 0xfffffc00) != 0xdc00) {
+							err_str = "Invalid UTF-16 sequence in string, unpaired lead surrogate";
+							return ERR_PARSE_ERROR;
+						}
+						res = (res << 10UL) + trail - ((0xd800 << 10UL) + 0xdc00 - 0x10000);
+					} else if ((res & 0xfffffc00) == 0xdc00) {
+						err_str = "Invalid UTF-16 sequence in string, unpaired trail surrogate";
+						return ERR_PARSE_ERROR;
+					}
+				} break;
+				case '"':
+				case '\\':
+				case '/': {
+					res = next;
+				} break;
+				default: {
+					err_str = "Invalid escape sequence";
+					return ERR_PARSE_ERROR;
+				}
+			}
+			r_str += res;
+		}
+	}
+
+	Error _parse_number(double &r_number) {
+		const uint8_t *start = ptr;
+		bool integer = true;
+		if (*ptr == '-') {
+			ptr++;
+		}
+		while (ptr < end && (is_digit(*ptr) || *ptr == '.' || *ptr == 'e' || *ptr == 'E' || ((*ptr == '+' || *ptr == '-') && (ptr[-1] == 'e' || ptr[-1] == 'E')))) {
+			integer = integer && is_digit(*ptr);
+			ptr++;
+		}
+
+		const int64_t len = ptr - start;
+		const bool negative = *start == '-';
+		if (integer && len - negative > 0 && len - negative <= 15) {
+			// Exactly representable, skip the generic conversion.
+			int64_t value = 0;
+			for (const uint8_t *c = start + negative; c < ptr; c++) {
+				value = value * 10 + (*c - '0');
+			}
+			r_number = negative ? -value : value;
+			return OK;
+		}
+
+		char buffer[64];
+		if (len >= (int64_t)sizeof(buffer)) {
+			CharString long_number;
+			long_number.resize_uninitialized(len + 1);
+			memcpy(long_number.ptrw(), start, len);
+			long_number[len] = 0;
+			r_number = String::to_float(long_number.get_data());
+		} else {
+			memcpy(buffer, start, len);
+			buffer[len] = 0;
+			r_number = String::to_float(buffer);
+		}
+		return OK;
+	}
+
+	Error _parse_identifier(Variant &r_value) {
+		const uint8_t *start = ptr;
+		while (ptr < end && is_ascii_alphabet_char(*ptr)) {
+			ptr++;
+		}
+		const int64_t len = ptr - start;
+		if (len == 4 && memcmp(start, "true", 4) == 0) {
+			r_value = true;
+		} else if (len == 5 && memcmp(start, "false", 5) == 0) {
+			r_value = false;
+		} else if (len == 4 && memcmp(start, "null", 4) == 0) {
+			r_value = Variant();
+		} else {
+			err_str = vformat("Expected 'true', 'false', or 'null', got '%s'", String::utf8((const char *)start, len));
+			return ERR_PARSE_ERROR;
+		}
+		return OK;
+	}
+
+	// Consumes the separator before the next element of an array or object.
+	// `r_has_element` is `false` once the closing bracket was reached.
+	Error _next_element(bool &r_first, bool &r_has_element, char p_close, const char *p_expected) {
+		_skip_whitespace();
+		if (_is_eof()) {
+			err_str = vformat("Expected '%c'", p_close);
+			return ERR_PARSE_ERROR;
+		}
+		if (*ptr == p_close) {
+			ptr++;
+			r_has_element = false;
+			return OK;
+		}
+		if (!r_first) {
+			if (*ptr != ',') {
+				err_str = p_expected;
+				return ERR_PARSE_ERROR;
+			}
+			ptr++;
+			_skip_whitespace();
+		}
+		r_first = false;
+		r_has_element = true;
+		return OK;
+	}
+
+	template <typename T>
+	Error _parse_packed_numbers(Vector<T> &r_array) {
+		LocalVector<T> values;
+		bool first = true;
+		bool has_element;
+		while (true) {
+			Error err = _next_element(first, has_element, ']', "Expected ','");
+			if (err != OK) {
+				return err;
+			}
+			if (!has_element) {
+				break;
+			}
+			if (_is_eof() || (*ptr != '-' && !is_digit(*ptr))) {
+				err_str = "Expected number";
+				return ERR_PARSE_ERROR;
+			}
+			double number;
+			_parse_number(number);
+			values.push_back(T(number));
+		}
+		r_array.resize(values.size());
+		if (values.size()) {
+			memcpy(r_array.ptrw(), values.ptr(), values.size() * sizeof(T));
+		}
+		return OK;
+	}
+
+	Error _parse_packed_strings(PackedStringArray &r_array) {
+		bool first = true;
+		bool has_element;
+		while (true) {
+			Error err = _next_element(first, has_element, ']', "Expected ','");
+			if (err != OK) {
+				return err;
+			}
+			if (!has_element) {
+				return OK;
+			}
+			if (_is_eof() || *ptr != '"') {
+				err_str = "Expected string";
+				return ERR_PARSE_ERROR;
+			}
+			String str;
+			err = _parse_string(str);
+			if (err != OK) {
+				return err;
+			}
+			r_array.push_back(str);
+		}
+	}
+
+	Error _parse_typed_value(Variant &r_value, Variant::Type p_type, int p_depth) {
+		switch (p_type) {
+			case Variant::PACKED_INT32_ARRAY:
+			case Variant::PACKED_INT64_ARRAY:
+			case Variant::PACKED_FLOAT32_ARRAY:
+			case Variant::PACKED_FLOAT64_ARRAY:
+			case Variant::PACKED_STRING_ARRAY: {
+				if (_is_eof() || *ptr != '[') {
+					err_str = vformat("Expected '[' for %s", Variant::get_type_name(p_type));
+					return ERR_PARSE_ERROR;
+				}
+				ptr++;
+				Error err = OK;
+				if (p_type == Variant::PACKED_INT32_ARRAY) {
+					PackedInt32Array array;
+					err = _parse_packed_numbers(array);
+					r_value = array;
+				} else if (p_type == Variant::PACKED_INT64_ARRAY) {
+					PackedInt64Array array;
+					err = _parse_packed_numbers(array);
+					r_value = array;
+				} else if (p_type == Variant::PACKED_FLOAT32_ARRAY) {
+					PackedFloat32Array array;
+					err = _parse_packed_numbers(array);
+					r_value = array;
+				} else if (p_type == Variant::PACKED_FLOAT64_ARRAY) {
+					PackedFloat64Array array;
+					err = _parse_packed_numbers(array);
+					r_value = array;
+				} else {
+					PackedStringArray array;
+					err = _parse_packed_strings(array);
+					r_value = array;
+				}
+				return err;
+			}
+			case Variant::INT:
+			case Variant::FLOAT: {
+				if (_is_eof() || (*ptr != '-' && !is_digit(*ptr))) {
+					err_str = "Expected number";
+					return ERR_PARSE_ERROR;
+				}
+				double number;
+				_parse_number(number);
+				if (p_type == Variant::INT) {
+					r_value = int64_t(number);
+				} else {
+					r_value = number;
+				}
+				return OK;
+			}
+			case Variant::STRING: {
+				if (_is_eof() || *ptr != '"') {
+					err_str = "Expected string";
+					return ERR_PARSE_ERROR;
+				}
+				String str;
+				Error err = _parse_string(str);
+				r_value = str;
+				return err;
+			}
+			case Variant::BOOL: {
+				Error err = _parse_value(r_value, Variant(), p_depth);
+				if (err == OK && r_value.get_type() != Variant::BOOL) {
+					err_str = "Expected 'true' or 'false'";
+					return ERR_PARSE_ERROR;
+				}
+				return err;
+			}
+			default: {
+				err_str = vformat("Unsupported type in schema: %s", Variant::get_type_name(p_type));
+				return ERR_INVALID_PARAMETER;
+			}
+		}
+	}
+
+	Error _parse_value(Variant &r_value, const Variant &p_schema, int p_depth) {
+		if (p_depth > Variant::MAX_RECURSION_DEPTH) {
+			err_str = "JSON structure is too deep";
+			return ERR_OUT_OF_MEMORY;
+		}
+
+		_skip_whitespace();
+		if (_is_eof()) {
+			err_str = "Expected value, got 'EOF'";
+			return ERR_PARSE_ERROR;
+		}
+
+		if (p_schema.get_type() == Variant::INT) {
+			const int64_t type = p_schema;
+			if (type < Variant::NIL || type >= Variant::VARIANT_MAX) {
+				err_str = "Invalid type in schema";
+				return ERR_INVALID_PARAMETER;
+			}
+			if (type != Variant::NIL) {
+				return _parse_typed_value(r_value, Variant::Type(type), p_depth);
+			}
+		}
+
+		const uint8_t c = *ptr;
+		if (c == '{') {
+			ptr++;
+			const Dictionary key_schemas = p_schema.get_type() == Variant::DICTIONARY ? Dictionary(p_schema) : Dictionary();
+			Dictionary object;
+			bool first = true;
+			bool has_element;
+			while (true) {
+				Error err = _next_element(first, has_element, '}', "Expected '}' or ','");
+				if (err != OK) {
+					return err;
+				}
+				if (!has_element) {
+					break;
+				}
+				if (_is_eof() || *ptr != '"') {
+					err_str = "Expected key";
+					return ERR_PARSE_ERROR;
+				}
+				String key;
+				err = _parse_string(key);
+				if (err != OK) {
+					return err;
+				}
+				_skip_whitespace();
+				if (_is_eof() || *ptr != ':') {
+					err_str = "Expected ':'";
+					return ERR_PARSE_ERROR;
+				}
+				ptr++;
+
+				Variant value;
+				err = _parse_value(value, key_schemas.is_empty() ? Variant() : key_schemas.get(key, Variant()), p_depth + 1);
+				if (err != OK) {
+					return err;
+				}
+				object[key] = value;
+			}
+			r_value = object;
+		} else if (c == '[') {
+			ptr++;
+			const Variant element_schema = (p_schema.get_type() == Variant::ARRAY && Array(p_schema).size() == 1) ? Array(p_schema)[0] : Variant();
+			Array array;
+			bool first = true;
+			bool has_element;
+			while (true) {
+				Error err = _next_element(first, has_element, ']', "Expected ','");
+				if (err != OK) {
+					return err;
+				}
+				if (!has_element) {
+					break;
+				}
+				Variant value;
+				err = _parse_value(value, element_schema, p_depth + 1);
+				if (err != OK) {
+					return err;
+				}
+				array.push_back(value);
+			}
+			r_value = array;
+		} else if (c == '"') {
+			String str;
+			Error err = _parse_string(str);
+			if (err != OK) {
+				return err;
+			}
+			r_value = str;
+		} else if (c == '-' || is_digit(c)) {
+			double number;
+			_parse_number(number);
+			r_value = number;
+		} else if (is_ascii_alphabet_char(c)) {
+			return _parse_identifier(r_value);
+		} else {
+			err_str = "Unexpected character";
+			return ERR_PARSE_ERROR;
+		}
+		return OK;
+	}
+};
+
+Error JSON::_parse_buffer(const uint8_t *p_buffer, int64_t p_len, const Variant &p_schema, Variant &r_ret, String &r_err_str, int &r_err_line) {
+	JSONBufferParser parser;
+	parser.ptr = p_buffer;
+	parser.end = p_buffer + p_len;
+
+	// Skip the UTF-8 byte order mark.
+	if (p_len >= 3 && p_buffer[0] == 0xef && p_buffer[1] == 0xbb && p_buffer[2] == 0xbf) {
+		parser.ptr += 3;
+	}
+
+	Error err = parser._parse_value(r_ret, p_schema, 0);
+	if (err == OK) {
+		parser._skip_whitespace();
+		if (!parser._is_eof()) {
+			parser.err_str = "Expected 'EOF'";
+			err = ERR_PARSE_ERROR;
+		}
+	}
+
+	if (err != OK) {
+		// Reset return value to empty `Variant`
+		r_ret = Variant();
+		r_err_str = parser.err_str;
+	}
+	r_err_line = parser.line;
+	return err;
+}
+
 Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	Error err = _parse_string(p_json_string, data, err_str, err_line);
 	if (err == Error::OK) {
@@ -586,15 +1090,28 @@ Error JSON::parse(const String &p_json_string, bool p_keep_text) {
 	return err;
 }
 
+Error JSON::parse_buffer(const PackedByteArray &p_json_buffer, const Variant &p_schema) {
+	text.clear();
+	Error err = _parse_buffer(p_json_buffer.ptr(), p_json_buffer.size(), p_schema, data, err_str, err_line);
+	if (err == Error::OK) {
+		err_line = 0;
+	}
+	return err;
+}
+
 String JSON::get_parsed_text() const {
 	return text;
 }
 
-String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
-	String result;
+void JSON::stringify_to(StringBuilder &r_builder, const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
 	HashSet<const void *> markers;
-	_stringify(result, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
-	return result;
+	_stringify(r_builder, p_var, p_indent, 0, p_sort_keys, markers, p_full_precision);
+}
+
+String JSON::stringify(const Variant &p_var, const String &p_indent, bool p_sort_keys, bool p_full_precision) {
+	StringBuilder result;
+	stringify_to(result, p_var, p_indent, p_sort_keys, p_full_precision);
+	return result.as_string();
 }
 
 Variant JSON::parse_string(const String &p_json_string) {
@@ -609,6 +1126,7 @@ void JSON::_bind_methods() {
 	ClassDB::bind_static_method("JSON", D_METHOD("stringify", "data", "indent", "sort_keys", "full_precision"), &JSON::stringify, DEFVAL(""), DEFVAL(true), DEFVAL(false));
 	ClassDB::bind_static_method("JSON", D_METHOD("parse_string", "json_string"), &JSON::parse_string);
 	ClassDB::bind_method(D_METHOD("parse", "json_text", "keep_text"), &JSON::parse, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("parse_buffer", "json_buffer", "schema"), &JSON::parse_buffer, DEFVAL(Variant()));
 
 	ClassDB::bind_method(D_METHOD("get_data"), &JSON::get_data);
 	ClassDB::bind_method(D_METHOD("set_data", "data"), &JSON::set_data);
@@ -1533,7 +2051,13 @@ Ref<Resource> ResourceFormatLoaderJSON::load(const String &p_path, const String
 	Ref<JSON> json;
 	json.instantiate();
 
-	Error err = json->parse(FileAccess::get_file_as_string(p_path), Engine::get_singleton()->is_editor_hint());
+	Error err;
+	if (Engine::get_singleton()->is_editor_hint()) {
+		err = json->parse(FileAccess::get_file_as_string(p_path), true);
+	} else {
+		// The source text is not kept outside of the editor, so parse the file contents directly.
+		err = json->parse_buffer(FileAccess::get_file_as_bytes(p_path));
+	}
 	if (err != OK) {
 		String err_text = "Error parsing JSON file at '" + p_path + "', on line " + itos(json->get_error_line()) + ": " + json->get_error_message();
 
@@ -33,6 +33,7 @@
 #include "core/io/resource.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/string/string_builder.h"
 #include "core/variant/variant.h"
 
 class JSON : public Resource {
@@ -71,13 +72,14 @@ class JSON : public Resource {
 
 	static const char *tk_name[];
 
-	static void _add_indent(String &r_result, const String &p_indent, int p_size);
-	static void _stringify(String &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
+	static void _add_indent(StringBuilder &r_result, const String &p_indent, int p_size);
+	static void _stringify(StringBuilder &r_result, const Variant &p_var, const String &p_indent, int p_cur_indent, bool p_sort_keys, HashSet<const void *> &p_markers, bool p_full_precision);
 	static Error _get_token(const char32_t *p_str, int &index, int p_len, Token &r_token, int &line, String &r_err_str);
 	static Error _parse_value(Variant &value, Token &token, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_array(Array &array, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_object(Dictionary &object, const char32_t *p_str, int &index, int p_len, int &line, int p_depth, String &r_err_str);
 	static Error _parse_string(const String &p_json, Variant &r_ret, String &r_err_str, int &r_err_line);
+	static Error _parse_buffer(const uint8_t *p_buffer, int64_t p_len, const Variant &p_schema, Variant &r_ret, String &r_err_str, int &r_err_line);
 
 	static Variant _from_native(const Variant &p_variant, bool p_full_objects, int p_depth);
 	static Variant _to_native(const Variant &p_json, bool p_allow_objects, int p_depth);
@@ -87,8 +89,10 @@ protected:
 
 public:
 	Error parse(const String &p_json_string, bool p_keep_text = false);
+	Error parse_buffer(const PackedByteArray &p_json_buffer, const Variant &p_schema = Variant());
 	String get_parsed_text() const;
 
+	static void stringify_to(StringBuilder &r_builder, const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static String stringify(const Variant &p_var, const String &p_indent = "", bool p_sort_keys = true, bool p_full_precision = false);
 	static Variant parse_string(const String &p_json_string);
 
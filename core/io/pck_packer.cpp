@@ -33,9 +33,12 @@
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
 #include "core/io/file_access_encrypted.h"
+#include "core/io/compression.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/version.h"
 
+#include <zstd.h>
+
 static int _get_pad(int p_alignment, int p_n) {
 	int rest = p_n % p_alignment;
 	int pad = 0;
@@ -51,6 +54,31 @@ void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
+
+	ClassDB::bind_method(D_METHOD("set_compress_files", "enabled"), &PCKPacker::set_compress_files);
+	ClassDB::bind_method(D_METHOD("is_compress_files"), &PCKPacker::is_compress_files);
+	ClassDB::bind_method(D_METHOD("set_compression_dictionary_size", "size"), &PCKPacker::set_compression_dictionary_size);
+	ClassDB::bind_method(D_METHOD("get_compression_dictionary_size"), &PCKPacker::get_compression_dictionary_size);
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "compress_files"), "set_compress_files", "is_compress_files");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "compression_dictionary_size", PROPERTY_HINT_RANGE, "0,1048576,1,suffix:B"), "set_compression_dictionary_size", "get_compression_dictionary_size");
+}
+
+void PCKPacker::set_compress_files(bool p_enabled) {
+	compress_files = p_enabled;
+}
+
+bool PCKPacker::is_compress_files() const {
+	return compress_files;
+}
+
+void PCKPacker::set_compression_dictionary_size(int p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	compression_dictionary_size = p_size;
+}
+
+int PCKPacker::get_compression_dictionary_size() const {
+	return compression_dictionary_size;
 }
 
 Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const String &p_key, bool p_encrypt_directory) {
@@ -95,10 +123,11 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	file->store_32(GODOT_VERSION_MINOR);
 	file->store_32(GODOT_VERSION_PATCH);
 
-	uint32_t pack_flags = PACK_REL_FILEBASE;
+	pack_flags = PACK_REL_FILEBASE;
 	if (enc_dir) {
 		pack_flags |= PACK_DIR_ENCRYPTED;
 	}
+	pack_flags_ofs = file->get_position();
 	file->store_32(pack_flags); // flags
 
 	file_base_ofs = file->get_position();
@@ -172,6 +201,13 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 	}
 	pf.encrypted = p_encrypt;
 
+	if (compress_files && !p_encrypt) {
+		// Compressed files are written on flush, once the dictionary shared by all of them is known.
+		pf.compressed = true;
+		files.push_back(pf);
+		return OK;
+	}
+
 	Ref<FileAccess> ftmp = file;
 
 	Ref<FileAccessEncrypted> fae;
@@ -201,9 +237,143 @@ Error PCKPacker::add_file(const String &p_target_path, const String &p_source_pa
 	return OK;
 }
 
+Error PCKPacker::_store_compressed_files() {
+	LocalVector<int> compressed_files;
+	for (int i = 0; i < files.size(); i++) {
+		if (files[i].compressed) {
+			compressed_files.push_back(i);
+		}
+	}
+	if (compressed_files.is_empty()) {
+		return OK;
+	}
+
+	// Build a raw content dictionary out of the beginning of every file. Small files, which compress
+	// poorly on their own, share most of their headers and structure with the other files of the pack.
+	Vector<uint8_t> dictionary;
+	if (compression_dictionary_size > 0) {
+		const int64_t sample_size = MAX(256, compression_dictionary_size / (int)compressed_files.size());
+		for (int index : compressed_files) {
+			const int64_t dictionary_pos = dictionary.size();
+			if (dictionary_pos >= compression_dictionary_size) {
+				break;
+			}
+			Ref<FileAccess> f = FileAccess::open(files[index].src_path, FileAccess::READ);
+			ERR_FAIL_COND_V_MSG(f.is_null(), ERR_FILE_CANT_OPEN, vformat("Can't open file to read: '%s'.", files[index].src_path));
+			const int64_t to_read = MIN(MIN(sample_size, (int64_t)f->get_length()), compression_dictionary_size - dictionary_pos);
+			dictionary.resize(dictionary_pos + to_read);
+			f->get_buffer(dictionary.ptrw() + dictionary_pos, to_read);
+		}
+	}
+
+	uint64_t dictionary_ofs = file->get_position();
+	file->store_buffer(dictionary);
+	int pad = _get_pad(alignment, file->get_position());
+	for (int i = 0; i < pad; i++) {
+		file->store_8(0);
+	}
+
+	ZSTD_CCtx *cctx = ZSTD_createCCtx();
+	ERR_FAIL_NULL_V(cctx, ERR_OUT_OF_MEMORY);
+	ZSTD_CDict *cdict = nullptr;
+	if (!dictionary.is_empty()) {
+		cdict = ZSTD_createCDict(dictionary.ptr(), dictionary.size(), Compression::zstd_level);
+	}
+
+	Error err = OK;
+	LocalVector<uint8_t> frames;
+	LocalVector<uint64_t> frame_offsets;
+	for (int index : compressed_files) {
+		File &pf = files.write[index];
+		Vector<uint8_t> data = FileAccess::get_file_as_bytes(pf.src_path);
+		if ((uint64_t)data.size() != pf.size) {
+			ERR_PRINT(vformat("File changed while packing: '%s'.", pf.src_path));
+			err = ERR_FILE_CORRUPT;
+			break;
+		}
+
+		// Every frame is compressed on its own, so random access only needs to decompress one frame.
+		const uint32_t frame_count = (pf.size + PACK_COMPRESSED_FRAME_SIZE - 1) / PACK_COMPRESSED_FRAME_SIZE;
+		frames.clear();
+		frame_offsets.clear();
+		for (uint32_t i = 0; i < frame_count && err == OK; i++) {
+			const uint64_t frame_start = (uint64_t)i * PACK_COMPRESSED_FRAME_SIZE;
+			const size_t frame_size = MIN((uint64_t)PACK_COMPRESSED_FRAME_SIZE, pf.size - frame_start);
+			const uint64_t frames_size = frames.size();
+			frames.resize(frames_size + ZSTD_compressBound(frame_size));
+
+			size_t ret;
+			if (cdict) {
+				ret = ZSTD_compress_usingCDict(cctx, frames.ptr() + frames_size, frames.size() - frames_size, data.ptr() + frame_start, frame_size, cdict);
+			} else {
+				ret = ZSTD_compressCCtx(cctx, frames.ptr() + frames_size, frames.size() - frames_size, data.ptr() + frame_start, frame_size, Compression::zstd_level);
+			}
+			if (ZSTD_isError(ret)) {
+				ERR_PRINT(vformat("Can't compress file: '%s'.", pf.src_path));
+				err = ERR_CANT_CREATE;
+				break;
+			}
+			frames.resize(frames_size + ret);
+			frame_offsets.push_back(frames_size);
+		}
+		if (err != OK) {
+			break;
+		}
+		frame_offsets.push_back(frames.size());
+
+		pf.ofs = file->get_position();
+
+		const uint64_t compressed_size = 8 + frame_offsets.size() * 8 + frames.size();
+		if (compressed_size < pf.size) {
+			file->store_32(PACK_COMPRESSED_FRAME_SIZE);
+			file->store_32(frame_count);
+			for (uint64_t frame_offset : frame_offsets) {
+				file->store_64(frame_offset);
+			}
+			file->store_buffer(frames.ptr(), frames.size());
+		} else {
+			// Not worth it, store the file as is.
+			pf.compressed = false;
+			file->store_buffer(data);
+		}
+
+		pad = _get_pad(alignment, file->get_position());
+		for (int j = 0; j < pad; j++) {
+			file->store_8(0);
+		}
+	}
+
+	if (cdict) {
+		ZSTD_freeCDict(cdict);
+	}
+	ZSTD_freeCCtx(cctx);
+
+	if (err != OK) {
+		return err;
+	}
+
+	// Point the reserved header fields to the dictionary.
+	const uint64_t end = file->get_position();
+	pack_flags |= PACK_COMPRESSED_FILES;
+	file->seek(pack_flags_ofs);
+	file->store_32(pack_flags);
+	file->seek(dir_base_ofs + 8);
+	file->store_64(dictionary_ofs);
+	file->store_64(dictionary.size());
+	file->seek(end);
+
+	return OK;
+}
+
 Error PCKPacker::flush(bool p_verbose) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
+	Error err = _store_compressed_files();
+	if (err != OK) {
+		file.unref();
+		return err;
+	}
+
 	int dir_padding = _get_pad(alignment, file->get_position());
 	for (int i = 0; i < dir_padding; i++) {
 		file->store_8(0);
@@ -224,7 +394,7 @@ Error PCKPacker::flush(bool p_verbose) {
 		fae.instantiate();
 		ERR_FAIL_COND_V(fae.is_null(), ERR_CANT_CREATE);
 
-		Error err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
+		err = fae->open_and_parse(file, key, FileAccessEncrypted::MODE_WRITE_AES256, false);
 		ERR_FAIL_COND_V(err != OK, ERR_CANT_CREATE);
 
 		fhead = fae;
@@ -253,6 +423,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 
 		if (p_verbose) {
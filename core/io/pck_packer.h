@@ -43,6 +43,11 @@ class PCKPacker : public RefCounted {
 	Vector<uint8_t> key;
 	bool enc_dir = false;
 
+	bool compress_files = false;
+	int compression_dictionary_size = 65536;
+
+	uint32_t pack_flags = 0;
+	uint64_t pack_flags_ofs = 0;
 	uint64_t file_base = 0;
 	uint64_t file_base_ofs = 0;
 	uint64_t dir_base_ofs = 0;
@@ -56,16 +61,25 @@ class PCKPacker : public RefCounted {
 		uint64_t size = 0;
 		bool encrypted = false;
 		bool removal = false;
+		bool compressed = false;
 		Vector<uint8_t> md5;
 	};
 	Vector<File> files;
 
+	Error _store_compressed_files();
+
 public:
 	Error pck_start(const String &p_pck_path, int p_alignment = 32, const String &p_key = "0000000000000000000000000000000000000000000000000000000000000000", bool p_encrypt_directory = false);
 	Error add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt = false);
 	Error add_file_removal(const String &p_target_path);
 	Error flush(bool p_verbose = false);
 
+	void set_compress_files(bool p_enabled);
+	bool is_compress_files() const;
+
+	void set_compression_dictionary_size(int p_size);
+	int get_compression_dictionary_size() const;
+
 	PCKPacker() {}
 	~PCKPacker();
 };
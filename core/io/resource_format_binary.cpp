@@ -33,8 +33,10 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/property_utils.h"
 #include "scene/resources/packed_scene.h"
@@ -95,11 +97,18 @@ enum {
 	// Version 4: New string ID for ext/subresources, breaks forward compat.
 	// Version 5: Ability to store script class in the header.
 	// Version 6: Added PackedVector4Array Variant type.
-	FORMAT_VERSION = 6,
+	// Version 7: Property table with the size of every property value, stored before the values.
+	//            Only written with ResourceSaver::FLAG_BINARY_PROPERTY_TABLE, so older versions can still read the files.
+	FORMAT_VERSION = 7,
 	FORMAT_VERSION_CAN_RENAME_DEPS = 1,
 	FORMAT_VERSION_NO_NODEPATH_PROPERTY = 3,
+	FORMAT_VERSION_NO_PROPERTY_TABLE = 6,
+	FORMAT_VERSION_PROPERTY_TABLE = 7,
 };
 
+// Property values at least this large are parsed as separate tasks when loading with sub-threads.
+static constexpr uint64_t PARALLEL_PARSE_PROPERTY_SIZE = 64 * 1024;
+
 void ResourceLoaderBinary::_advance_padding(uint32_t p_len) {
 	uint32_t extra = 4 - (p_len % 4);
 	if (extra < 4) {
@@ -445,6 +454,11 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 					if (erindex < 0 || erindex >= external_resources.size()) {
 						WARN_PRINT("Broken external resource! (index out of size)");
 						r_v = Variant();
+					} else if (external_resources_resolved) {
+						// Already waited for and reported in _resolve_external_resources().
+						if (external_resources[erindex].resource.is_valid()) {
+							r_v = external_resources[erindex].resource;
+						}
 					} else {
 						Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[erindex].load_token;
 						if (load_token.is_valid()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
@@ -678,224 +692,523 @@ Ref<Resource> ResourceLoaderBinary::get_resource() {
 	return resource;
 }
 
-Error ResourceLoaderBinary::load() {
-	if (error != OK) {
-		return error;
-	}
+Error ResourceLoaderBinary::_create_internal_resource(int p_index, IntResourceLoad &r_load) {
+	bool main = p_index == (internal_resources.size() - 1);
+	r_load.main = main;
 
-	for (int i = 0; i < external_resources.size(); i++) {
-		String path = external_resources[i].path;
+	//maybe it is loaded already
+	String path;
+	String id;
 
-		if (remaps.has(path)) {
-			path = remaps[path];
-		}
+	if (!main) {
+		path = internal_resources[p_index].path;
 
-		if (!path.contains("://") && path.is_relative_path()) {
-			// path is relative to file being loaded, so convert to a resource path
-			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		if (path.begins_with("local://")) {
+			path = path.replace_first("local://", "");
+			id = path;
+			path = res_path + "::" + path;
+
+			internal_resources.write[p_index].path = path; // Update path.
 		}
 
-		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
-		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
-		if (external_resources[i].load_token.is_null()) {
-			if (!ResourceLoader::get_abort_on_missing_resources()) {
-				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
-			} else {
-				error = ERR_FILE_MISSING_DEPENDENCIES;
-				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached.is_valid()) {
+				//already loaded, don't do anything
+				error = OK;
+				internal_index_cache[path] = cached;
+				r_load.cached = true;
+				return OK;
 			}
 		}
+	} else {
+		if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
+			path = res_path;
+		}
 	}
 
-	for (int i = 0; i < internal_resources.size(); i++) {
-		bool main = i == (internal_resources.size() - 1);
+	uint64_t offset = internal_resources[p_index].offset;
+
+	f->seek(offset);
 
-		//maybe it is loaded already
-		String path;
-		String id;
+	String t = get_unicode_string();
 
-		if (!main) {
-			path = internal_resources[i].path;
+	Ref<Resource> res;
+	Resource *r = nullptr;
 
-			if (path.begins_with("local://")) {
-				path = path.replace_first("local://", "");
-				id = path;
-				path = res_path + "::" + path;
+	MissingResource *missing_resource = nullptr;
 
-				internal_resources.write[i].path = path; // Update path.
+	if (main) {
+		res = ResourceLoader::get_resource_ref_override(local_path);
+		r = res.ptr();
+	}
+	if (!r) {
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
+			//use the existing one
+			Ref<Resource> cached = ResourceCache::get_ref(path);
+			if (cached->get_class() == t) {
+				cached->reset_state();
+				res = cached;
 			}
+		}
 
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE && ResourceCache::has(path)) {
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached.is_valid()) {
-					//already loaded, don't do anything
-					error = OK;
-					internal_index_cache[path] = cached;
-					continue;
+		if (res.is_null()) {
+			//did not replace
+
+			Object *obj = ClassDB::instantiate(t);
+			if (!obj) {
+				if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+					//create a missing resource
+					missing_resource = memnew(MissingResource);
+					missing_resource->set_original_class(t);
+					missing_resource->set_recording_properties(true);
+					obj = missing_resource;
+				} else {
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
 				}
 			}
-		} else {
-			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE && !ResourceCache::has(res_path)) {
-				path = res_path;
+
+			r = Object::cast_to<Resource>(obj);
+			if (!r) {
+				String obj_class = obj->get_class();
+				error = ERR_FILE_CORRUPT;
+				memdelete(obj); //bye
+				ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
 			}
+
+			res = Ref<Resource>(r);
 		}
+	}
+
+	if (r) {
+		if (!path.is_empty()) {
+			if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
+				r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
+			} else {
+				r->set_path_cache(path);
+			}
+		}
+		r->set_scene_unique_id(id);
+	}
 
-		uint64_t offset = internal_resources[i].offset;
+	if (!main) {
+		internal_index_cache[path] = res;
+	}
 
-		f->seek(offset);
+	r_load.resource = res;
+	r_load.missing_resource = missing_resource;
+	r_load.properties_offset = f->get_position();
+	return OK;
+}
 
-		String t = get_unicode_string();
+Error ResourceLoaderBinary::_read_internal_resource_property_table(IntResourceLoad &r_load) {
+	f->seek(r_load.properties_offset);
+
+	const uint32_t pc = f->get_32();
+	if (pc > (f->get_length() - f->get_position()) / 8) {
+		error = ERR_FILE_CORRUPT;
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Invalid property count in resource.", local_path));
+	}
 
-		Ref<Resource> res;
-		Resource *r = nullptr;
+	r_load.properties.resize(pc);
+	r_load.property_offsets.resize(pc + 1);
 
-		MissingResource *missing_resource = nullptr;
+	for (uint32_t j = 0; j < pc; j++) {
+		StringName name = _get_string();
 
-		if (main) {
-			res = ResourceLoader::get_resource_ref_override(local_path);
-			r = res.ptr();
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
 		}
-		if (!r) {
-			if (cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE && ResourceCache::has(path)) {
-				//use the existing one
-				Ref<Resource> cached = ResourceCache::get_ref(path);
-				if (cached->get_class() == t) {
-					cached->reset_state();
-					res = cached;
-				}
-			}
 
-			if (res.is_null()) {
-				//did not replace
+		r_load.properties[j].first = name;
+		r_load.property_offsets[j + 1] = f->get_32(); // Size of the value, turned into an offset below.
+	}
 
-				Object *obj = ClassDB::instantiate(t);
-				if (!obj) {
-					if (ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-						//create a missing resource
-						missing_resource = memnew(MissingResource);
-						missing_resource->set_original_class(t);
-						missing_resource->set_recording_properties(true);
-						obj = missing_resource;
-					} else {
-						error = ERR_FILE_CORRUPT;
-						ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource of unrecognized type in file: '%s'.", local_path, t));
-					}
-				}
+	r_load.property_offsets[0] = f->get_position();
+	for (uint32_t j = 0; j < pc; j++) {
+		r_load.property_offsets[j + 1] += r_load.property_offsets[j];
+	}
 
-				r = Object::cast_to<Resource>(obj);
-				if (!r) {
-					String obj_class = obj->get_class();
-					error = ERR_FILE_CORRUPT;
-					memdelete(obj); //bye
-					ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Resource type in resource field not a resource, type is: %s.", local_path, obj_class));
-				}
+	if (r_load.property_offsets[pc] > f->get_length()) {
+		error = ERR_FILE_CORRUPT;
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Property values extend past the end of the file.", local_path));
+	}
 
-				res = Ref<Resource>(r);
-			}
+	return OK;
+}
+
+Error ResourceLoaderBinary::_parse_internal_resource_property(IntResourceLoad &r_load, uint32_t p_index) {
+	f->seek(r_load.property_offsets[p_index]);
+
+	error = parse_variant(r_load.properties[p_index].second);
+	if (error) {
+		return error;
+	}
+
+	if (f->get_position() != r_load.property_offsets[p_index + 1]) {
+		error = ERR_FILE_CORRUPT;
+		ERR_FAIL_V_MSG(ERR_FILE_CORRUPT, vformat("'%s': Size mismatch in the value of property '%s'.", local_path, r_load.properties[p_index].first));
+	}
+
+	return OK;
+}
+
+Error ResourceLoaderBinary::_parse_internal_resource_properties(IntResourceLoad &r_load) {
+	if (ver_format >= FORMAT_VERSION_PROPERTY_TABLE) {
+		error = _read_internal_resource_property_table(r_load);
+		if (error) {
+			return error;
 		}
 
-		if (r) {
-			if (!path.is_empty()) {
-				if (cache_mode != ResourceFormatLoader::CACHE_MODE_IGNORE) {
-					r->set_path(path, cache_mode == ResourceFormatLoader::CACHE_MODE_REPLACE); // If got here because the resource with same path has different type, replace it.
-				} else {
-					r->set_path_cache(path);
-				}
+		for (uint32_t j = 0; j < r_load.properties.size(); j++) {
+			error = _parse_internal_resource_property(r_load, j);
+			if (error) {
+				return error;
 			}
-			r->set_scene_unique_id(id);
 		}
 
-		if (!main) {
-			internal_index_cache[path] = res;
+		return OK;
+	}
+
+	f->seek(r_load.properties_offset);
+
+	int pc = f->get_32();
+
+	for (int j = 0; j < pc; j++) {
+		StringName name = _get_string();
+
+		if (name == StringName()) {
+			error = ERR_FILE_CORRUPT;
+			ERR_FAIL_V(ERR_FILE_CORRUPT);
 		}
 
-		int pc = f->get_32();
+		Variant value;
 
-		//set properties
+		error = parse_variant(value);
+		if (error) {
+			return error;
+		}
 
-		Dictionary missing_resource_properties;
+		r_load.properties.push_back(Pair<StringName, Variant>(name, value));
+	}
 
-		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+	return OK;
+}
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+void ResourceLoaderBinary::_set_internal_resource_properties(IntResourceLoad &r_load) {
+	Ref<Resource> &res = r_load.resource;
 
-			Variant value;
+	//set properties
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
-			}
+	Dictionary missing_resource_properties;
 
-			bool set_valid = true;
-			if (value.get_type() == Variant::OBJECT && missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
-				// If the property being set is a missing resource (and the parent is not),
-				// then setting it will most likely not work.
-				// Instead, save it as metadata.
+	for (Pair<StringName, Variant> &property : r_load.properties) {
+		const StringName &name = property.first;
+		Variant &value = property.second;
 
-				Ref<MissingResource> mr = value;
-				if (mr.is_valid()) {
-					missing_resource_properties[name] = mr;
-					set_valid = false;
-				}
+		bool set_valid = true;
+		if (value.get_type() == Variant::OBJECT && r_load.missing_resource == nullptr && ResourceLoader::is_creating_missing_resources_if_class_unavailable_enabled()) {
+			// If the property being set is a missing resource (and the parent is not),
+			// then setting it will most likely not work.
+			// Instead, save it as metadata.
+
+			Ref<MissingResource> mr = value;
+			if (mr.is_valid()) {
+				missing_resource_properties[name] = mr;
+				set_valid = false;
 			}
+		}
 
-			if (value.get_type() == Variant::ARRAY) {
-				Array set_array = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
-					Array get_array = get_value;
-					if (!set_array.is_same_typed(get_array)) {
-						value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
-					}
+		if (value.get_type() == Variant::ARRAY) {
+			Array set_array = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::ARRAY) {
+				Array get_array = get_value;
+				if (!set_array.is_same_typed(get_array)) {
+					value = Array(set_array, get_array.get_typed_builtin(), get_array.get_typed_class_name(), get_array.get_typed_script());
 				}
 			}
+		}
 
-			if (value.get_type() == Variant::DICTIONARY) {
-				Dictionary set_dict = value;
-				bool is_get_valid = false;
-				Variant get_value = res->get(name, &is_get_valid);
-				if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
-					Dictionary get_dict = get_value;
-					if (!set_dict.is_same_typed(get_dict)) {
-						value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
-								get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
-					}
+		if (value.get_type() == Variant::DICTIONARY) {
+			Dictionary set_dict = value;
+			bool is_get_valid = false;
+			Variant get_value = res->get(name, &is_get_valid);
+			if (is_get_valid && get_value.get_type() == Variant::DICTIONARY) {
+				Dictionary get_dict = get_value;
+				if (!set_dict.is_same_typed(get_dict)) {
+					value = Dictionary(set_dict, get_dict.get_typed_key_builtin(), get_dict.get_typed_key_class_name(), get_dict.get_typed_key_script(),
+							get_dict.get_typed_value_builtin(), get_dict.get_typed_value_class_name(), get_dict.get_typed_value_script());
 				}
 			}
+		}
+
+		if (set_valid) {
+			res->set(name, value);
+		}
+	}
+	r_load.properties.clear();
+
+	if (r_load.missing_resource) {
+		r_load.missing_resource->set_recording_properties(false);
+	}
+
+	if (!missing_resource_properties.is_empty()) {
+		res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	}
+
+#ifdef TOOLS_ENABLED
+	res->set_edited(false);
+#endif
+}
+
+bool ResourceLoaderBinary::_finish_internal_resource(int p_index, IntResourceLoad &r_load) {
+	if (progress) {
+		*progress = (p_index + 1) / float(internal_resources.size());
+	}
+
+	resource_cache.push_back(r_load.resource);
+
+	if (r_load.main) {
+		f.unref();
+		resource = r_load.resource;
+		resource->set_as_translation_remapped(translation_remapped);
+		error = OK;
+		return true;
+	}
+	return false;
+}
+
+Error ResourceLoaderBinary::_resolve_external_resources() {
+	for (int i = 0; i < external_resources.size(); i++) {
+		Ref<ResourceLoader::LoadToken> &load_token = external_resources.write[i].load_token;
+		if (load_token.is_null()) { // If not valid, it's OK since then we know this load accepts broken dependencies.
+			continue;
+		}
 
-			if (set_valid) {
-				res->set(name, value);
+		Error err;
+		Ref<Resource> res = ResourceLoader::_load_complete(*load_token.ptr(), &err);
+		if (res.is_null()) {
+			if (!ResourceLoader::is_cleaning_tasks()) {
+				if (!ResourceLoader::get_abort_on_missing_resources()) {
+					ResourceLoader::notify_dependency_error(local_path, external_resources[i].path, external_resources[i].type);
+				} else {
+					error = ERR_FILE_MISSING_DEPENDENCIES;
+					ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", external_resources[i].path));
+				}
 			}
+		} else {
+			external_resources.write[i].resource = res;
+		}
+	}
+
+	external_resources_resolved = true;
+	return OK;
+}
+
+void ResourceLoaderBinary::_init_parse_worker(ResourceLoaderBinary &r_worker, const Span<uint8_t> &p_data) const {
+	Ref<FileAccessMemory> fam;
+	fam.instantiate();
+	fam->open_custom(p_data.ptr(), p_data.size());
+	fam->set_big_endian(f->is_big_endian());
+	fam->real_is_double = f->real_is_double;
+
+	r_worker.f = fam;
+	r_worker.local_path = local_path;
+	r_worker.res_path = res_path;
+	r_worker.ver_format = ver_format;
+	r_worker.using_named_scene_ids = using_named_scene_ids;
+	r_worker.string_map = string_map;
+	r_worker.external_resources = external_resources;
+	r_worker.external_resources_resolved = external_resources_resolved;
+	r_worker.internal_resources = internal_resources;
+	r_worker.internal_index_cache = internal_index_cache;
+	r_worker.remaps = remaps;
+	r_worker.cache_mode_for_external = cache_mode_for_external;
+}
+
+void ResourceLoaderBinary::_parse_internal_resource_task(void *p_userdata, uint32_t p_index) {
+	ParallelParse *parse = static_cast<ParallelParse *>(p_userdata);
+
+	// Every pool thread parses with its own copy of the lookup tables and its own cursor into the file data.
+	const int thread_index = WorkerThreadPool::get_singleton()->get_thread_index();
+	ResourceLoaderBinary *&worker = parse->workers[thread_index < 0 ? parse->workers.size() - 1 : thread_index];
+	if (!worker) {
+		worker = memnew(ResourceLoaderBinary);
+		parse->loader->_init_parse_worker(*worker, parse->data);
+	}
+
+	ParseItem &item = parse->items[p_index];
+	if (item.whole_resource) {
+		item.error = worker->_parse_internal_resource_properties(*item.load);
+		return;
+	}
+
+	for (uint32_t j = item.from; j < item.to; j++) {
+		item.error = worker->_parse_internal_resource_property(*item.load, j);
+		if (item.error) {
+			return;
 		}
+	}
+}
+
+Error ResourceLoaderBinary::_load_internal_resources_parallel(const Span<uint8_t> &p_data) {
+	// All external dependencies were started at once, wait for them here so the parsing tasks never block on them.
+	error = _resolve_external_resources();
+	if (error) {
+		return error;
+	}
 
-		if (missing_resource) {
-			missing_resource->set_recording_properties(false);
+	// Resources are created in order on this thread, so that references to other internal resources can be resolved while parsing.
+	LocalVector<IntResourceLoad> loads;
+	loads.resize(internal_resources.size());
+	for (int i = 0; i < internal_resources.size(); i++) {
+		error = _create_internal_resource(i, loads[i]);
+		if (error) {
+			return error;
 		}
+	}
 
-		if (!missing_resource_properties.is_empty()) {
-			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
+	ParallelParse parse;
+	parse.loader = this;
+	parse.data = p_data;
+	for (IntResourceLoad &res_load : loads) {
+		if (res_load.cached) {
+			continue;
 		}
 
-#ifdef TOOLS_ENABLED
-		res->set_edited(false);
-#endif
+		ParseItem item;
+		item.load = &res_load;
 
-		if (progress) {
-			*progress = (i + 1) / float(internal_resources.size());
+		if (ver_format < FORMAT_VERSION_PROPERTY_TABLE) {
+			item.whole_resource = true;
+			parse.items.push_back(item);
+			continue;
 		}
 
-		resource_cache.push_back(res);
+		error = _read_internal_resource_property_table(res_load);
+		if (error) {
+			return error;
+		}
 
-		if (main) {
-			f.unref();
-			resource = res;
-			resource->set_as_translation_remapped(translation_remapped);
-			error = OK;
+		// Large values get a task of their own, so a single big resource (e.g. a mesh) doesn't hold back the load.
+		const uint32_t pc = res_load.properties.size();
+		item.from = 0;
+		for (uint32_t j = 0; j < pc; j++) {
+			if (res_load.property_offsets[j + 1] - res_load.property_offsets[j] < PARALLEL_PARSE_PROPERTY_SIZE) {
+				continue;
+			}
+			if (item.from < j) {
+				item.to = j;
+				parse.items.push_back(item);
+			}
+			item.from = j;
+			item.to = j + 1;
+			parse.items.push_back(item);
+			item.from = j + 1;
+		}
+		if (item.from < pc) {
+			item.to = pc;
+			parse.items.push_back(item);
+		}
+	}
+	parse.workers.resize(WorkerThreadPool::get_singleton()->get_thread_count() + 1);
+	for (ResourceLoaderBinary *&worker : parse.workers) {
+		worker = nullptr;
+	}
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&ResourceLoaderBinary::_parse_internal_resource_task, &parse, parse.items.size(), -1, true, SNAME("ResourceLoaderBinaryParse"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	for (ResourceLoaderBinary *worker : parse.workers) {
+		if (worker) {
+			memdelete(worker);
+		}
+	}
+
+	for (const ParseItem &item : parse.items) {
+		if (item.error) {
+			error = item.error;
+			return error;
+		}
+	}
+
+	// Properties are set in file order, same as the serial path.
+	for (uint32_t i = 0; i < loads.size(); i++) {
+		IntResourceLoad &res_load = loads[i];
+		if (res_load.cached) {
+			continue;
+		}
+
+		_set_internal_resource_properties(res_load);
+		if (_finish_internal_resource(i, res_load)) {
+			return OK;
+		}
+	}
+
+	return ERR_FILE_EOF;
+}
+
+Error ResourceLoaderBinary::load() {
+	if (error != OK) {
+		return error;
+	}
+
+	for (int i = 0; i < external_resources.size(); i++) {
+		String path = external_resources[i].path;
+
+		if (remaps.has(path)) {
+			path = remaps[path];
+		}
+
+		if (!path.contains("://") && path.is_relative_path()) {
+			// path is relative to file being loaded, so convert to a resource path
+			path = ProjectSettings::get_singleton()->localize_path(path.get_base_dir().path_join(external_resources[i].path));
+		}
+
+		external_resources.write[i].path = path; //remap happens here, not on load because on load it can actually be used for filesystem dock resource remap
+		external_resources.write[i].load_token = ResourceLoader::_load_start(path, external_resources[i].type, use_sub_threads ? ResourceLoader::LOAD_THREAD_DISTRIBUTE : ResourceLoader::LOAD_THREAD_FROM_CURRENT, cache_mode_for_external);
+		if (external_resources[i].load_token.is_null()) {
+			if (!ResourceLoader::get_abort_on_missing_resources()) {
+				ResourceLoader::notify_dependency_error(local_path, path, external_resources[i].type);
+			} else {
+				error = ERR_FILE_MISSING_DEPENDENCIES;
+				ERR_FAIL_V_MSG(error, vformat("Can't load dependency: '%s'.", path));
+			}
+		}
+	}
+
+	// With sub-threads allowed, the internal resources are parsed in parallel when the whole file is available in memory.
+	if (use_sub_threads && internal_resources.size() > 2) {
+		const uint64_t position = f->get_position();
+		f->seek(0);
+		Span<uint8_t> data = f->get_buffer_mapped(f->get_length());
+		if (!data.is_empty()) {
+			return _load_internal_resources_parallel(data);
+		}
+		f->seek(position);
+	}
+
+	for (int i = 0; i < internal_resources.size(); i++) {
+		IntResourceLoad res_load;
+		error = _create_internal_resource(i, res_load);
+		if (error) {
+			return error;
+		}
+		if (res_load.cached) {
+			continue;
+		}
+
+		error = _parse_internal_resource_properties(res_load);
+		if (error) {
+			return error;
+		}
+
+		_set_internal_resource_properties(res_load);
+		if (_finish_internal_resource(i, res_load)) {
 			return OK;
 		}
 	}
@@ -983,6 +1296,20 @@ void ResourceLoaderBinary::open(Ref<FileAccess> p_f, bool p_no_resources, bool p
 	error = OK;
 
 	f = p_f;
+
+	// Parse from a mapping of the whole file when the backend supports it, so the many small reads
+	// done while parsing are plain copies out of the page cache instead of calls into the file backend.
+	if (!p_no_resources && f->get_position() == 0) {
+		Span<uint8_t> mapped = f->get_buffer_mapped(f->get_length());
+		if (!mapped.is_empty()) {
+			Ref<FileAccessMemory> fam;
+			fam.instantiate();
+			fam->open_custom(mapped.ptr(), mapped.size());
+			mapped_f = f;
+			f = fam;
+		}
+	}
+
 	uint8_t header[4];
 	f->get_buffer(header, 4);
 	if (header[0] == 'R' && header[1] == 'S' && header[2] == 'C' && header[3] == 'C') {
@@ -2179,6 +2506,7 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 	bundle_resources = p_flags & ResourceSaver::FLAG_BUNDLE_RESOURCES;
 	big_endian = p_flags & ResourceSaver::FLAG_SAVE_BIG_ENDIAN;
 	takeover_paths = p_flags & ResourceSaver::FLAG_REPLACE_SUBRESOURCE_PATHS;
+	property_table = p_flags & ResourceSaver::FLAG_BINARY_PROPERTY_TABLE;
 
 	if (!p_path.begins_with("res://")) {
 		takeover_paths = false;
@@ -2205,7 +2533,7 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 
 	f->store_32(GODOT_VERSION_MAJOR);
 	f->store_32(GODOT_VERSION_MINOR);
-	f->store_32(FORMAT_VERSION);
+	f->store_32(property_table ? FORMAT_VERSION_PROPERTY_TABLE : FORMAT_VERSION_NO_PROPERTY_TABLE);
 
 	if (f->get_error() != OK && f->get_error() != ERR_FILE_EOF) {
 		return ERR_CANT_CREATE;
@@ -2380,10 +2708,35 @@ Error ResourceFormatSaverBinaryInstance::save(const String &p_path, const Ref<Re
 		save_unicode_string(f, rd.type);
 		f->store_32(uint32_t(rd.properties.size()));
 
+		if (!property_table) {
+			for (const Property &p : rd.properties) {
+				f->store_32(uint32_t(p.name_idx));
+				write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+			}
+			continue;
+		}
+
+		// Property table, the value sizes are filled in once the values are written.
+		const uint64_t property_table_pos = f->get_position();
 		for (const Property &p : rd.properties) {
 			f->store_32(uint32_t(p.name_idx));
+			f->store_32(0);
+		}
+
+		LocalVector<uint32_t> value_sizes;
+		value_sizes.reserve(rd.properties.size());
+		for (const Property &p : rd.properties) {
+			const uint64_t value_pos = f->get_position();
 			write_variant(f, p.value, resource_map, external_resources, string_map, p.pi);
+			value_sizes.push_back(f->get_position() - value_pos);
+		}
+
+		const uint64_t end_pos = f->get_position();
+		for (uint32_t i = 0; i < value_sizes.size(); i++) {
+			f->seek(property_table_pos + i * 8 + 4);
+			f->store_32(value_sizes[i]);
 		}
+		f->seek(end_pos);
 	}
 
 	for (int i = 0; i < ofs_table.size(); i++) {
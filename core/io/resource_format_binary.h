@@ -33,6 +33,10 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
+
+class MissingResource;
 
 class ResourceLoaderBinary {
 	bool translation_remapped = false;
@@ -43,6 +47,7 @@ class ResourceLoaderBinary {
 	uint32_t ver_format = 0;
 
 	Ref<FileAccess> f;
+	Ref<FileAccess> mapped_f; // Keeps the mapping alive while f reads from it.
 
 	uint64_t importmd_ofs = 0;
 
@@ -60,6 +65,7 @@ class ResourceLoaderBinary {
 		String type;
 		ResourceUID::ID uid = ResourceUID::INVALID_ID;
 		Ref<ResourceLoader::LoadToken> load_token;
+		Ref<Resource> resource;
 	};
 
 	bool using_named_scene_ids = false;
@@ -68,6 +74,7 @@ class ResourceLoaderBinary {
 	bool use_sub_threads = false;
 	float *progress = nullptr;
 	Vector<ExtResource> external_resources;
+	bool external_resources_resolved = false;
 
 	struct IntResource {
 		String path;
@@ -90,6 +97,46 @@ class ResourceLoaderBinary {
 
 	Error parse_variant(Variant &r_v);
 
+	struct IntResourceLoad {
+		Ref<Resource> resource;
+		MissingResource *missing_resource = nullptr;
+		uint64_t properties_offset = 0;
+		bool main = false;
+		bool cached = false;
+		LocalVector<Pair<StringName, Variant>> properties;
+		// File offsets of the property values (plus the end of the last one), from the property table.
+		LocalVector<uint64_t> property_offsets;
+		Error error = OK;
+	};
+
+	struct ParseItem {
+		IntResourceLoad *load = nullptr;
+		// Range of properties to parse, or the whole resource for files without a property table.
+		uint32_t from = 0;
+		uint32_t to = 0;
+		bool whole_resource = false;
+		Error error = OK;
+	};
+
+	struct ParallelParse {
+		ResourceLoaderBinary *loader = nullptr;
+		Span<uint8_t> data;
+		LocalVector<ParseItem> items;
+		LocalVector<ResourceLoaderBinary *> workers;
+	};
+
+	Error _create_internal_resource(int p_index, IntResourceLoad &r_load);
+	Error _read_internal_resource_property_table(IntResourceLoad &r_load);
+	Error _parse_internal_resource_property(IntResourceLoad &r_load, uint32_t p_index);
+	Error _parse_internal_resource_properties(IntResourceLoad &r_load);
+	void _set_internal_resource_properties(IntResourceLoad &r_load);
+	bool _finish_internal_resource(int p_index, IntResourceLoad &r_load);
+
+	Error _resolve_external_resources();
+	void _init_parse_worker(ResourceLoaderBinary &r_worker, const Span<uint8_t> &p_data) const;
+	static void _parse_internal_resource_task(void *p_userdata, uint32_t p_index);
+	Error _load_internal_resources_parallel(const Span<uint8_t> &p_data);
+
 	HashMap<String, Ref<Resource>> dependency_cache;
 
 public:
@@ -131,6 +178,7 @@ class ResourceFormatSaverBinaryInstance {
 	bool skip_editor;
 	bool big_endian;
 	bool takeover_paths;
+	bool property_table;
 	String magic;
 	HashSet<Ref<Resource>> resource_set;
 
@@ -159,6 +159,10 @@ public:
 	virtual Error import_group_file(const String &p_group_file, const HashMap<String, HashMap<StringName, Variant>> &p_source_file_options, const HashMap<String, String> &p_base_paths) { return ERR_UNAVAILABLE; }
 	virtual bool are_import_settings_valid(const String &p_path, const Dictionary &p_meta) const { return true; }
 	virtual String get_import_settings_string() const { return String(); }
+	// Whether the result can be restored from the editor's shared import cache. Only return true if the
+	// result depends on nothing but the source file, the options and get_import_settings_string(), and
+	// the importer writes no files other than the save path (or one per platform variant).
+	virtual bool can_cache_import(const HashMap<StringName, Variant> &p_options) const { return false; }
 
 	virtual void get_build_dependencies(const String &p_path, HashSet<String> *r_build_dependencies);
 };
@@ -32,6 +32,7 @@
 
 #include "core/math/quaternion.h"
 #include "core/math/vector3.h"
+#include "core/templates/vector.h"
 
 struct [[nodiscard]] Basis {
 	Vector3 rows[3] = {
@@ -128,6 +129,8 @@ struct [[nodiscard]] Basis {
 
 	_FORCE_INLINE_ Vector3 xform(const Vector3 &p_vector) const;
 	_FORCE_INLINE_ Vector3 xform_inv(const Vector3 &p_vector) const;
+	_FORCE_INLINE_ Vector<Vector3> xform(const Vector<Vector3> &p_array) const;
+	_FORCE_INLINE_ Vector<Vector3> xform_inv(const Vector<Vector3> &p_array) const;
 	_FORCE_INLINE_ void operator*=(const Basis &p_matrix);
 	_FORCE_INLINE_ Basis operator*(const Basis &p_matrix) const;
 	constexpr void operator+=(const Basis &p_matrix);
@@ -339,6 +342,32 @@ Vector3 Basis::xform_inv(const Vector3 &p_vector) const {
 			(rows[0][2] * p_vector.x) + (rows[1][2] * p_vector.y) + (rows[2][2] * p_vector.z));
 }
 
+Vector<Vector3> Basis::xform(const Vector<Vector3> &p_array) const {
+	Vector<Vector3> array;
+	array.resize(p_array.size());
+
+	const Vector3 *r = p_array.ptr();
+	Vector3 *w = array.ptrw();
+
+	for (int i = 0; i < p_array.size(); ++i) {
+		w[i] = xform(r[i]);
+	}
+	return array;
+}
+
+Vector<Vector3> Basis::xform_inv(const Vector<Vector3> &p_array) const {
+	Vector<Vector3> array;
+	array.resize(p_array.size());
+
+	const Vector3 *r = p_array.ptr();
+	Vector3 *w = array.ptrw();
+
+	for (int i = 0; i < p_array.size(); ++i) {
+		w[i] = xform_inv(r[i]);
+	}
+	return array;
+}
+
 real_t Basis::determinant() const {
 	return rows[0][0] * (rows[1][1] * rows[2][2] - rows[2][1] * rows[1][2]) -
 			rows[1][0] * (rows[0][1] * rows[2][2] - rows[2][1] * rows[0][2]) +
@@ -1212,9 +1212,7 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
 
-	Callable *slot_callables = nullptr;
-	uint32_t *slot_flags = nullptr;
-	uint32_t slot_count = 0;
+	Vector<SignalData::EmitSlot> emit_slots;
 
 	{
 		OBJ_SIGNAL_LOCK
@@ -1236,28 +1234,24 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 		// Ensure that disconnecting the signal or even deleting the object
 		// will not affect the signal calling.
-		slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-		slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-
-		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-			slot_flags[slot_count] = slot_kv.value.conn.flags;
-			++slot_count;
+		if (s->emit_slots_dirty) {
+			s->update_emit_slots();
 		}
+		emit_slots = s->emit_slots;
 
-		DEV_ASSERT(slot_count == s->slot_map.size());
-
-		// Disconnect all one-shot connections before emitting to prevent recursion.
-		for (uint32_t i = 0; i < slot_count; ++i) {
-			bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		if (s->has_one_shot) {
+			// Disconnect all one-shot connections before emitting to prevent recursion.
+			for (const SignalData::EmitSlot &slot : std::as_const(emit_slots)) {
+				bool disconnect = slot.flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-			if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
-				// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
-				disconnect = false;
-			}
+				if (disconnect && (slot.flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+					// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
+					disconnect = false;
+				}
 #endif
-			if (disconnect) {
-				_disconnect(p_name, slot_callables[i]);
+				if (disconnect) {
+					_disconnect(p_name, slot.callable);
+				}
 			}
 		}
 	}
@@ -1266,9 +1260,9 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	Error err = OK;
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+	for (const SignalData::EmitSlot &slot : std::as_const(emit_slots)) {
+		const Callable &callable = slot.callable;
+		const uint32_t flags = slot.flags;
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
@@ -1304,11 +1298,23 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
+	return err;
+}
+
+void Object::SignalData::update_emit_slots() {
+	emit_slots.resize(slot_map.size());
+	EmitSlot *emit_slots_ptrw = emit_slots.ptrw();
+	has_one_shot = false;
+
+	uint32_t i = 0;
+	for (const KeyValue<Callable, Slot> &slot_kv : slot_map) {
+		emit_slots_ptrw[i].callable = slot_kv.value.conn.callable;
+		emit_slots_ptrw[i].flags = slot_kv.value.conn.flags;
+		has_one_shot = has_one_shot || (slot_kv.value.conn.flags & CONNECT_ONE_SHOT);
+		i++;
 	}
 
-	return err;
+	emit_slots_dirty = false;
 }
 
 void Object::_add_user_signal(const String &p_name, const Array &p_args) {
@@ -1533,6 +1539,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->invalidate_emit_slots();
 
 	return OK;
 }
@@ -1613,6 +1620,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->invalidate_emit_slots();
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2338,8 +2346,9 @@ void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 
 	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+		const ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.get_validator()) {
+			p_func(object_slot.object.load(std::memory_order_relaxed));
 			count--;
 		}
 	}
@@ -2394,8 +2403,8 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
+std::atomic<uint32_t> ObjectDB::slot_max = 0;
+ObjectDB::ObjectSlot *ObjectDB::object_slot_chunks[OBJECTDB_SLOT_CHUNK_COUNT] = {};
 uint64_t ObjectDB::validator_counter = 0;
 
 int ObjectDB::get_object_count() {
@@ -2404,32 +2413,35 @@ int ObjectDB::get_object_count() {
 
 ObjectID ObjectDB::add_instance(Object *p_object) {
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
+	uint32_t current_slot_max = slot_max.load(std::memory_order_relaxed);
+	if (unlikely(slot_count == current_slot_max)) {
 		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+		ObjectSlot *chunk = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_SLOT_CHUNK_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_SLOT_CHUNK_SIZE; i++) {
+			memnew_placement(&chunk[i], ObjectSlot);
+			chunk[i].object.store(nullptr, std::memory_order_relaxed);
+			chunk[i].set_data(0, current_slot_max + i, false);
 		}
-		slot_max = new_slot_max;
+		object_slot_chunks[current_slot_max >> OBJECTDB_SLOT_CHUNK_BITS] = chunk;
+		// Publish the chunk to the lock-free readers.
+		slot_max.store(current_slot_max + OBJECTDB_SLOT_CHUNK_SIZE, std::memory_order_release);
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	uint32_t slot = _get_slot(slot_count).get_next_free();
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+		ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
 	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
 	if (unlikely(validator_counter == 0)) {
 		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
+
+	// The object must be visible before the validator that makes lookups succeed.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.set_data(validator_counter, object_slot.get_next_free(), p_object->is_ref_counted());
 
 	uint64_t id = validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
@@ -2452,17 +2464,19 @@ void ObjectDB::remove_instance(Object *p_object) {
 
 	spin_lock.lock();
 
+	ObjectSlot &object_slot = _get_slot(slot);
+
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
+		if (object_slot.get_validator() != validator) {
 			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+			ERR_FAIL_COND(object_slot.get_validator() != validator);
 		}
 	}
 
@@ -2470,11 +2484,11 @@ void ObjectDB::remove_instance(Object *p_object) {
 	//decrease slot count
 	slot_count--;
 	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	ObjectSlot &free_slot = _get_slot(slot_count);
+	free_slot.set_data(free_slot.get_validator(), slot, free_slot.is_ref_counted());
+	//invalidate, so checks against it fail; this has to happen before the object is cleared for lock-free lookups
+	object_slot.set_data(0, object_slot.get_next_free(), false);
+	object_slot.object.store(nullptr, std::memory_order_release);
 
 	spin_lock.unlock();
 }
@@ -2497,8 +2511,9 @@ void ObjectDB::cleanup() {
 			Callable::CallError call_error;
 
 			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+				const ObjectSlot &object_slot = _get_slot(i);
+				if (object_slot.get_validator()) {
+					Object *obj = object_slot.object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2508,7 +2523,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | (object_slot.get_validator() << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slot.is_ref_counted() ? OBJECTDB_REFERENCE_BIT : 0);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2519,9 +2534,13 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < OBJECTDB_SLOT_CHUNK_COUNT; i++) {
+		if (object_slot_chunks[i]) {
+			memfree(object_slot_chunks[i]);
+			object_slot_chunks[i] = nullptr;
+		}
 	}
+	slot_max.store(0, std::memory_order_relaxed);
 
 	spin_lock.unlock();
 }
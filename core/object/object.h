@@ -617,9 +617,26 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		struct EmitSlot {
+			Callable callable;
+			uint32_t flags = 0;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// Contiguous copy of the connections in `slot_map`, rebuilt on the first emission after they change.
+		// Emitting only takes a copy-on-write reference to it, so connecting or disconnecting while emitting is safe.
+		Vector<EmitSlot> emit_slots;
+		bool emit_slots_dirty = true;
+		bool has_one_shot = false;
 		bool removable = false;
+
+		void update_emit_slots();
+		_FORCE_INLINE_ void invalidate_emit_slots() {
+			// Release the stale callables right away, ongoing emissions keep their own reference.
+			emit_slots.clear();
+			emit_slots_dirty = true;
+		}
 	};
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
@@ -1022,19 +1039,35 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
 
+	// Slots are allocated in chunks that never move or get freed while running, so they can be read without locking.
+#define OBJECTDB_SLOT_CHUNK_BITS 12
+#define OBJECTDB_SLOT_CHUNK_SIZE (uint32_t(1) << OBJECTDB_SLOT_CHUNK_BITS)
+#define OBJECTDB_SLOT_CHUNK_MASK (OBJECTDB_SLOT_CHUNK_SIZE - 1)
+#define OBJECTDB_SLOT_CHUNK_COUNT (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_CHUNK_BITS))
+
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// Validator in the lower OBJECTDB_VALIDATOR_BITS, followed by the next free slot and the reference bit.
+		std::atomic<uint64_t> data;
+		std::atomic<Object *> object;
+
+		_FORCE_INLINE_ uint64_t get_validator(std::memory_order p_order = std::memory_order_relaxed) const { return data.load(p_order) & OBJECTDB_VALIDATOR_MASK; }
+		_FORCE_INLINE_ uint32_t get_next_free() const { return (data.load(std::memory_order_relaxed) >> OBJECTDB_VALIDATOR_BITS) & OBJECTDB_SLOT_MAX_COUNT_MASK; }
+		_FORCE_INLINE_ bool is_ref_counted() const { return data.load(std::memory_order_relaxed) & OBJECTDB_REFERENCE_BIT; }
+		_FORCE_INLINE_ void set_data(uint64_t p_validator, uint32_t p_next_free, bool p_ref_counted) {
+			data.store(p_validator | (uint64_t(p_next_free) << OBJECTDB_VALIDATOR_BITS) | (p_ref_counted ? OBJECTDB_REFERENCE_BIT : 0), std::memory_order_release);
+		}
 	};
 
 	static SpinLock spin_lock;
 	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
+	static std::atomic<uint32_t> slot_max;
+	static ObjectSlot *object_slot_chunks[OBJECTDB_SLOT_CHUNK_COUNT];
 	static uint64_t validator_counter;
 
+	_FORCE_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return object_slot_chunks[p_slot >> OBJECTDB_SLOT_CHUNK_BITS][p_slot & OBJECTDB_SLOT_CHUNK_MASK];
+	}
+
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
@@ -1052,20 +1085,22 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ERR_FAIL_COND_V(slot >= slot_max.load(std::memory_order_acquire), nullptr); // This should never happen unless RID is corrupted.
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		const ObjectSlot &object_slot = _get_slot(slot);
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		// No lock needed: an object is stored before its validator, and the validator is cleared before the object.
+		// If the validator matches both before and after reading the object, the object was alive in between.
+		if (unlikely(object_slot.get_validator(std::memory_order_acquire) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		if (unlikely(object_slot.get_validator(std::memory_order_relaxed) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
@@ -30,9 +30,11 @@
 
 #include "memory.h"
 
+#include "core/os/thread_cache_allocator.h"
 #include "core/templates/safe_refcount.h"
 
 #include <cstdlib>
+#include <cstring>
 
 void *operator new(size_t p_size, const char *p_description) {
 	return Memory::alloc_static(p_size, false);
@@ -61,6 +63,41 @@ SafeNumeric<uint64_t> Memory::mem_usage;
 SafeNumeric<uint64_t> Memory::max_usage;
 #endif
 
+#if defined(DEBUG_ENABLED) || defined(THREAD_CACHE_ALLOCATOR_ENABLED)
+// The thread cache allocator needs the size of a block to free it, so it's always stored in the header.
+#define MEMORY_ALWAYS_PREPAD
+#endif
+
+// Blocks with a header, allocated through the thread cache allocator if enabled.
+
+static _FORCE_INLINE_ void *_alloc_block(size_t p_bytes, bool p_ensure_zero) {
+#ifdef THREAD_CACHE_ALLOCATOR_ENABLED
+	void *mem = ThreadCacheAllocator::alloc(p_bytes);
+	if (p_ensure_zero && mem) {
+		memset(mem, 0, p_bytes);
+	}
+	return mem;
+#else
+	return p_ensure_zero ? calloc(1, p_bytes) : malloc(p_bytes);
+#endif
+}
+
+static _FORCE_INLINE_ void *_realloc_block(void *p_memory, size_t p_prev_bytes, size_t p_bytes) {
+#ifdef THREAD_CACHE_ALLOCATOR_ENABLED
+	return ThreadCacheAllocator::realloc(p_memory, p_prev_bytes, p_bytes);
+#else
+	return realloc(p_memory, p_bytes);
+#endif
+}
+
+static _FORCE_INLINE_ void _free_block(void *p_memory, size_t p_bytes) {
+#ifdef THREAD_CACHE_ALLOCATOR_ENABLED
+	ThreadCacheAllocator::free(p_memory, p_bytes);
+#else
+	free(p_memory);
+#endif
+}
+
 void *Memory::alloc_aligned_static(size_t p_bytes, size_t p_alignment) {
 	DEV_ASSERT(is_power_of_2(p_alignment));
 
@@ -95,17 +132,19 @@ void Memory::free_aligned_static(void *p_memory) {
 
 template <bool p_ensure_zero>
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_ALWAYS_PREPAD
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
 #endif
 
 	void *mem;
-	if constexpr (p_ensure_zero) {
-		mem = calloc(1, p_bytes + (prepad ? DATA_OFFSET : 0));
+	if (prepad) {
+		mem = _alloc_block(p_bytes + DATA_OFFSET, p_ensure_zero);
+	} else if constexpr (p_ensure_zero) {
+		mem = calloc(1, p_bytes);
 	} else {
-		mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+		mem = malloc(p_bytes);
 	}
 
 	ERR_FAIL_NULL_V(mem, nullptr);
@@ -136,7 +175,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_memory;
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_ALWAYS_PREPAD
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -156,12 +195,13 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 #endif
 
 		if (p_bytes == 0) {
-			free(mem);
+			_free_block(mem, *s + DATA_OFFSET);
 			return nullptr;
 		} else {
+			uint64_t prev_bytes = *s;
 			*s = p_bytes;
 
-			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
+			mem = (uint8_t *)_realloc_block(mem, prev_bytes + DATA_OFFSET, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
@@ -184,7 +224,7 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 	uint8_t *mem = (uint8_t *)p_ptr;
 
-#ifdef DEBUG_ENABLED
+#ifdef MEMORY_ALWAYS_PREPAD
 	bool prepad = true;
 #else
 	bool prepad = p_pad_align;
@@ -192,13 +232,13 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 
 	if (prepad) {
 		mem -= DATA_OFFSET;
+		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
 
 #ifdef DEBUG_ENABLED
-		uint64_t *s = (uint64_t *)(mem + SIZE_OFFSET);
 		mem_usage.sub(*s);
 #endif
 
-		free(mem);
+		_free_block(mem, *s + DATA_OFFSET);
 	} else {
 		free(mem);
 	}
@@ -0,0 +1,223 @@
+/**************************************************************************/
+/*  thread_cache_allocator.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "thread_cache_allocator.h"
+
+#include "core/os/spin_lock.h"
+
+#include <cstdlib>
+#include <cstring>
+
+// Size of the spans small blocks are carved from.
+static constexpr size_t SPAN_SIZE = 64 * 1024;
+
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+// Shared pool of free blocks for a size class.
+struct SizeClassPool {
+	SpinLock lock;
+	FreeBlock *free_list = nullptr;
+};
+
+static SizeClassPool size_class_pools[ThreadCacheAllocator::SIZE_CLASS_COUNT];
+
+// Plain data, so it can be used at any point of the thread lifetime.
+struct ThreadCache {
+	FreeBlock *free_lists[ThreadCacheAllocator::SIZE_CLASS_COUNT];
+	uint32_t counts[ThreadCacheAllocator::SIZE_CLASS_COUNT];
+};
+
+static thread_local ThreadCache thread_cache;
+static thread_local bool thread_cache_released = false;
+
+// Returns the cached blocks to the shared pools when the thread exits. Blocks freed
+// after that (e.g. by other thread_local destructors) go to the shared pools directly.
+struct ThreadCacheReleaser {
+	bool registered = false;
+
+	~ThreadCacheReleaser() {
+		ThreadCacheAllocator::release_thread_cache();
+		thread_cache_released = true;
+	}
+};
+
+static thread_local ThreadCacheReleaser thread_cache_releaser;
+
+// Maximum number of blocks a thread keeps per size class, about 64 KiB worth of them.
+static constexpr uint32_t _get_thread_cache_limit(uint32_t p_size_class) {
+	return CLAMP(uint32_t(SPAN_SIZE / ThreadCacheAllocator::get_size_class_size(p_size_class)), 8u, 256u);
+}
+
+static void _pool_push(uint32_t p_size_class, FreeBlock *p_first, FreeBlock *p_last) {
+	SizeClassPool &pool = size_class_pools[p_size_class];
+	pool.lock.lock();
+	p_last->next = pool.free_list;
+	pool.free_list = p_first;
+	pool.lock.unlock();
+}
+
+// Takes up to `p_max_count` blocks from the shared pool, carving a new span if it's empty.
+static FreeBlock *_pool_pop(uint32_t p_size_class, uint32_t p_max_count, uint32_t &r_count) {
+	SizeClassPool &pool = size_class_pools[p_size_class];
+	r_count = 0;
+
+	while (true) {
+		pool.lock.lock();
+		FreeBlock *first = pool.free_list;
+		if (first) {
+			FreeBlock *last = first;
+			r_count = 1;
+			while (r_count < p_max_count && last->next) {
+				last = last->next;
+				r_count++;
+			}
+			pool.free_list = last->next;
+			last->next = nullptr;
+			pool.lock.unlock();
+			return first;
+		}
+		pool.lock.unlock();
+
+		const size_t block_size = ThreadCacheAllocator::get_size_class_size(p_size_class);
+		const size_t span_size = MAX(SPAN_SIZE, block_size * 8);
+		uint8_t *span = (uint8_t *)::malloc(span_size);
+		if (unlikely(!span)) {
+			return nullptr;
+		}
+
+		const size_t block_count = span_size / block_size;
+		for (size_t i = 0; i < block_count - 1; i++) {
+			((FreeBlock *)(span + i * block_size))->next = (FreeBlock *)(span + (i + 1) * block_size);
+		}
+		_pool_push(p_size_class, (FreeBlock *)span, (FreeBlock *)(span + (block_count - 1) * block_size));
+	}
+}
+
+void *ThreadCacheAllocator::alloc(size_t p_bytes) {
+	if (p_bytes > MAX_SMALL_SIZE) {
+		return ::malloc(p_bytes);
+	}
+
+	const uint32_t size_class = get_size_class(p_bytes);
+	uint32_t count = 0;
+
+	if (unlikely(thread_cache_released)) {
+		return _pool_pop(size_class, 1, count);
+	}
+
+	ThreadCache &cache = thread_cache;
+	FreeBlock *block = cache.free_lists[size_class];
+	if (unlikely(!block)) {
+		// Make sure the cache is released when the thread exits.
+		thread_cache_releaser.registered = true;
+
+		block = _pool_pop(size_class, _get_thread_cache_limit(size_class) / 2, count);
+		if (unlikely(!block)) {
+			return nullptr;
+		}
+		cache.counts[size_class] = count;
+	}
+
+	cache.free_lists[size_class] = block->next;
+	cache.counts[size_class]--;
+	return block;
+}
+
+void ThreadCacheAllocator::free(void *p_memory, size_t p_bytes) {
+	if (p_bytes > MAX_SMALL_SIZE) {
+		::free(p_memory);
+		return;
+	}
+
+	const uint32_t size_class = get_size_class(p_bytes);
+	FreeBlock *block = (FreeBlock *)p_memory;
+
+	if (unlikely(thread_cache_released)) {
+		_pool_push(size_class, block, block);
+		return;
+	}
+
+	ThreadCache &cache = thread_cache;
+	block->next = cache.free_lists[size_class];
+	cache.free_lists[size_class] = block;
+	cache.counts[size_class]++;
+
+	const uint32_t limit = _get_thread_cache_limit(size_class);
+	if (unlikely(cache.counts[size_class] > limit)) {
+		// Give half of the blocks back, so other threads can use them.
+		FreeBlock *last = block;
+		for (uint32_t i = 1; i < limit / 2; i++) {
+			last = last->next;
+		}
+		cache.free_lists[size_class] = last->next;
+		cache.counts[size_class] -= limit / 2;
+		_pool_push(size_class, block, last);
+	}
+}
+
+void *ThreadCacheAllocator::realloc(void *p_memory, size_t p_prev_bytes, size_t p_bytes) {
+	if (p_prev_bytes > MAX_SMALL_SIZE && p_bytes > MAX_SMALL_SIZE) {
+		return ::realloc(p_memory, p_bytes);
+	}
+	if (p_prev_bytes <= MAX_SMALL_SIZE && p_bytes <= MAX_SMALL_SIZE && get_size_class(p_prev_bytes) == get_size_class(p_bytes)) {
+		return p_memory;
+	}
+
+	void *mem = alloc(p_bytes);
+	if (unlikely(!mem)) {
+		return nullptr;
+	}
+	memcpy(mem, p_memory, MIN(p_prev_bytes, p_bytes));
+	free(p_memory, p_prev_bytes);
+	return mem;
+}
+
+void ThreadCacheAllocator::release_thread_cache() {
+	if (thread_cache_released) {
+		return;
+	}
+
+	ThreadCache &cache = thread_cache;
+	for (uint32_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+		FreeBlock *first = cache.free_lists[i];
+		if (!first) {
+			continue;
+		}
+		FreeBlock *last = first;
+		while (last->next) {
+			last = last->next;
+		}
+		_pool_push(i, first, last);
+		cache.free_lists[i] = nullptr;
+		cache.counts[i] = 0;
+	}
+}
@@ -0,0 +1,72 @@
+/**************************************************************************/
+/*  thread_cache_allocator.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/typedefs.h"
+
+// Size class allocator with per-thread caches of free blocks.
+// Used for all engine allocations done through Memory when built with
+// `thread_cache_allocator=yes`. Small blocks are carved from large spans,
+// which are kept for reuse and never returned to the system. Bigger
+// allocations go straight to the system allocator.
+// The size of a block must be passed back when freeing or reallocating it.
+class ThreadCacheAllocator {
+public:
+	static constexpr size_t MAX_SMALL_SIZE = 32768;
+	static constexpr uint32_t SIZE_CLASS_COUNT = 40;
+
+	// Sizes up to 128 bytes go in steps of 16, bigger sizes in 4 steps per power of 2.
+	static constexpr uint32_t get_size_class(size_t p_bytes) {
+		if (p_bytes <= 128) {
+			return p_bytes == 0 ? 0 : uint32_t((p_bytes - 1) >> 4);
+		}
+		uint32_t shift = 7;
+		while ((size_t(1) << (shift + 1)) < p_bytes) {
+			shift++;
+		}
+		return 8 + (shift - 7) * 4 + uint32_t((p_bytes - 1) >> (shift - 2)) - 4;
+	}
+
+	static constexpr size_t get_size_class_size(uint32_t p_size_class) {
+		if (p_size_class < 8) {
+			return size_t(p_size_class + 1) << 4;
+		}
+		uint32_t shift = 7 + (p_size_class - 8) / 4;
+		return size_t((p_size_class - 8) % 4 + 5) << (shift - 2);
+	}
+
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_memory, size_t p_prev_bytes, size_t p_bytes);
+	static void free(void *p_memory, size_t p_bytes);
+
+	// Returns the free blocks cached by the calling thread to the shared pool.
+	static void release_thread_cache();
+};
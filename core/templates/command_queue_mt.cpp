@@ -30,9 +30,185 @@
 
 #include "command_queue_mt.h"
 
-CommandQueueMT::CommandQueueMT() {
-	command_mem.reserve(DEFAULT_COMMAND_MEM_SIZE_KB * 1024);
+static std::atomic<uint64_t> command_queue_id_counter{ 1 };
+
+CommandQueueMT::Producer *CommandQueueMT::_register_producer() {
+	Thread::ID thread_id = Thread::get_caller_id();
+	Producer *producer = nullptr;
+	{
+		MutexLock lock(producers_mutex);
+		// The thread may already be registered and only have been evicted from its cache.
+		for (Producer *existing : producers) {
+			if (existing->thread_id == thread_id) {
+				producer = existing;
+				break;
+			}
+		}
+		if (!producer) {
+			if (!retired_producers.is_empty()) {
+				producer = retired_producers[retired_producers.size() - 1];
+				retired_producers.resize(retired_producers.size() - 1);
+			} else {
+				producer = memnew(Producer);
+			}
+			producer->thread_id = thread_id;
+			producer->idle_flushes = 0;
+			producers.push_back(producer);
+		}
+		// Lock before it can be retired again.
+		producer->mutex.lock();
+	}
+
+	// Replace a stale entry for this queue, if any.
+	uint32_t index = producer_cache_next;
+	for (uint32_t i = 0; i < PRODUCER_CACHE_SIZE; i++) {
+		if (producer_cache[i].queue_id == queue_id) {
+			index = i;
+			break;
+		}
+	}
+	if (index == producer_cache_next) {
+		producer_cache_next = (producer_cache_next + 1) % PRODUCER_CACHE_SIZE;
+	}
+
+	ProducerCacheEntry &entry = producer_cache[index];
+	entry.queue_id = queue_id;
+	entry.producer = producer;
+	entry.generation = producer->generation;
+	return producer;
+}
+
+void CommandQueueMT::_take_flush_snapshot() {
+	// All producers are locked together, so the snapshot never contains a command
+	// without the commands that were pushed before it from other threads.
+	// Several producer mutexes are only ever held together under producers_mutex,
+	// so the order in which they are locked doesn't matter.
+	MutexLock lock(producers_mutex);
+	for (Producer *producer : producers) {
+		producer->mutex.lock();
+	}
+
+	pending.store(false);
+	flush_producers.clear();
+	for (Producer *producer : producers) {
+		if (!producer->command_mem.is_empty()) {
+			SWAP(producer->command_mem, producer->flush_mem);
+			flush_producers.push_back(producer);
+			producer->idle_flushes = 0;
+		} else {
+			producer->idle_flushes++;
+		}
+	}
+
+	_retire_idle_producers();
+
+	for (Producer *producer : producers) {
+		producer->mutex.unlock();
+	}
+}
+
+void CommandQueueMT::_retire_idle_producers() {
+	// Threads that stopped pushing, or exited, would otherwise keep being scanned on every flush.
+	// Called with producers_mutex and every producer mutex held.
+	for (uint32_t i = 0; i < producers.size();) {
+		Producer *producer = producers[i];
+		if (producer->idle_flushes < PRODUCER_RETIRE_FLUSHES) {
+			i++;
+			continue;
+		}
+		{
+			// The thread may not have woken up from its last sync yet.
+			MutexLock sync_lock(sync_mutex);
+			if (producer->sync_done) {
+				i++;
+				continue;
+			}
+		}
+
+		producer->generation++;
+		producer->thread_id = 0;
+		producer->command_mem.reset();
+		producer->flush_mem.reset();
+		producer->mutex.unlock();
+		producers.remove_at(i);
+		retired_producers.push_back(producer);
+	}
+}
+
+void CommandQueueMT::_flush() {
+	if (flushing.exchange(true)) {
+		// Re-entrant call, or another thread is already flushing.
+		return;
+	}
+
+	while (pending.load()) {
+		_take_flush_snapshot();
+
+		while (true) {
+			// Merge the producer buffers by sequence number. Keep reading from the same
+			// producer as long as it holds the oldest commands.
+			Producer *next = nullptr;
+			uint64_t next_seq = UINT64_MAX;
+			uint64_t limit_seq = UINT64_MAX;
+			for (Producer *producer : flush_producers) {
+				if (producer->flush_read_ptr >= producer->flush_mem.size()) {
+					continue;
+				}
+				uint64_t seq = reinterpret_cast<CommandHeader *>(&producer->flush_mem[producer->flush_read_ptr])->seq;
+				if (seq < next_seq) {
+					limit_seq = next_seq;
+					next_seq = seq;
+					next = producer;
+				} else if (seq < limit_seq) {
+					limit_seq = seq;
+				}
+			}
+
+			if (!next) {
+				break;
+			}
+
+			do {
+				CommandHeader *header = reinterpret_cast<CommandHeader *>(&next->flush_mem[next->flush_read_ptr]);
+				if (header->seq > limit_seq) {
+					break;
+				}
+				next->flush_read_ptr += sizeof(CommandHeader) + header->size;
+
+				CommandBase *cmd = reinterpret_cast<CommandBase *>(header + 1);
+				cmd->call();
+
+				if (unlikely(cmd->sync)) {
+					{
+						MutexLock lock(sync_mutex);
+						next->sync_done = true;
+					}
+					sync_cond_var.notify_all();
+				}
+
+				cmd->~CommandBase();
+			} while (next->flush_read_ptr < next->flush_mem.size());
+		}
+
+		for (Producer *producer : flush_producers) {
+			producer->flush_mem.clear();
+			producer->flush_read_ptr = 0;
+		}
+		flush_producers.clear();
+	}
+
+	flushing.store(false);
+}
+
+CommandQueueMT::CommandQueueMT() :
+		queue_id(command_queue_id_counter.fetch_add(1)) {
 }
 
 CommandQueueMT::~CommandQueueMT() {
+	for (Producer *producer : producers) {
+		memdelete(producer);
+	}
+	for (Producer *producer : retired_producers) {
+		memdelete(producer);
+	}
 }
@@ -33,6 +33,7 @@
 #include "core/object/worker_thread_pool.h"
 #include "core/os/condition_variable.h"
 #include "core/os/mutex.h"
+#include "core/os/thread.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/simple_type.h"
 #include "core/templates/tuple.h"
@@ -103,109 +104,124 @@ class CommandQueueMT {
 
 	/***** BASE *******/
 
-	static const uint32_t DEFAULT_COMMAND_MEM_SIZE_KB = 64;
+	// Every command is prefixed by this header in the producer buffers.
+	// The sequence number gives the global order in which commands were pushed,
+	// and is used to merge the producer buffers back into that order on flush.
+	struct CommandHeader {
+		uint64_t size = 0;
+		uint64_t seq = 0;
+	};
+
+	// Each thread pushing to the queue gets its own buffer, so producers only
+	// contend with the flush, never with each other.
+	// Producers that stay empty for PRODUCER_RETIRE_FLUSHES flushes are retired and
+	// kept for reuse by other threads. They are only deleted with the queue, since
+	// thread caches may still point to them. Bumping the generation on retirement
+	// tells those caches that the producer is no longer theirs.
+	struct Producer {
+		BinaryMutex mutex;
+		LocalVector<uint8_t> command_mem; // Guarded by mutex.
+		LocalVector<uint8_t> flush_mem; // Only accessed by the flushing thread.
+		uint64_t flush_read_ptr = 0;
+		Thread::ID thread_id = 0;
+		uint32_t generation = 0; // Guarded by mutex.
+		uint32_t idle_flushes = 0; // Only accessed with producers_mutex held.
+		bool sync_done = false; // Guarded by sync_mutex.
+	};
+
+	struct ProducerCacheEntry {
+		uint64_t queue_id;
+		Producer *producer;
+		uint32_t generation;
+	};
+
+	static const uint32_t PRODUCER_CACHE_SIZE = 4;
+	static inline thread_local ProducerCacheEntry producer_cache[PRODUCER_CACHE_SIZE] = {};
+	static inline thread_local uint32_t producer_cache_next = 0;
+
+	const uint64_t queue_id;
+	std::atomic<uint64_t> command_seq{ 0 };
 
-	BinaryMutex mutex;
-	LocalVector<uint8_t> command_mem;
+	BinaryMutex producers_mutex;
+	LocalVector<Producer *> producers; // Guarded by producers_mutex.
+	LocalVector<Producer *> retired_producers; // Guarded by producers_mutex.
+	LocalVector<Producer *> flush_producers; // Producers with commands in the current flush.
+
+	BinaryMutex sync_mutex;
 	ConditionVariable sync_cond_var;
-	uint32_t sync_head = 0;
-	uint32_t sync_tail = 0;
-	uint32_t sync_awaiters = 0;
-	WorkerThreadPool::TaskID pump_task_id = WorkerThreadPool::INVALID_TASK_ID;
-	uint64_t flush_read_ptr = 0;
+	std::atomic<WorkerThreadPool::TaskID> pump_task_id{ WorkerThreadPool::INVALID_TASK_ID };
 	std::atomic<bool> pending{ false };
+	std::atomic<bool> flushing{ false };
+
+	Producer *_register_producer();
+
+	// Returns the producer of the calling thread, locked.
+	_FORCE_INLINE_ Producer *_lock_producer() {
+		for (const ProducerCacheEntry &entry : producer_cache) {
+			if (entry.queue_id == queue_id) {
+				entry.producer->mutex.lock();
+				if (likely(entry.producer->generation == entry.generation)) {
+					return entry.producer;
+				}
+				// Retired since it was cached.
+				entry.producer->mutex.unlock();
+				break;
+			}
+		}
+		return _register_producer();
+	}
 
 	template <typename T, typename... Args>
-	_FORCE_INLINE_ void create_command(Args &&...p_args) {
+	_FORCE_INLINE_ void create_command(Producer *p_producer, Args &&...p_args) {
 		// alloc size is size+T+safeguard
 		constexpr uint64_t alloc_size = ((sizeof(T) + 8U - 1U) & ~(8U - 1U));
 		static_assert(alloc_size < UINT32_MAX, "Type too large to fit in the command queue.");
 
+		LocalVector<uint8_t> &command_mem = p_producer->command_mem;
 		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + sizeof(uint64_t));
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		void *cmd = &command_mem[size + sizeof(uint64_t)];
-		new (cmd) T(std::forward<Args>(p_args)...);
-		pending.store(true);
+		command_mem.resize(size + sizeof(CommandHeader) + alloc_size);
+		CommandHeader *header = reinterpret_cast<CommandHeader *>(&command_mem[size]);
+		header->size = alloc_size;
+		header->seq = command_seq.fetch_add(1, std::memory_order_relaxed);
+		new (header + 1) T(std::forward<Args>(p_args)...);
 	}
 
 	template <typename T, bool NeedsSync, typename... Args>
 	_FORCE_INLINE_ void _push_internal(Args &&...args) {
-		MutexLock mlock(mutex);
-		create_command<T>(std::forward<Args>(args)...);
-
-		if (pump_task_id != WorkerThreadPool::INVALID_TASK_ID) {
-			WorkerThreadPool::get_singleton()->notify_yield_over(pump_task_id);
+		Producer *producer = _lock_producer();
+		create_command<T>(producer, std::forward<Args>(args)...);
+		producer->mutex.unlock();
+
+		// Only the push making the queue pending needs to wake the pump up.
+		if (!pending.load(std::memory_order_relaxed) && !pending.exchange(true)) {
+			WorkerThreadPool::TaskID task_id = pump_task_id.load(std::memory_order_relaxed);
+			if (task_id != WorkerThreadPool::INVALID_TASK_ID) {
+				WorkerThreadPool::get_singleton()->notify_yield_over(task_id);
+			}
 		}
 
 		if constexpr (NeedsSync) {
-			sync_tail++;
-			_wait_for_sync(mlock);
-		}
-	}
-
-	_FORCE_INLINE_ void _prevent_sync_wraparound() {
-		bool safe_to_reset = !sync_awaiters;
-		bool already_sync_to_latest = sync_head == sync_tail;
-		if (safe_to_reset && already_sync_to_latest) {
-			sync_head = 0;
-			sync_tail = 0;
+			_wait_for_sync(producer);
 		}
 	}
 
-	void _flush() {
-		if (unlikely(flush_read_ptr)) {
-			// Re-entrant call.
-			return;
-		}
+	void _take_flush_snapshot();
+	void _retire_idle_producers();
+	void _flush();
 
-		MutexLock lock(mutex);
-
-		while (flush_read_ptr < command_mem.size()) {
-			uint64_t size = *(uint64_t *)&command_mem[flush_read_ptr];
-			flush_read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			uint32_t allowance_id = WorkerThreadPool::thread_enter_unlock_allowance_zone(lock);
-			cmd->call();
-			WorkerThreadPool::thread_exit_unlock_allowance_zone(allowance_id);
-
-			// Handle potential realloc due to the command and unlock allowance.
-			cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-
-			if (unlikely(cmd->sync)) {
-				sync_head++;
-				lock.~MutexLock(); // Give an opportunity to awaiters right away.
-				sync_cond_var.notify_all();
-				new (&lock) MutexLock(mutex);
-				// Handle potential realloc happened during unlock.
-				cmd = reinterpret_cast<CommandBase *>(&command_mem[flush_read_ptr]);
-			}
-
-			cmd->~CommandBase();
-
-			flush_read_ptr += size;
+	_FORCE_INLINE_ void _wait_for_sync(Producer *p_producer) {
+		MutexLock lock(sync_mutex);
+		while (!p_producer->sync_done) {
+			sync_cond_var.wait(lock);
 		}
-
-		command_mem.clear();
-		pending.store(false);
-		flush_read_ptr = 0;
-
-		_prevent_sync_wraparound();
-	}
-
-	_FORCE_INLINE_ void _wait_for_sync(MutexLock<BinaryMutex> &p_lock) {
-		sync_awaiters++;
-		uint32_t sync_head_goal = sync_tail;
-		do {
-			sync_cond_var.wait(p_lock);
-		} while (sync_head < sync_head_goal);
-		sync_awaiters--;
-		_prevent_sync_wraparound();
+		p_producer->sync_done = false;
 	}
 
 	void _no_op() {}
 
 public:
+	static const uint32_t PRODUCER_RETIRE_FLUSHES = 64;
+
 	template <typename T, typename M, typename... Args>
 	void push(T *p_instance, M p_method, Args &&...p_args) {
 		// Standard command, no sync.
@@ -242,14 +258,23 @@ public:
 	}
 
 	void wait_and_flush() {
-		ERR_FAIL_COND(pump_task_id == WorkerThreadPool::INVALID_TASK_ID);
-		WorkerThreadPool::get_singleton()->wait_for_task_completion(pump_task_id);
+		WorkerThreadPool::TaskID task_id = pump_task_id.load();
+		ERR_FAIL_COND(task_id == WorkerThreadPool::INVALID_TASK_ID);
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(task_id);
 		_flush();
 	}
 
 	void set_pump_task_id(WorkerThreadPool::TaskID p_task_id) {
-		MutexLock lock(mutex);
-		pump_task_id = p_task_id;
+		pump_task_id.store(p_task_id);
+		// Commands pushed before the pump existed did not wake it up.
+		if (pending.load() && p_task_id != WorkerThreadPool::INVALID_TASK_ID) {
+			WorkerThreadPool::get_singleton()->notify_yield_over(p_task_id);
+		}
+	}
+
+	uint32_t get_producer_count() {
+		MutexLock lock(producers_mutex);
+		return producers.size();
 	}
 
 	CommandQueueMT();
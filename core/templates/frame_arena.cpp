@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+thread_local FrameArena FrameArena::thread_arena;
+
+void *FrameArena::_alloc_in_next_chunk(size_t p_bytes) {
+	Chunk *next_chunk = current_chunk ? current_chunk->next : first_chunk;
+	if (!next_chunk || next_chunk->capacity < p_bytes) {
+		// Insert a new chunk, keeping the ones after it for later.
+		const size_t capacity = MAX(CHUNK_SIZE, p_bytes);
+		Chunk *chunk = memnew_placement(Memory::alloc_static(sizeof(Chunk) + capacity), Chunk);
+		chunk->capacity = capacity;
+		chunk->next = next_chunk;
+		if (current_chunk) {
+			current_chunk->next = chunk;
+		} else {
+			first_chunk = chunk;
+		}
+		next_chunk = chunk;
+	}
+
+	current_chunk = next_chunk;
+	last_offset = 0;
+	offset = p_bytes;
+	return current_chunk->get_data();
+}
+
+void *FrameArena::realloc(void *p_memory, size_t p_prev_bytes, size_t p_bytes) {
+	if (!p_memory) {
+		return alloc(p_bytes);
+	}
+
+#ifdef DEBUG_ENABLED
+	// Either way the grown allocation would belong to the innermost scope, and be released while the outer one still uses it.
+	CRASH_COND_MSG(p_bytes > p_prev_bytes && is_from_outer_scope(p_memory), "A FrameArena allocation can't grow within a nested scope.");
+#endif
+
+	if (current_chunk && p_memory == current_chunk->get_data() + last_offset) {
+		// Last allocation, grow or shrink it in place if it fits.
+		const size_t end = last_offset + ((p_bytes + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1));
+		if (end <= current_chunk->capacity) {
+			offset = end;
+			return p_memory;
+		}
+	} else if (p_bytes <= p_prev_bytes) {
+		return p_memory;
+	}
+
+	void *mem = alloc(p_bytes);
+	memcpy(mem, p_memory, MIN(p_prev_bytes, p_bytes));
+	return mem;
+}
+
+bool FrameArena::is_from_outer_scope(const void *p_memory) const {
+	if (!scope_chunk) {
+		// The innermost scope started before anything was allocated.
+		return false;
+	}
+
+	// Chunks are used in list order, so anything in a chunk before the scope's one is older than the scope.
+	const uint8_t *ptr = static_cast<const uint8_t *>(p_memory);
+	for (Chunk *chunk = first_chunk; chunk; chunk = chunk->next) {
+		const uint8_t *data = chunk->get_data();
+		const bool in_chunk = ptr >= data && ptr < data + chunk->capacity;
+		if (chunk == scope_chunk) {
+			return in_chunk && ptr < data + scope_offset;
+		}
+		if (in_chunk) {
+			return true;
+		}
+	}
+	return false;
+}
+
+size_t FrameArena::get_chunk_count() const {
+	size_t count = 0;
+	for (const Chunk *chunk = first_chunk; chunk; chunk = chunk->next) {
+		count++;
+	}
+	return count;
+}
+
+size_t FrameArena::get_capacity() const {
+	size_t capacity = 0;
+	for (const Chunk *chunk = first_chunk; chunk; chunk = chunk->next) {
+		capacity += chunk->capacity;
+	}
+	return capacity;
+}
+
+void FrameArena::clear() {
+	ERR_FAIL_COND_MSG(scope_depth > 0, "Can't clear a FrameArena while a scope is open.");
+
+	Chunk *chunk = first_chunk;
+	while (chunk) {
+		Chunk *next = chunk->next;
+		Memory::free_static(chunk);
+		chunk = next;
+	}
+	first_chunk = nullptr;
+	current_chunk = nullptr;
+	offset = 0;
+	last_offset = 0;
+}
+
+FrameArena::~FrameArena() {
+	scope_depth = 0;
+	clear();
+}
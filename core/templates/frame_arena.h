@@ -0,0 +1,155 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+
+// Linear allocator for short lived scratch data, such as the temporary
+// containers used while answering a navigation query.
+//
+// Every thread has its own arena. Code that wants to use it opens a
+// FrameArena::Scope, and everything allocated from the arena while the
+// scope is open is released at once when it closes. The memory is kept
+// for the next scope, so once the arena has grown to fit a frame's worth
+// of data it no longer allocates from the heap.
+//
+// Containers using FrameArenaAllocator must not outlive the scope they
+// were filled in, and must only be used from the thread that owns them.
+// They must not grow within a nested scope either, since the grown memory
+// would be released when the nested scope closes. Debug builds check this.
+class FrameArena {
+	static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+	struct alignas(alignof(max_align_t)) Chunk {
+		Chunk *next = nullptr;
+		size_t capacity = 0;
+
+		_FORCE_INLINE_ uint8_t *get_data() { return reinterpret_cast<uint8_t *>(this + 1); }
+	};
+
+	Chunk *first_chunk = nullptr;
+	Chunk *current_chunk = nullptr;
+	size_t offset = 0;
+	size_t last_offset = 0;
+	uint32_t scope_depth = 0;
+
+	// Start of the innermost scope.
+	Chunk *scope_chunk = nullptr;
+	size_t scope_offset = 0;
+
+	static thread_local FrameArena thread_arena;
+
+	void *_alloc_in_next_chunk(size_t p_bytes);
+
+public:
+	class Scope {
+		FrameArena &arena;
+		Chunk *chunk = nullptr;
+		size_t offset = 0;
+		Chunk *outer_scope_chunk = nullptr;
+		size_t outer_scope_offset = 0;
+
+	public:
+		_FORCE_INLINE_ Scope(FrameArena &p_arena = FrameArena::get_thread_arena()) :
+				arena(p_arena),
+				chunk(p_arena.current_chunk),
+				offset(p_arena.offset),
+				outer_scope_chunk(p_arena.scope_chunk),
+				outer_scope_offset(p_arena.scope_offset) {
+			arena.scope_depth++;
+			arena.scope_chunk = chunk;
+			arena.scope_offset = offset;
+		}
+
+		_FORCE_INLINE_ ~Scope() {
+			arena.scope_depth--;
+			arena.current_chunk = chunk;
+			arena.offset = offset;
+			arena.last_offset = offset;
+			arena.scope_chunk = outer_scope_chunk;
+			arena.scope_offset = outer_scope_offset;
+		}
+	};
+
+	_FORCE_INLINE_ static FrameArena &get_thread_arena() { return thread_arena; }
+
+	// Allocations are aligned to `max_align_t`.
+	_FORCE_INLINE_ void *alloc(size_t p_bytes) {
+		DEV_ASSERT(scope_depth > 0);
+		p_bytes = (p_bytes + alignof(max_align_t) - 1) & ~(alignof(max_align_t) - 1);
+		if (likely(current_chunk && offset + p_bytes <= current_chunk->capacity)) {
+			last_offset = offset;
+			offset += p_bytes;
+			return current_chunk->get_data() + last_offset;
+		}
+		return _alloc_in_next_chunk(p_bytes);
+	}
+
+	// Grows in place if `p_memory` is the last allocation, otherwise copies to a new allocation.
+	void *realloc(void *p_memory, size_t p_prev_bytes, size_t p_bytes);
+
+	bool is_in_scope() const { return scope_depth > 0; }
+	// Whether `p_memory` was allocated before the innermost scope was opened.
+	bool is_from_outer_scope(const void *p_memory) const;
+	size_t get_chunk_count() const;
+	size_t get_capacity() const;
+
+	// Frees all the memory held by the arena. Must not be called within a scope.
+	void clear();
+
+	FrameArena() {}
+	~FrameArena();
+};
+
+// Allocator for containers using the current thread's FrameArena.
+class FrameArenaAllocator {
+public:
+	_FORCE_INLINE_ static void *alloc(size_t p_memory) { return FrameArena::get_thread_arena().alloc(p_memory); }
+	_FORCE_INLINE_ static void *realloc(void *p_ptr, size_t p_prev_memory, size_t p_memory) { return FrameArena::get_thread_arena().realloc(p_ptr, p_prev_memory, p_memory); }
+	_FORCE_INLINE_ static void free(void *p_ptr) {} // Released when the scope closes.
+};
+
+// Typed allocator for HashMap elements, using the current thread's FrameArena.
+template <typename T>
+class FrameArenaTypedAllocator {
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_placement(FrameArenaAllocator::alloc(sizeof(T)), T(p_args...)); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) {
+		if constexpr (!std::is_trivially_destructible_v<T>) {
+			p_allocation->~T();
+		}
+	}
+};
+
+template <typename T, typename U = uint32_t>
+using FrameLocalVector = LocalVector<T, U, false, false, FrameArenaAllocator>;
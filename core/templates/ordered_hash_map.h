@@ -0,0 +1,582 @@
+/**************************************************************************/
+/*  ordered_hash_map.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/sort_array.h"
+
+/**
+ * A hash map that keeps its elements in insertion order, even when erasing.
+ *
+ * Elements are listed in a dense array in the order they were inserted,
+ * and a separate open-addressing index table maps hashes to positions in
+ * that array. Erasing leaves a hole in the element array, which is skipped
+ * when iterating and squeezed out the next time the array needs to grow.
+ *
+ * Maps with up to SMALL_SIZE elements don't allocate an index table at
+ * all, lookups just compare the cached hashes of the elements in order.
+ *
+ *  elements: A B X D E X G     (X = erased)
+ *  indices:  . 3 . 0 . 6 1 . 4 . . . . . . .
+ *
+ * The element array only holds pointers. The keys and values themselves
+ * live in pages that are added as the map grows and are never reallocated,
+ * so, like with HashMap, pointers to values stay valid until that key is
+ * erased or the map is cleared. Each page is as large as all the previous
+ * ones together, so growing still only allocates a logarithmic number of
+ * times.
+ */
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class OrderedHashMap {
+public:
+	static constexpr uint32_t SMALL_SIZE = 8;
+	static constexpr uint32_t ERASED_HASH = 0;
+	static constexpr uint32_t EMPTY_INDEX = UINT32_MAX;
+
+private:
+	typedef KeyValue<TKey, TValue> MapKeyValue;
+
+	// Storage for one element, or a link in the list of free ones.
+	union Slot {
+		MapKeyValue element;
+		Slot *next_free;
+
+		Slot() {}
+		~Slot() {}
+	};
+
+	struct Page {
+		Slot *slots = nullptr;
+		uint32_t size = 0;
+	};
+
+	MapKeyValue **elements = nullptr;
+	// Cached hash of each element, ERASED_HASH for holes left by erasing.
+	uint32_t *hashes = nullptr;
+	// Positions in `elements`, EMPTY_INDEX for free slots. Null while the map is small.
+	uint32_t *indices = nullptr;
+
+	// The pages add up to `capacity` slots, so there is always room for every element.
+	Page *pages = nullptr;
+	uint32_t page_count = 0;
+	// Next never used slot, in `pages[alloc_page]`.
+	uint32_t alloc_page = 0;
+	uint32_t alloc_offset = 0;
+	// Slots of erased elements, reused before the never used ones.
+	Slot *free_slots = nullptr;
+
+	uint32_t capacity = 0;
+	// Number of used positions in `elements`, including the erased ones.
+	uint32_t used = 0;
+	uint32_t num_elements = 0;
+
+	_FORCE_INLINE_ static uint32_t _hash(const TKey &p_key) {
+		uint32_t hash = Hasher::hash(p_key);
+		if (unlikely(hash == ERASED_HASH)) {
+			hash = ERASED_HASH + 1;
+		}
+		return hash;
+	}
+
+	// Twice the element capacity, so the index table is at most half full.
+	_FORCE_INLINE_ uint32_t _get_index_mask() const { return capacity * 2 - 1; }
+
+	uint32_t _lookup_pos(const TKey &p_key, uint32_t p_hash) const {
+		if (!indices) {
+			for (uint32_t i = 0; i < used; i++) {
+				if (hashes[i] == p_hash && Comparator::compare(elements[i]->key, p_key)) {
+					return i;
+				}
+			}
+			return EMPTY_INDEX;
+		}
+
+		const uint32_t mask = _get_index_mask();
+		uint32_t slot = p_hash & mask;
+		while (true) {
+			const uint32_t pos = indices[slot];
+			if (pos == EMPTY_INDEX) {
+				return EMPTY_INDEX;
+			}
+			if (hashes[pos] == p_hash && Comparator::compare(elements[pos]->key, p_key)) {
+				return pos;
+			}
+			slot = (slot + 1) & mask;
+		}
+	}
+
+	void _index_insert(uint32_t p_hash, uint32_t p_pos) {
+		const uint32_t mask = _get_index_mask();
+		uint32_t slot = p_hash & mask;
+		// Slots pointing to erased elements can be reused, they never match a lookup.
+		while (indices[slot] != EMPTY_INDEX && hashes[indices[slot]] != ERASED_HASH) {
+			slot = (slot + 1) & mask;
+		}
+		indices[slot] = p_pos;
+	}
+
+	void _rebuild_indices() {
+		if (capacity <= SMALL_SIZE) {
+			if (indices) {
+				Memory::free_static(indices);
+				indices = nullptr;
+			}
+			return;
+		}
+
+		if (!indices) {
+			indices = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity * 2));
+		}
+		memset(indices, 0xFF, sizeof(uint32_t) * capacity * 2); // EMPTY_INDEX.
+		for (uint32_t i = 0; i < used; i++) {
+			if (hashes[i] != ERASED_HASH) {
+				_index_insert(hashes[i], i);
+			}
+		}
+	}
+
+	// Moves the remaining element pointers over the erased ones, keeping their order.
+	// The elements themselves stay where they are.
+	void _compact() {
+		uint32_t to = 0;
+		for (uint32_t from = 0; from < used; from++) {
+			if (hashes[from] == ERASED_HASH) {
+				continue;
+			}
+			if (from != to) {
+				elements[to] = elements[from];
+				hashes[to] = hashes[from];
+			}
+			to++;
+		}
+		used = to;
+	}
+
+	void _resize(uint32_t p_capacity) {
+		// Only the pointer arrays are reallocated, existing pages are kept as they are.
+		elements = reinterpret_cast<MapKeyValue **>(Memory::realloc_static(elements, sizeof(MapKeyValue *) * p_capacity));
+		hashes = reinterpret_cast<uint32_t *>(Memory::realloc_static(hashes, sizeof(uint32_t) * p_capacity));
+
+		pages = reinterpret_cast<Page *>(Memory::realloc_static(pages, sizeof(Page) * (page_count + 1)));
+		Page &page = pages[page_count++];
+		page.size = p_capacity - capacity;
+		page.slots = reinterpret_cast<Slot *>(Memory::alloc_static(sizeof(Slot) * page.size));
+
+		if (indices && p_capacity != capacity) {
+			Memory::free_static(indices);
+			indices = nullptr;
+		}
+		capacity = p_capacity;
+		_rebuild_indices();
+	}
+
+	MapKeyValue *_alloc_element() {
+		if (free_slots) {
+			Slot *slot = free_slots;
+			free_slots = slot->next_free;
+			return &slot->element;
+		}
+		while (alloc_offset == pages[alloc_page].size) {
+			alloc_page++;
+			alloc_offset = 0;
+		}
+		return &pages[alloc_page].slots[alloc_offset++].element;
+	}
+
+	void _free_element(MapKeyValue *p_element) {
+		p_element->~MapKeyValue();
+		// The element is the only member of the union, so this is also the slot's address.
+		Slot *slot = reinterpret_cast<Slot *>(p_element);
+		slot->next_free = free_slots;
+		free_slots = slot;
+	}
+
+	// Forgets every slot, to be called once all the elements are destroyed.
+	void _reset_slots() {
+		alloc_page = 0;
+		alloc_offset = 0;
+		free_slots = nullptr;
+	}
+
+	uint32_t _insert(const TKey &p_key, const TValue &p_value, uint32_t p_hash) {
+		if (unlikely(used == capacity)) {
+			if (num_elements < used / 2) {
+				// Mostly holes, reuse them instead of growing.
+				_compact();
+				_rebuild_indices();
+			} else {
+				_resize(MAX(capacity * 2, 4u));
+			}
+		}
+
+		const uint32_t pos = used++;
+		elements[pos] = memnew_placement(_alloc_element(), MapKeyValue(p_key, p_value));
+		hashes[pos] = p_hash;
+		if (indices) {
+			_index_insert(p_hash, pos);
+		}
+		num_elements++;
+		return pos;
+	}
+
+	void _destroy_elements() {
+		if constexpr (!(std::is_trivially_destructible_v<TKey> && std::is_trivially_destructible_v<TValue>)) {
+			for (uint32_t i = 0; i < used; i++) {
+				if (hashes[i] != ERASED_HASH) {
+					elements[i]->~MapKeyValue();
+				}
+			}
+		}
+	}
+
+	void _copy_from(const OrderedHashMap &p_other) {
+		if (p_other.num_elements == 0) {
+			return;
+		}
+		reserve(p_other.num_elements);
+		for (uint32_t i = 0; i < p_other.used; i++) {
+			if (p_other.hashes[i] == ERASED_HASH) {
+				continue;
+			}
+			elements[used] = memnew_placement(_alloc_element(), MapKeyValue(*p_other.elements[i]));
+			hashes[used] = p_other.hashes[i];
+			if (indices) {
+				_index_insert(hashes[used], used);
+			}
+			used++;
+		}
+		num_elements = p_other.num_elements;
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return capacity; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+	_FORCE_INLINE_ bool is_empty() const { return num_elements == 0; }
+
+	void clear() {
+		if (num_elements == 0 && used == 0) {
+			return;
+		}
+		_destroy_elements();
+		_reset_slots();
+		used = 0;
+		num_elements = 0;
+		if (indices) {
+			memset(indices, 0xFF, sizeof(uint32_t) * capacity * 2);
+		}
+	}
+
+	void reserve(uint32_t p_new_capacity) {
+		if (p_new_capacity <= capacity) {
+			return;
+		}
+		_resize(next_power_of_2(p_new_capacity));
+	}
+
+	/* Lookup */
+
+	bool has(const TKey &p_key) const {
+		return num_elements > 0 && _lookup_pos(p_key, _hash(p_key)) != EMPTY_INDEX;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		if (num_elements == 0) {
+			return nullptr;
+		}
+		const uint32_t pos = _lookup_pos(p_key, _hash(p_key));
+		return pos != EMPTY_INDEX ? &elements[pos]->value : nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		if (num_elements == 0) {
+			return nullptr;
+		}
+		const uint32_t pos = _lookup_pos(p_key, _hash(p_key));
+		return pos != EMPTY_INDEX ? &elements[pos]->value : nullptr;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		const TValue *value = getptr(p_key);
+		CRASH_COND_MSG(!value, "OrderedHashMap key not found.");
+		return *value;
+	}
+
+	TValue &get(const TKey &p_key) {
+		TValue *value = getptr(p_key);
+		CRASH_COND_MSG(!value, "OrderedHashMap key not found.");
+		return *value;
+	}
+
+	const TValue &operator[](const TKey &p_key) const {
+		return get(p_key);
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t pos = num_elements > 0 ? _lookup_pos(p_key, hash) : EMPTY_INDEX;
+		if (pos == EMPTY_INDEX) {
+			pos = _insert(p_key, TValue(), hash);
+		}
+		return elements[pos]->value;
+	}
+
+	/* Iterators */
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const MapKeyValue &operator*() const { return *elements[pos]; }
+		_FORCE_INLINE_ const MapKeyValue *operator->() const { return elements[pos]; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			pos++;
+			while (pos < end && hashes[pos] == ERASED_HASH) {
+				pos++;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &p_it) const { return pos == p_it.pos && elements == p_it.elements; }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &p_it) const { return pos != p_it.pos || elements != p_it.elements; }
+		_FORCE_INLINE_ explicit operator bool() const { return pos < end; }
+
+		_FORCE_INLINE_ ConstIterator(MapKeyValue *const *p_elements, const uint32_t *p_hashes, uint32_t p_pos, uint32_t p_end) :
+				elements(p_elements), hashes(p_hashes), pos(p_pos), end(p_end) {}
+		_FORCE_INLINE_ ConstIterator() {}
+
+	private:
+		MapKeyValue *const *elements = nullptr;
+		const uint32_t *hashes = nullptr;
+		uint32_t pos = 0;
+		uint32_t end = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ MapKeyValue &operator*() const { return *elements[pos]; }
+		_FORCE_INLINE_ MapKeyValue *operator->() const { return elements[pos]; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			pos++;
+			while (pos < end && hashes[pos] == ERASED_HASH) {
+				pos++;
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &p_it) const { return pos == p_it.pos && elements == p_it.elements; }
+		_FORCE_INLINE_ bool operator!=(const Iterator &p_it) const { return pos != p_it.pos || elements != p_it.elements; }
+		_FORCE_INLINE_ explicit operator bool() const { return pos < end; }
+
+		_FORCE_INLINE_ operator ConstIterator() const { return ConstIterator(elements, hashes, pos, end); }
+
+		_FORCE_INLINE_ Iterator(MapKeyValue *const *p_elements, const uint32_t *p_hashes, uint32_t p_pos, uint32_t p_end) :
+				elements(p_elements), hashes(p_hashes), pos(p_pos), end(p_end) {}
+		_FORCE_INLINE_ Iterator() {}
+
+	private:
+		MapKeyValue *const *elements = nullptr;
+		const uint32_t *hashes = nullptr;
+		uint32_t pos = 0;
+		uint32_t end = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		uint32_t pos = 0;
+		while (pos < used && hashes[pos] == ERASED_HASH) {
+			pos++;
+		}
+		return Iterator(elements, hashes, pos, used);
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator(elements, hashes, used, used);
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		uint32_t pos = 0;
+		while (pos < used && hashes[pos] == ERASED_HASH) {
+			pos++;
+		}
+		return ConstIterator(elements, hashes, pos, used);
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator(elements, hashes, used, used);
+	}
+
+	Iterator find(const TKey &p_key) {
+		if (num_elements == 0) {
+			return end();
+		}
+		const uint32_t pos = _lookup_pos(p_key, _hash(p_key));
+		return pos != EMPTY_INDEX ? Iterator(elements, hashes, pos, used) : end();
+	}
+
+	ConstIterator find(const TKey &p_key) const {
+		if (num_elements == 0) {
+			return end();
+		}
+		const uint32_t pos = _lookup_pos(p_key, _hash(p_key));
+		return pos != EMPTY_INDEX ? ConstIterator(elements, hashes, pos, used) : end();
+	}
+
+	/* Indexing */
+
+	// Returns the element at `p_index` in insertion order.
+	const MapKeyValue &get_by_index(uint32_t p_index) const {
+		CRASH_BAD_UNSIGNED_INDEX(p_index, num_elements);
+		if (used == num_elements) {
+			return *elements[p_index];
+		}
+		// Skip the holes.
+		for (uint32_t i = 0;; i++) {
+			if (hashes[i] != ERASED_HASH && p_index-- == 0) {
+				return *elements[i];
+			}
+		}
+	}
+
+	MapKeyValue &get_by_index(uint32_t p_index) {
+		return const_cast<MapKeyValue &>(const_cast<const OrderedHashMap *>(this)->get_by_index(p_index));
+	}
+
+	/* Insert and erase */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value) {
+		const uint32_t hash = _hash(p_key);
+		uint32_t pos = num_elements > 0 ? _lookup_pos(p_key, hash) : EMPTY_INDEX;
+		if (pos == EMPTY_INDEX) {
+			pos = _insert(p_key, p_value, hash);
+		} else {
+			elements[pos]->value = p_value;
+		}
+		return Iterator(elements, hashes, pos, used);
+	}
+
+	bool erase(const TKey &p_key) {
+		if (num_elements == 0) {
+			return false;
+		}
+		const uint32_t pos = _lookup_pos(p_key, _hash(p_key));
+		if (pos == EMPTY_INDEX) {
+			return false;
+		}
+
+		_free_element(elements[pos]);
+		hashes[pos] = ERASED_HASH;
+		num_elements--;
+
+		if (num_elements == 0) {
+			// Start over, so a map used as a queue doesn't keep growing its holes.
+			_reset_slots();
+			used = 0;
+			if (indices) {
+				memset(indices, 0xFF, sizeof(uint32_t) * capacity * 2);
+			}
+		}
+		return true;
+	}
+
+	template <typename C>
+	void sort_custom() {
+		if (num_elements < 2) {
+			return;
+		}
+		_compact();
+
+		struct IndexSort {
+			MapKeyValue *const *elements = nullptr;
+			_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const { return C()(*elements[p_a], *elements[p_b]); }
+		};
+
+		LocalVector<uint32_t> order;
+		order.resize(num_elements);
+		for (uint32_t i = 0; i < num_elements; i++) {
+			order[i] = i;
+		}
+		SortArray<uint32_t, IndexSort> sorter;
+		sorter.compare.elements = elements;
+		sorter.sort(order.ptr(), num_elements);
+
+		// Only the pointers are reordered, the elements stay where they are.
+		MapKeyValue **sorted_elements = reinterpret_cast<MapKeyValue **>(Memory::alloc_static(sizeof(MapKeyValue *) * capacity));
+		uint32_t *sorted_hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * capacity));
+		for (uint32_t i = 0; i < num_elements; i++) {
+			sorted_elements[i] = elements[order[i]];
+			sorted_hashes[i] = hashes[order[i]];
+		}
+		Memory::free_static(elements);
+		Memory::free_static(hashes);
+		elements = sorted_elements;
+		hashes = sorted_hashes;
+		_rebuild_indices();
+	}
+
+	/* Constructors */
+
+	OrderedHashMap(const OrderedHashMap &p_other) {
+		_copy_from(p_other);
+	}
+
+	void operator=(const OrderedHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		clear();
+		_copy_from(p_other);
+	}
+
+	OrderedHashMap(uint32_t p_initial_capacity) {
+		reserve(p_initial_capacity);
+	}
+	OrderedHashMap() {}
+
+	OrderedHashMap(std::initializer_list<KeyValue<TKey, TValue>> p_init) {
+		reserve(p_init.size());
+		for (const KeyValue<TKey, TValue> &E : p_init) {
+			insert(E.key, E.value);
+		}
+	}
+
+	~OrderedHashMap() {
+		_destroy_elements();
+		if (elements) {
+			Memory::free_static(elements);
+			Memory::free_static(hashes);
+		}
+		for (uint32_t i = 0; i < page_count; i++) {
+			Memory::free_static(pages[i].slots);
+		}
+		if (pages) {
+			Memory::free_static(pages);
+		}
+		if (indices) {
+			Memory::free_static(indices);
+		}
+	}
+};
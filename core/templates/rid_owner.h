@@ -116,7 +116,42 @@ class RID_Alloc : public RID_AllocBase {
 
 	mutable Mutex mutex;
 
+	// In thread safe mode, only allocating and freeing take the mutex. Lookups are lock-free:
+	// chunks are never moved or freed while the owner is alive, `max_alloc` is published with
+	// release semantics after a new chunk is set up, and validators are published with release
+	// semantics once the element is constructed, so a matching validator implies valid data.
+	_FORCE_INLINE_ uint32_t _get_max_alloc() const {
+		if constexpr (THREAD_SAFE) {
+			return ((const std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_acquire);
+		} else {
+			return max_alloc;
+		}
+	}
+
+	_FORCE_INLINE_ static uint32_t _get_validator(const Chunk &p_chunk) {
+		if constexpr (THREAD_SAFE) {
+			return ((const std::atomic<uint32_t> *)&p_chunk.validator)->load(std::memory_order_acquire);
+		} else {
+			return p_chunk.validator;
+		}
+	}
+
+	_FORCE_INLINE_ static void _set_validator(Chunk &p_chunk, uint32_t p_validator) {
+		if constexpr (THREAD_SAFE) {
+			((std::atomic<uint32_t> *)&p_chunk.validator)->store(p_validator, std::memory_order_release);
+		} else {
+			p_chunk.validator = p_validator;
+		}
+	}
+
+	_FORCE_INLINE_ Chunk &_get_chunk(uint32_t p_index) const {
+		return chunks[p_index / elements_in_chunk][p_index % elements_in_chunk];
+	}
+
 	_FORCE_INLINE_ RID _allocate_rid() {
+		// Generate the validator before locking, it only needs the atomic counter.
+		const uint32_t validator = 1 + (uint32_t)(_gen_id() % 0x7FFFFFFF);
+
 		if constexpr (THREAD_SAFE) {
 			mutex.lock();
 		}
@@ -152,8 +187,8 @@ class RID_Alloc : public RID_AllocBase {
 			}
 
 			if constexpr (THREAD_SAFE) {
-				// Store atomically to avoid data race with the load in get_or_null().
-				((std::atomic<uint32_t> *)&max_alloc)->store(max_alloc + elements_in_chunk, std::memory_order_relaxed);
+				// Publish the new chunk to the lock-free lookups.
+				((std::atomic<uint32_t> *)&max_alloc)->store(max_alloc + elements_in_chunk, std::memory_order_release);
 			} else {
 				max_alloc += elements_in_chunk;
 			}
@@ -164,13 +199,11 @@ class RID_Alloc : public RID_AllocBase {
 		uint32_t free_chunk = free_index / elements_in_chunk;
 		uint32_t free_element = free_index % elements_in_chunk;
 
-		uint32_t validator = 1 + (uint32_t)(_gen_id() % 0x7FFFFFFF);
 		uint64_t id = validator;
 		id <<= 32;
 		id |= free_index;
 
-		chunks[free_chunk][free_element].validator = validator;
-		chunks[free_chunk][free_element].validator |= 0x80000000; //mark uninitialized bit
+		_set_validator(chunks[free_chunk][free_element], validator | 0x80000000); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -209,13 +242,7 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		uint32_t ma;
-		if constexpr (THREAD_SAFE) { // Read atomically to avoid data race with the store in _allocate_rid().
-			ma = ((std::atomic<uint32_t> *)&max_alloc)->load(std::memory_order_relaxed);
-		} else {
-			ma = max_alloc;
-		}
-		if (unlikely(idx >= ma)) {
+		if (unlikely(idx >= _get_max_alloc())) {
 			return nullptr;
 		}
 
@@ -241,19 +268,22 @@ public:
 #endif
 		}
 
+		const uint32_t current_validator = _get_validator(c);
+
 		if (unlikely(p_initialize)) {
-			if (unlikely(!(c.validator & 0x80000000))) {
+			if (unlikely(!(current_validator & 0x80000000))) {
 				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
 			}
 
-			if (unlikely((c.validator & 0x7FFFFFFF) != validator)) {
+			if (unlikely((current_validator & 0x7FFFFFFF) != validator)) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
 			}
 
-			c.validator &= 0x7FFFFFFF; //initialized
+			// The uninitialized bit is cleared by initialize_rid() once the data is constructed.
 
-		} else if (unlikely(c.validator != validator)) {
-			if ((c.validator & 0x80000000) && c.validator != 0xFFFFFFFF) {
+		} else if (unlikely(current_validator != validator)) {
+			// A stale RID may point to a slot that is being reused, only complain about this very RID.
+			if ((current_validator & 0x80000000) && current_validator != 0xFFFFFFFF && (current_validator & 0x7FFFFFFF) == validator) {
 				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
 			}
 			return nullptr;
@@ -287,6 +317,8 @@ public:
 #endif
 			SYNC_RELEASE;
 		}
+
+		_set_validator(_get_chunk(uint32_t(p_rid.get_id() & 0xFFFFFFFF)), uint32_t(p_rid.get_id() >> 32)); //initialized
 	}
 
 	void initialize_rid(RID p_rid, const T &p_value) {
@@ -307,34 +339,20 @@ public:
 #endif
 			SYNC_RELEASE;
 		}
+
+		_set_validator(_get_chunk(uint32_t(p_rid.get_id() & 0xFFFFFFFF)), uint32_t(p_rid.get_id() >> 32)); //initialized
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if constexpr (THREAD_SAFE) {
-			mutex.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				mutex.unlock();
-			}
+		if (unlikely(idx >= _get_max_alloc())) {
 			return false;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (chunks[idx_chunk][idx_element].validator & 0x7FFFFFFF) == validator;
-
-		if constexpr (THREAD_SAFE) {
-			mutex.unlock();
-		}
-
-		return owned;
+		return (_get_validator(_get_chunk(idx)) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -355,12 +373,13 @@ public:
 		uint32_t idx_element = idx % elements_in_chunk;
 
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(chunks[idx_chunk][idx_element].validator & 0x80000000)) {
+		const uint32_t current_validator = _get_validator(chunks[idx_chunk][idx_element]);
+		if (unlikely(current_validator & 0x80000000)) {
 			if constexpr (THREAD_SAFE) {
 				mutex.unlock();
 			}
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID");
-		} else if (unlikely(chunks[idx_chunk][idx_element].validator != validator)) {
+		} else if (unlikely(current_validator != validator)) {
 			if constexpr (THREAD_SAFE) {
 				mutex.unlock();
 			}
@@ -368,7 +387,7 @@ public:
 		}
 
 		chunks[idx_chunk][idx_element].data.~T();
-		chunks[idx_chunk][idx_element].validator = 0xFFFFFFFF; // go invalid
+		_set_validator(chunks[idx_chunk][idx_element], 0xFFFFFFFF); // go invalid
 
 		alloc_count--;
 		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
@@ -387,7 +406,7 @@ public:
 			mutex.lock();
 		}
 		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+			uint64_t validator = _get_validator(_get_chunk(i));
 			if (validator != 0xFFFFFFFF) {
 				owned.push_back(_make_from_id((validator << 32) | i));
 			}
@@ -405,7 +424,7 @@ public:
 		}
 		uint32_t idx = 0;
 		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = chunks[i / elements_in_chunk][i % elements_in_chunk].validator;
+			uint64_t validator = _get_validator(_get_chunk(i));
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -69,11 +69,62 @@ struct VariantCaster<T &> {
 	}
 };
 
+// Refcounted types stored as-is inside Variant. When a method takes one of them
+// by const reference, and the argument already holds that type, the method gets
+// a reference to the value inside the Variant instead of a copy.
+template <typename T>
+struct VariantCastByReference : std::false_type {};
+
+#define VARIANT_CAST_BY_REFERENCE(m_type) \
+	template <>                           \
+	struct VariantCastByReference<m_type> : std::true_type {};
+
+VARIANT_CAST_BY_REFERENCE(String)
+VARIANT_CAST_BY_REFERENCE(StringName)
+VARIANT_CAST_BY_REFERENCE(Array)
+VARIANT_CAST_BY_REFERENCE(Dictionary)
+VARIANT_CAST_BY_REFERENCE(PackedByteArray)
+VARIANT_CAST_BY_REFERENCE(PackedInt32Array)
+VARIANT_CAST_BY_REFERENCE(PackedInt64Array)
+VARIANT_CAST_BY_REFERENCE(PackedFloat32Array)
+VARIANT_CAST_BY_REFERENCE(PackedFloat64Array)
+VARIANT_CAST_BY_REFERENCE(PackedStringArray)
+VARIANT_CAST_BY_REFERENCE(PackedVector2Array)
+VARIANT_CAST_BY_REFERENCE(PackedVector3Array)
+VARIANT_CAST_BY_REFERENCE(PackedColorArray)
+VARIANT_CAST_BY_REFERENCE(PackedVector4Array)
+
+#undef VARIANT_CAST_BY_REFERENCE
+
+template <typename T>
+class VariantCastReference {
+	const T *ptr = nullptr;
+	T converted; // Only used if the Variant holds another type.
+
+public:
+	_FORCE_INLINE_ VariantCastReference(const Variant &p_variant) {
+		if (p_variant.get_type() == GetTypeInfo<T>::VARIANT_TYPE) {
+			ptr = VariantGetInternalPtr<T>::get_ptr(&p_variant);
+		} else {
+			converted = p_variant;
+			ptr = &converted;
+		}
+	}
+	VariantCastReference(const VariantCastReference &) = delete;
+	VariantCastReference &operator=(const VariantCastReference &) = delete;
+
+	_FORCE_INLINE_ operator const T &() const { return *ptr; }
+};
+
 template <typename T>
 struct VariantCaster<const T &> {
-	static _FORCE_INLINE_ T cast(const Variant &p_variant) {
+	using CastT = std::conditional_t<VariantCastByReference<T>::value, VariantCastReference<T>, T>;
+
+	static _FORCE_INLINE_ CastT cast(const Variant &p_variant) {
 		using TStripped = std::remove_pointer_t<T>;
-		if constexpr (std::is_base_of_v<Object, TStripped>) {
+		if constexpr (VariantCastByReference<T>::value) {
+			return VariantCastReference<T>(p_variant);
+		} else if constexpr (std::is_base_of_v<Object, TStripped>) {
 			return Object::cast_to<TStripped>(p_variant);
 		} else {
 			return p_variant;
@@ -200,7 +251,7 @@ struct VariantCasterAndValidate<T &> {
 
 template <typename T>
 struct VariantCasterAndValidate<const T &> {
-	static _FORCE_INLINE_ T cast(const Variant **p_args, uint32_t p_arg_idx, Callable::CallError &r_error) {
+	static _FORCE_INLINE_ typename VariantCaster<const T &>::CastT cast(const Variant **p_args, uint32_t p_arg_idx, Callable::CallError &r_error) {
 		Variant::Type argtype = GetTypeInfo<T>::VARIANT_TYPE;
 		if (!Variant::can_convert_strict(p_args[p_arg_idx]->get_type(), argtype) ||
 				!VariantObjectClassChecker<T>::check(*p_args[p_arg_idx])) {
@@ -209,7 +260,11 @@ struct VariantCasterAndValidate<const T &> {
 			r_error.expected = argtype;
 		}
 
-		return VariantCaster<T>::cast(*p_args[p_arg_idx]);
+		if constexpr (VariantCastByReference<T>::value) {
+			return VariantCaster<const T &>::cast(*p_args[p_arg_idx]);
+		} else {
+			return VariantCaster<T>::cast(*p_args[p_arg_idx]);
+		}
 	}
 };
 
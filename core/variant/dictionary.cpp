@@ -40,10 +40,30 @@
 #include "core/variant/type_info.h"
 #include "core/variant/variant_internal.h"
 
+// StringName keys are the most common ones when dictionaries are used as structs,
+// so hash and compare them directly instead of going through the generic Variant paths.
+struct DictionaryKeyHasher {
+	static _FORCE_INLINE_ uint32_t hash(const Variant &p_key) {
+		if (p_key.get_type() == Variant::STRING_NAME) {
+			return VariantInternal::get_string_name(&p_key)->hash();
+		}
+		return p_key.hash();
+	}
+};
+
+struct DictionaryKeyComparator {
+	static _FORCE_INLINE_ bool compare(const Variant &p_lhs, const Variant &p_rhs) {
+		if (p_lhs.get_type() == Variant::STRING_NAME && p_rhs.get_type() == Variant::STRING_NAME) {
+			return *VariantInternal::get_string_name(&p_lhs) == *VariantInternal::get_string_name(&p_rhs);
+		}
+		return StringLikeVariantComparator::compare(p_lhs, p_rhs);
+	}
+};
+
 struct DictionaryPrivate {
 	SafeRefCount refcount;
 	Variant *read_only = nullptr; // If enabled, a pointer is used to a temporary value that is used to return read-only values.
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map;
+	Dictionary::VariantMap variant_map;
 	ContainerTypeValidate typed_key;
 	ContainerTypeValidate typed_value;
 	Variant *typed_fallback = nullptr; // Allows a typed dictionary to return dummy values when attempting an invalid access.
@@ -68,27 +88,17 @@ LocalVector<Variant> Dictionary::get_key_list() const {
 }
 
 Variant Dictionary::get_key_at_index(int p_index) const {
-	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-		if (index == p_index) {
-			return E.key;
-		}
-		index++;
+	if (p_index < 0 || p_index >= (int)_p->variant_map.size()) {
+		return Variant();
 	}
-
-	return Variant();
+	return _p->variant_map.get_by_index(p_index).key;
 }
 
 Variant Dictionary::get_value_at_index(int p_index) const {
-	int index = 0;
-	for (const KeyValue<Variant, Variant> &E : _p->variant_map) {
-		if (index == p_index) {
-			return E.value;
-		}
-		index++;
+	if (p_index < 0 || p_index >= (int)_p->variant_map.size()) {
+		return Variant();
 	}
-
-	return Variant();
+	return _p->variant_map.get_by_index(p_index).value;
 }
 
 // WARNING: This operator does not validate the value type. For scripting/extensions this is
@@ -137,7 +147,7 @@ const Variant *Dictionary::getptr(const Variant &p_key) const {
 	if (unlikely(!_p->typed_key.validate(key, "getptr"))) {
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
+	VariantMap::ConstIterator E(_p->variant_map.find(key));
 	if (!E) {
 		return nullptr;
 	}
@@ -150,7 +160,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 	if (unlikely(!_p->typed_key.validate(key, "getptr"))) {
 		return nullptr;
 	}
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E(_p->variant_map.find(key));
+	VariantMap::Iterator E(_p->variant_map.find(key));
 	if (!E) {
 		return nullptr;
 	}
@@ -165,7 +175,7 @@ Variant *Dictionary::getptr(const Variant &p_key) {
 Variant Dictionary::get_valid(const Variant &p_key) const {
 	Variant key = p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "get_valid"), Variant());
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator E(_p->variant_map.find(key));
+	VariantMap::ConstIterator E(_p->variant_map.find(key));
 
 	if (!E) {
 		return Variant();
@@ -274,7 +284,7 @@ bool Dictionary::recursive_equal(const Dictionary &p_dictionary, int recursion_c
 	}
 	recursion_count++;
 	for (const KeyValue<Variant, Variant> &this_E : _p->variant_map) {
-		HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key));
+		VariantMap::ConstIterator other_E(p_dictionary._p->variant_map.find(this_E.key));
 		if (!other_E || !this_E.value.hash_compare(other_E->value, recursion_count, false)) {
 			return false;
 		}
@@ -432,7 +442,7 @@ void Dictionary::assign(const Dictionary &p_dictionary) {
 	}
 
 	int size = p_dictionary._p->variant_map.size();
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator> variant_map = HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>(size);
+	VariantMap variant_map = VariantMap(size);
 
 	Vector<Variant> key_array;
 	key_array.resize(size);
@@ -565,7 +575,7 @@ const Variant *Dictionary::next(const Variant *p_key) const {
 	}
 	Variant key = *p_key;
 	ERR_FAIL_COND_V(!_p->typed_key.validate(key, "next"), nullptr);
-	HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::Iterator E = _p->variant_map.find(key);
+	VariantMap::Iterator E = _p->variant_map.find(key);
 
 	if (!E) {
 		return nullptr;
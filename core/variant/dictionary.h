@@ -31,8 +31,8 @@
 #pragma once
 
 #include "core/string/ustring.h"
-#include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/ordered_hash_map.h"
 #include "core/templates/pair.h"
 #include "core/variant/array.h"
 #include "core/variant/variant_deep_duplicate.h"
@@ -41,9 +41,9 @@ class Variant;
 
 struct ContainerType;
 struct ContainerTypeValidate;
+struct DictionaryKeyComparator;
+struct DictionaryKeyHasher;
 struct DictionaryPrivate;
-struct StringLikeVariantComparator;
-struct VariantHasher;
 
 class Dictionary {
 	mutable DictionaryPrivate *_p;
@@ -52,7 +52,8 @@ class Dictionary {
 	void _unref() const;
 
 public:
-	using ConstIterator = HashMap<Variant, Variant, VariantHasher, StringLikeVariantComparator>::ConstIterator;
+	using VariantMap = OrderedHashMap<Variant, Variant, DictionaryKeyHasher, DictionaryKeyComparator>;
+	using ConstIterator = VariantMap::ConstIterator;
 
 	ConstIterator begin() const;
 	ConstIterator end() const;
@@ -44,7 +44,8 @@ struct PtrToArgDirect {
 	}
 	typedef T EncodeT;
 	_FORCE_INLINE_ static void encode(T p_val, void *p_ptr) {
-		*((T *)p_ptr) = p_val;
+		// Return values are usually temporaries, move them to avoid a refcount round trip.
+		*((T *)p_ptr) = std::move(p_val);
 	}
 };
 
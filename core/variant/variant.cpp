@@ -2377,6 +2377,11 @@ Variant::Variant(const String &p_string) :
 	static_assert(sizeof(String) <= sizeof(_data._mem));
 }
 
+Variant::Variant(String &&p_string) :
+		type(STRING) {
+	memnew_placement(_data._mem, String(std::move(p_string)));
+}
+
 Variant::Variant(const char *const p_cstring) :
 		type(STRING) {
 	memnew_placement(_data._mem, String((const char *)p_cstring));
@@ -2537,51 +2542,101 @@ Variant::Variant(const PackedByteArray &p_byte_array) :
 	_data.packed_array = PackedArrayRef<uint8_t>::create(p_byte_array);
 }
 
+Variant::Variant(PackedByteArray &&p_byte_array) :
+		type(PACKED_BYTE_ARRAY) {
+	_data.packed_array = PackedArrayRef<uint8_t>::create(std::move(p_byte_array));
+}
+
 Variant::Variant(const PackedInt32Array &p_int32_array) :
 		type(PACKED_INT32_ARRAY) {
 	_data.packed_array = PackedArrayRef<int32_t>::create(p_int32_array);
 }
 
+Variant::Variant(PackedInt32Array &&p_int32_array) :
+		type(PACKED_INT32_ARRAY) {
+	_data.packed_array = PackedArrayRef<int32_t>::create(std::move(p_int32_array));
+}
+
 Variant::Variant(const PackedInt64Array &p_int64_array) :
 		type(PACKED_INT64_ARRAY) {
 	_data.packed_array = PackedArrayRef<int64_t>::create(p_int64_array);
 }
 
+Variant::Variant(PackedInt64Array &&p_int64_array) :
+		type(PACKED_INT64_ARRAY) {
+	_data.packed_array = PackedArrayRef<int64_t>::create(std::move(p_int64_array));
+}
+
 Variant::Variant(const PackedFloat32Array &p_float32_array) :
 		type(PACKED_FLOAT32_ARRAY) {
 	_data.packed_array = PackedArrayRef<float>::create(p_float32_array);
 }
 
+Variant::Variant(PackedFloat32Array &&p_float32_array) :
+		type(PACKED_FLOAT32_ARRAY) {
+	_data.packed_array = PackedArrayRef<float>::create(std::move(p_float32_array));
+}
+
 Variant::Variant(const PackedFloat64Array &p_float64_array) :
 		type(PACKED_FLOAT64_ARRAY) {
 	_data.packed_array = PackedArrayRef<double>::create(p_float64_array);
 }
 
+Variant::Variant(PackedFloat64Array &&p_float64_array) :
+		type(PACKED_FLOAT64_ARRAY) {
+	_data.packed_array = PackedArrayRef<double>::create(std::move(p_float64_array));
+}
+
 Variant::Variant(const PackedStringArray &p_string_array) :
 		type(PACKED_STRING_ARRAY) {
 	_data.packed_array = PackedArrayRef<String>::create(p_string_array);
 }
 
+Variant::Variant(PackedStringArray &&p_string_array) :
+		type(PACKED_STRING_ARRAY) {
+	_data.packed_array = PackedArrayRef<String>::create(std::move(p_string_array));
+}
+
 Variant::Variant(const PackedVector2Array &p_vector2_array) :
 		type(PACKED_VECTOR2_ARRAY) {
 	_data.packed_array = PackedArrayRef<Vector2>::create(p_vector2_array);
 }
 
+Variant::Variant(PackedVector2Array &&p_vector2_array) :
+		type(PACKED_VECTOR2_ARRAY) {
+	_data.packed_array = PackedArrayRef<Vector2>::create(std::move(p_vector2_array));
+}
+
 Variant::Variant(const PackedVector3Array &p_vector3_array) :
 		type(PACKED_VECTOR3_ARRAY) {
 	_data.packed_array = PackedArrayRef<Vector3>::create(p_vector3_array);
 }
 
+Variant::Variant(PackedVector3Array &&p_vector3_array) :
+		type(PACKED_VECTOR3_ARRAY) {
+	_data.packed_array = PackedArrayRef<Vector3>::create(std::move(p_vector3_array));
+}
+
 Variant::Variant(const PackedColorArray &p_color_array) :
 		type(PACKED_COLOR_ARRAY) {
 	_data.packed_array = PackedArrayRef<Color>::create(p_color_array);
 }
 
+Variant::Variant(PackedColorArray &&p_color_array) :
+		type(PACKED_COLOR_ARRAY) {
+	_data.packed_array = PackedArrayRef<Color>::create(std::move(p_color_array));
+}
+
 Variant::Variant(const PackedVector4Array &p_vector4_array) :
 		type(PACKED_VECTOR4_ARRAY) {
 	_data.packed_array = PackedArrayRef<Vector4>::create(p_vector4_array);
 }
 
+Variant::Variant(PackedVector4Array &&p_vector4_array) :
+		type(PACKED_VECTOR4_ARRAY) {
+	_data.packed_array = PackedArrayRef<Vector4>::create(std::move(p_vector4_array));
+}
+
 /* helpers */
 Variant::Variant(const Vector<::RID> &p_array) :
 		type(ARRAY) {
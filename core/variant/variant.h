@@ -240,6 +240,9 @@ private:
 		static _FORCE_INLINE_ PackedArrayRef<T> *create(const Vector<T> &p_from) {
 			return memnew(PackedArrayRef<T>(p_from));
 		}
+		static _FORCE_INLINE_ PackedArrayRef<T> *create(Vector<T> &&p_from) {
+			return memnew(PackedArrayRef<T>(std::move(p_from)));
+		}
 
 		static _FORCE_INLINE_ const Vector<T> &get_array(PackedArrayRefBase *p_base) {
 			return static_cast<PackedArrayRef<T> *>(p_base)->array;
@@ -252,6 +255,10 @@ private:
 			array = p_from;
 			refcount.init();
 		}
+		_FORCE_INLINE_ PackedArrayRef(Vector<T> &&p_from) :
+				array(std::move(p_from)) {
+			refcount.init();
+		}
 		_FORCE_INLINE_ PackedArrayRef() {
 			refcount.init();
 		}
@@ -506,6 +513,7 @@ public:
 	Variant(double p_double);
 	Variant(const ObjectID &p_id);
 	Variant(const String &p_string);
+	Variant(String &&p_string);
 	Variant(const StringName &p_string);
 	Variant(const char *const p_cstring);
 	Variant(const char32_t *p_wstring);
@@ -544,6 +552,16 @@ public:
 	Variant(const PackedVector3Array &p_vector3_array);
 	Variant(const PackedColorArray &p_color_array);
 	Variant(const PackedVector4Array &p_vector4_array);
+	Variant(PackedByteArray &&p_byte_array);
+	Variant(PackedInt32Array &&p_int32_array);
+	Variant(PackedInt64Array &&p_int64_array);
+	Variant(PackedFloat32Array &&p_float32_array);
+	Variant(PackedFloat64Array &&p_float64_array);
+	Variant(PackedStringArray &&p_string_array);
+	Variant(PackedVector2Array &&p_vector2_array);
+	Variant(PackedVector3Array &&p_vector3_array);
+	Variant(PackedColorArray &&p_color_array);
+	Variant(PackedVector4Array &&p_vector4_array);
 
 	Variant(const Vector<::RID> &p_array); // helper
 	Variant(const Vector<Plane> &p_array); // helper
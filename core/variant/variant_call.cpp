@@ -1167,6 +1167,126 @@ struct _VariantCall {
 		return ret;
 	}
 
+	// Element-wise math on packed arrays. The loops only touch raw pointers
+	// so the compiler can vectorize them.
+
+	// Scalar type used to scale elements: the element type itself for float arrays, real_t for vector arrays.
+	template <typename T>
+	using PackedMathScalar = std::conditional_t<std::is_arithmetic_v<T>, T, real_t>;
+
+	_FORCE_INLINE_ static float packed_math_min(float p_a, float p_b) { return MIN(p_a, p_b); }
+	_FORCE_INLINE_ static double packed_math_min(double p_a, double p_b) { return MIN(p_a, p_b); }
+	_FORCE_INLINE_ static Vector2 packed_math_min(const Vector2 &p_a, const Vector2 &p_b) { return p_a.min(p_b); }
+	_FORCE_INLINE_ static Vector3 packed_math_min(const Vector3 &p_a, const Vector3 &p_b) { return p_a.min(p_b); }
+	_FORCE_INLINE_ static float packed_math_max(float p_a, float p_b) { return MAX(p_a, p_b); }
+	_FORCE_INLINE_ static double packed_math_max(double p_a, double p_b) { return MAX(p_a, p_b); }
+	_FORCE_INLINE_ static Vector2 packed_math_max(const Vector2 &p_a, const Vector2 &p_b) { return p_a.max(p_b); }
+	_FORCE_INLINE_ static Vector3 packed_math_max(const Vector3 &p_a, const Vector3 &p_b) { return p_a.max(p_b); }
+
+	template <typename T, typename F>
+	_FORCE_INLINE_ static Vector<T> packed_math_binary(const Vector<T> &p_a, const Vector<T> &p_b, F p_op) {
+		Vector<T> dest;
+		ERR_FAIL_COND_V_MSG(p_a.size() != p_b.size(), dest, vformat("Packed arrays must have the same size (%d != %d).", p_a.size(), p_b.size()));
+		dest.resize(p_a.size());
+		const T *a = p_a.ptr();
+		const T *b = p_b.ptr();
+		T *w = dest.ptrw();
+		const int64_t size = dest.size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = p_op(a[i], b[i]);
+		}
+		return dest;
+	}
+
+	template <typename T, typename F>
+	_FORCE_INLINE_ static Vector<T> packed_math_unary(const Vector<T> &p_a, F p_op) {
+		Vector<T> dest;
+		dest.resize(p_a.size());
+		const T *a = p_a.ptr();
+		T *w = dest.ptrw();
+		const int64_t size = dest.size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = p_op(a[i]);
+		}
+		return dest;
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_add(Vector<T> *p_instance, const Vector<T> &p_array) {
+		return packed_math_binary(*p_instance, p_array, [](const T &p_a, const T &p_b) { return p_a + p_b; });
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_subtract(Vector<T> *p_instance, const Vector<T> &p_array) {
+		return packed_math_binary(*p_instance, p_array, [](const T &p_a, const T &p_b) { return p_a - p_b; });
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_multiply(Vector<T> *p_instance, const Vector<T> &p_array) {
+		return packed_math_binary(*p_instance, p_array, [](const T &p_a, const T &p_b) { return p_a * p_b; });
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_scale(Vector<T> *p_instance, double p_factor) {
+		const PackedMathScalar<T> factor = p_factor;
+		return packed_math_unary(*p_instance, [factor](const T &p_a) { return p_a * factor; });
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_fma(Vector<T> *p_instance, double p_factor, const Vector<T> &p_addend) {
+		const PackedMathScalar<T> factor = p_factor;
+		return packed_math_binary(*p_instance, p_addend, [factor](const T &p_a, const T &p_b) { return p_a * factor + p_b; });
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_lerp(Vector<T> *p_instance, const Vector<T> &p_to, double p_weight) {
+		const PackedMathScalar<T> weight = p_weight;
+		return packed_math_binary(*p_instance, p_to, [weight](const T &p_a, const T &p_b) { return p_a + (p_b - p_a) * weight; });
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_clamp(Vector<T> *p_instance, T p_min, T p_max) {
+		return packed_math_unary(*p_instance, [p_min, p_max](const T &p_a) { return packed_math_min(packed_math_max(p_a, p_min), p_max); });
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_min(Vector<T> *p_instance, const Vector<T> &p_array) {
+		return packed_math_binary(*p_instance, p_array, [](const T &p_a, const T &p_b) { return packed_math_min(p_a, p_b); });
+	}
+
+	template <typename T>
+	static Vector<T> func_packed_array_max(Vector<T> *p_instance, const Vector<T> &p_array) {
+		return packed_math_binary(*p_instance, p_array, [](const T &p_a, const T &p_b) { return packed_math_max(p_a, p_b); });
+	}
+
+	template <typename T>
+	static double func_packed_float_array_dot(Vector<T> *p_instance, const Vector<T> &p_array) {
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_array.size(), 0.0, vformat("Packed arrays must have the same size (%d != %d).", p_instance->size(), p_array.size()));
+		const T *a = p_instance->ptr();
+		const T *b = p_array.ptr();
+		const int64_t size = p_instance->size();
+		double sum = 0.0;
+		for (int64_t i = 0; i < size; i++) {
+			sum += double(a[i]) * double(b[i]);
+		}
+		return sum;
+	}
+
+	template <typename T>
+	static PackedFloat64Array func_packed_vector_array_dot(Vector<T> *p_instance, const Vector<T> &p_array) {
+		PackedFloat64Array dest;
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_array.size(), dest, vformat("Packed arrays must have the same size (%d != %d).", p_instance->size(), p_array.size()));
+		dest.resize(p_instance->size());
+		const T *a = p_instance->ptr();
+		const T *b = p_array.ptr();
+		double *w = dest.ptrw();
+		const int64_t size = dest.size();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = a[i].dot(b[i]);
+		}
+		return dest;
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -2711,6 +2831,16 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
 	bind_method(PackedFloat32Array, erase, sarray("value"), varray());
+	bind_function(PackedFloat32Array, add, _VariantCall::func_packed_array_add<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, subtract, _VariantCall::func_packed_array_subtract<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, multiply, _VariantCall::func_packed_array_multiply<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, scale, _VariantCall::func_packed_array_scale<float>, sarray("factor"), varray());
+	bind_function(PackedFloat32Array, fma, _VariantCall::func_packed_array_fma<float>, sarray("factor", "addend"), varray());
+	bind_function(PackedFloat32Array, lerp, _VariantCall::func_packed_array_lerp<float>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat32Array, clamp, _VariantCall::func_packed_array_clamp<float>, sarray("min", "max"), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_packed_array_min<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_packed_array_max<float>, sarray("array"), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_packed_float_array_dot<float>, sarray("array"), varray());
 
 	/* Float64 Array */
 
@@ -2735,6 +2865,16 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
 	bind_method(PackedFloat64Array, erase, sarray("value"), varray());
+	bind_function(PackedFloat64Array, add, _VariantCall::func_packed_array_add<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, subtract, _VariantCall::func_packed_array_subtract<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, multiply, _VariantCall::func_packed_array_multiply<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, scale, _VariantCall::func_packed_array_scale<double>, sarray("factor"), varray());
+	bind_function(PackedFloat64Array, fma, _VariantCall::func_packed_array_fma<double>, sarray("factor", "addend"), varray());
+	bind_function(PackedFloat64Array, lerp, _VariantCall::func_packed_array_lerp<double>, sarray("to", "weight"), varray());
+	bind_function(PackedFloat64Array, clamp, _VariantCall::func_packed_array_clamp<double>, sarray("min", "max"), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_packed_array_min<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_packed_array_max<double>, sarray("array"), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_packed_float_array_dot<double>, sarray("array"), varray());
 
 	/* String Array */
 
@@ -2783,6 +2923,16 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector2Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector2Array, count, sarray("value"), varray());
 	bind_method(PackedVector2Array, erase, sarray("value"), varray());
+	bind_function(PackedVector2Array, add, _VariantCall::func_packed_array_add<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, subtract, _VariantCall::func_packed_array_subtract<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, multiply, _VariantCall::func_packed_array_multiply<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, scale, _VariantCall::func_packed_array_scale<Vector2>, sarray("factor"), varray());
+	bind_function(PackedVector2Array, fma, _VariantCall::func_packed_array_fma<Vector2>, sarray("factor", "addend"), varray());
+	bind_function(PackedVector2Array, lerp, _VariantCall::func_packed_array_lerp<Vector2>, sarray("to", "weight"), varray());
+	bind_function(PackedVector2Array, clamp, _VariantCall::func_packed_array_clamp<Vector2>, sarray("min", "max"), varray());
+	bind_function(PackedVector2Array, min, _VariantCall::func_packed_array_min<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, max, _VariantCall::func_packed_array_max<Vector2>, sarray("array"), varray());
+	bind_function(PackedVector2Array, dot, _VariantCall::func_packed_vector_array_dot<Vector2>, sarray("array"), varray());
 
 	/* Vector3 Array */
 
@@ -2807,6 +2957,16 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
 	bind_method(PackedVector3Array, erase, sarray("value"), varray());
+	bind_function(PackedVector3Array, add, _VariantCall::func_packed_array_add<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, subtract, _VariantCall::func_packed_array_subtract<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, multiply, _VariantCall::func_packed_array_multiply<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, scale, _VariantCall::func_packed_array_scale<Vector3>, sarray("factor"), varray());
+	bind_function(PackedVector3Array, fma, _VariantCall::func_packed_array_fma<Vector3>, sarray("factor", "addend"), varray());
+	bind_function(PackedVector3Array, lerp, _VariantCall::func_packed_array_lerp<Vector3>, sarray("to", "weight"), varray());
+	bind_function(PackedVector3Array, clamp, _VariantCall::func_packed_array_clamp<Vector3>, sarray("min", "max"), varray());
+	bind_function(PackedVector3Array, min, _VariantCall::func_packed_array_min<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, max, _VariantCall::func_packed_array_max<Vector3>, sarray("array"), varray());
+	bind_function(PackedVector3Array, dot, _VariantCall::func_packed_vector_array_dot<Vector3>, sarray("array"), varray());
 
 	/* Color Array */
 
@@ -158,6 +158,42 @@ static double stor_fix(const String &p_str) {
 	return -1;
 }
 
+// Scans the rest of a number whose first digit was already read, following the same rules as get_token().
+// Fails if the number doesn't end within `p_available` characters.
+static bool _scan_number(const char32_t *p_chars, uint32_t p_available, uint32_t &r_len, bool &r_is_float) {
+	uint32_t i = 0;
+	bool is_float = false;
+
+	while (i < p_available && is_digit(p_chars[i])) {
+		i++;
+	}
+	if (i < p_available && p_chars[i] == '.') {
+		is_float = true;
+		i++;
+		while (i < p_available && is_digit(p_chars[i])) {
+			i++;
+		}
+	}
+	if (i < p_available && (p_chars[i] == 'e' || p_chars[i] == 'E')) {
+		is_float = true;
+		i++;
+		if (i < p_available && (p_chars[i] == '-' || p_chars[i] == '+')) {
+			i++;
+		}
+		while (i < p_available && is_digit(p_chars[i])) {
+			i++;
+		}
+	}
+
+	if (i >= p_available) {
+		return false;
+	}
+
+	r_len = i;
+	r_is_float = is_float;
+	return true;
+}
+
 Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, String &r_err_str) {
 	bool string_name = false;
 
@@ -423,6 +459,27 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 				}
 				if (cchar >= '0' && cchar <= '9') {
 					//a number
+					{
+						// Fast path, when the whole number is already read ahead.
+						uint32_t available = 0;
+						const char32_t *ahead = p_stream->get_readahead(available);
+						uint32_t len = 0;
+						bool is_float = false;
+						if (_scan_number(ahead, available, len, is_float)) {
+							token_text += cchar;
+							token_text.append(ahead, len);
+							p_stream->skip_readahead(len);
+
+							r_token.type = TK_NUMBER;
+							if (is_float) {
+								r_token.value = token_text.as_double();
+							} else {
+								r_token.value = token_text.as_int();
+							}
+							return OK;
+						}
+					}
+
 #define READING_SIGN 0
 #define READING_INT 1
 #define READING_DEC 2
@@ -491,6 +548,25 @@ Error VariantParser::get_token(Stream *p_stream, Token &r_token, int &line, Stri
 					}
 					return OK;
 				} else if (is_ascii_alphabet_char(cchar) || is_underscore(cchar)) {
+					{
+						// Fast path, when the whole identifier is already read ahead.
+						uint32_t available = 0;
+						const char32_t *ahead = p_stream->get_readahead(available);
+						uint32_t len = 0;
+						while (len < available && (is_ascii_alphabet_char(ahead[len]) || is_underscore(ahead[len]) || is_digit(ahead[len]))) {
+							len++;
+						}
+						if (len < available) {
+							token_text += cchar;
+							token_text.append(ahead, len);
+							p_stream->skip_readahead(len);
+
+							r_token.type = TK_IDENTIFIER;
+							r_token.value = token_text.as_string();
+							return OK;
+						}
+					}
+
 					bool first = true;
 
 					while (is_ascii_alphabet_char(cchar) || is_underscore(cchar) || (!first && is_digit(cchar))) {
@@ -548,6 +624,59 @@ Error VariantParser::_parse_enginecfg(Stream *p_stream, Vector<String> &strings,
 	}
 }
 
+// Reads a constructor element of the common form "number," or "number)" straight from the read ahead characters.
+// Nothing is consumed when the element isn't fully read ahead or has another form, get_token() handles those.
+template <typename T>
+static bool _parse_construct_element_fast(VariantParser::Stream *p_stream, int &line, T &r_value, bool &r_closed) {
+	uint32_t available = 0;
+	const char32_t *ahead = p_stream->get_readahead(available);
+
+	uint32_t i = 0;
+	int lines = 0;
+	while (i < available && ahead[i] != 0 && ahead[i] <= 32) {
+		lines += ahead[i] == '\n';
+		i++;
+	}
+
+	const uint32_t start = i;
+	if (i < available && ahead[i] == '-') {
+		i++;
+	}
+	if (i >= available || !is_digit(ahead[i])) {
+		return false;
+	}
+
+	uint32_t len = 0;
+	bool is_float = false;
+	if (!_scan_number(ahead + i + 1, available - i - 1, len, is_float)) {
+		return false;
+	}
+	const uint32_t end = i + 1 + len;
+
+	i = end;
+	while (i < available && ahead[i] != 0 && ahead[i] <= 32) {
+		lines += ahead[i] == '\n';
+		i++;
+	}
+	if (i >= available || (ahead[i] != ',' && ahead[i] != ')')) {
+		return false;
+	}
+
+	// Same conversions as get_token() followed by the Variant conversion.
+	StringBuffer<> number_text;
+	number_text.append(ahead + start, end - start);
+	if (is_float) {
+		r_value = T(number_text.as_double());
+	} else {
+		r_value = T(number_text.as_int());
+	}
+
+	r_closed = ahead[i] == ')';
+	p_stream->skip_readahead(i + 1);
+	line += lines;
+	return true;
+}
+
 template <typename T>
 Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct, int &line, String &r_err_str) {
 	Token token;
@@ -557,6 +686,8 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 		return ERR_PARSE_ERROR;
 	}
 
+	LocalVector<T> values;
+
 	bool first = true;
 	while (true) {
 		if (!first) {
@@ -570,6 +701,20 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 				return ERR_PARSE_ERROR;
 			}
 		}
+
+		bool closed = false;
+		T fast_value;
+		while (_parse_construct_element_fast(p_stream, line, fast_value, closed)) {
+			values.push_back(fast_value);
+			first = false;
+			if (closed) {
+				break;
+			}
+		}
+		if (closed) {
+			break;
+		}
+
 		get_token(p_stream, token, line, r_err_str);
 
 		if (first && token.type == TK_PARENTHESIS_CLOSE) {
@@ -590,10 +735,17 @@ Error VariantParser::_parse_construct(Stream *p_stream, Vector<T> &r_construct,
 			}
 		}
 
-		r_construct.push_back(token.value);
+		values.push_back(token.value);
 		first = false;
 	}
 
+	const int64_t ofs = r_construct.size();
+	r_construct.resize(ofs + values.size());
+	T *w = r_construct.ptrw();
+	for (uint32_t i = 0; i < values.size(); i++) {
+		w[ofs + i] = values[i];
+	}
+
 	return OK;
 }
 
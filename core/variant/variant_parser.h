@@ -56,6 +56,15 @@ public:
 		virtual bool is_utf8() const = 0;
 		bool is_eof() const;
 
+		// Direct access to the characters already read ahead, so simple tokens can be scanned without a call per character.
+		_FORCE_INLINE_ const char32_t *get_readahead(uint32_t &r_available) const {
+			r_available = (saved == 0 && readahead_pointer < readahead_filled) ? readahead_filled - readahead_pointer : 0;
+			return readahead_buffer + readahead_pointer;
+		}
+		_FORCE_INLINE_ void skip_readahead(uint32_t p_chars) {
+			readahead_pointer += p_chars;
+		}
+
 		Stream() {}
 		virtual ~Stream() {}
 	};
@@ -36,6 +36,7 @@
 #include "core/string/print_string.h"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
@@ -171,6 +172,11 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	for (const Mapping &mapping : mappings) {
+		munmap(mapping.address, mapping.size);
+	}
+	mappings.clear();
+
 	fclose(f);
 	f = nullptr;
 
@@ -276,6 +282,38 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return read;
 }
 
+Span<uint8_t> FileAccessUnix::get_buffer_mapped(uint64_t p_length) const {
+	ERR_FAIL_NULL_V_MSG(f, Span<uint8_t>(), "File must be opened before use.");
+
+	// Only files opened read-only are mapped, so writes can't change the data behind a returned span.
+	if (flags != READ || !p_length) {
+		return Span<uint8_t>();
+	}
+
+	const uint64_t position = get_position();
+	const uint64_t length = get_length();
+	if (position > length || p_length > length - position) {
+		return Span<uint8_t>();
+	}
+
+	// Mappings have to start on a page boundary.
+	static const uint64_t page_size = sysconf(_SC_PAGESIZE);
+	const uint64_t map_offset = position - position % page_size;
+	const size_t map_size = position - map_offset + p_length;
+
+	void *address = mmap(nullptr, map_size, PROT_READ, MAP_PRIVATE, fileno(f), map_offset);
+	if (address == MAP_FAILED) {
+		return Span<uint8_t>();
+	}
+	mappings.push_back({ address, map_size });
+
+	if (fseeko(f, position + p_length, SEEK_SET)) {
+		check_errors();
+	}
+
+	return Span<uint8_t>(static_cast<const uint8_t *>(address) + (position - map_offset), p_length);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
@@ -32,6 +32,7 @@
 
 #include "core/io/file_access.h"
 #include "core/os/memory.h"
+#include "core/templates/local_vector.h"
 
 #include <cstdio>
 
@@ -47,6 +48,12 @@ class FileAccessUnix : public FileAccess {
 	String path;
 	String path_src;
 
+	struct Mapping {
+		void *address = nullptr;
+		size_t size = 0;
+	};
+	mutable LocalVector<Mapping> mappings;
+
 	void _close();
 
 #if defined(TOOLS_ENABLED)
@@ -71,6 +78,7 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_buffer_mapped(uint64_t p_length) const override;
 
 	virtual Error get_error() const override; ///< get last error
 
@@ -45,6 +45,7 @@
 #include "editor/script/script_editor_plugin.h"
 #include "editor/settings/editor_settings.h"
 #include "editor/settings/project_settings_editor.h"
+#include "main/main.h"
 #include "scene/resources/packed_scene.h"
 
 EditorFileSystem *EditorFileSystem::singleton = nullptr;
@@ -2895,7 +2896,26 @@ Error EditorFileSystem::_reimport_file(const String &p_file, const HashMap<Strin
 	List<String> import_variants;
 	List<String> gen_files;
 	Variant meta;
-	Error err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+	Error err = FAILED;
+
+	// Reuse the result of an identical import if it's in the shared import cache.
+	String cache_key;
+	if (import_cache.is_enabled() && importer->can_cache_import(params)) {
+		cache_key = import_cache.get_key(p_file, uid, importer, opts, params);
+		if (!cache_key.is_empty() && import_cache.restore(cache_key, base_path, &import_variants, &meta)) {
+			err = OK;
+		}
+	}
+
+	if (err != OK) {
+		uint64_t import_start_usec = OS::get_singleton()->get_ticks_usec();
+		err = importer->import(uid, p_file, base_path, params, &import_variants, &gen_files, &meta);
+
+		// Files generated outside the imported directory can't be restored from the cache.
+		if (err == OK && !cache_key.is_empty() && gen_files.is_empty()) {
+			import_cache.store(cache_key, base_path, importer->get_save_extension(), import_variants, meta, OS::get_singleton()->get_ticks_usec() - import_start_usec);
+		}
+	}
 
 	// As import is complete, save the .import file.
 
@@ -3194,19 +3214,98 @@ void EditorFileSystem::_refresh_filesystem() {
 
 void EditorFileSystem::_reimport_thread(uint32_t p_index, ImportThreadData *p_import_data) {
 	ResourceLoader::set_is_import_thread(true);
-	int file_idx = p_import_data->reimport_from + int(p_index);
-	_reimport_file(p_import_data->reimport_files[file_idx].path);
+	ImportFile &file = p_import_data->reimport_files[p_import_data->file_indices[p_index]];
+	uint64_t start_usec = OS::get_singleton()->get_ticks_usec();
+	_reimport_file(file.path);
+	file.import_usec = OS::get_singleton()->get_ticks_usec() - start_usec;
 	ResourceLoader::set_is_import_thread(false);
 
 	p_import_data->imported_sem->post();
 }
 
+void EditorFileSystem::get_import_stages(const Vector<ImportFile> &p_files, const HashSet<String> &p_skip_files, bool p_use_threads, LocalVector<ImportStage> &r_stages) {
+	r_stages.clear();
+
+	// Files are sorted by import order, and files of a later order may depend on the ones before it,
+	// so each order gets a stage of its own.
+	int level_from = 0;
+	while (level_from < p_files.size()) {
+		int level_to = level_from + 1;
+		while (level_to < p_files.size() && p_files[level_to].order == p_files[level_from].order) {
+			level_to++;
+		}
+
+		ImportStage stage;
+		for (int i = level_from; i < level_to; i++) {
+			if (p_skip_files.has(p_files[i].path)) {
+				continue;
+			}
+			if (p_use_threads && p_files[i].threaded) {
+				stage.threaded_files.push_back(i);
+			} else {
+				stage.main_thread_files.push_back(i);
+			}
+		}
+		level_from = level_to;
+
+		if (stage.threaded_files.size() == 1) {
+			// Single file, do not use threads.
+			stage.main_thread_files.push_back(stage.threaded_files[0]);
+			stage.main_thread_files.sort();
+			stage.threaded_files.clear();
+		}
+
+		if (!stage.threaded_files.is_empty() || !stage.main_thread_files.is_empty()) {
+			r_stages.push_back(stage);
+		}
+	}
+}
+
+String EditorFileSystem::get_import_times_report(const Vector<ImportFile> &p_files, uint64_t p_total_usec) {
+	if (p_files.is_empty()) {
+		return String();
+	}
+
+	struct ImporterTime {
+		String importer;
+		int file_count = 0;
+		uint64_t usec = 0;
+
+		bool operator<(const ImporterTime &p_other) const {
+			return usec == p_other.usec ? importer < p_other.importer : usec > p_other.usec;
+		}
+	};
+
+	HashMap<String, int> importer_indices;
+	LocalVector<ImporterTime> importer_times;
+	for (const ImportFile &file : p_files) {
+		int *idx = importer_indices.getptr(file.importer);
+		if (!idx) {
+			idx = &importer_indices.insert(file.importer, importer_times.size())->value;
+			importer_times.push_back(ImporterTime());
+			importer_times[*idx].importer = file.importer;
+		}
+		importer_times[*idx].file_count++;
+		importer_times[*idx].usec += file.import_usec;
+	}
+	importer_times.sort();
+
+	String report = vformat("Imported %d files in %.2f s.", p_files.size(), p_total_usec / 1000000.0);
+	for (const ImporterTime &E : importer_times) {
+		report += vformat("\n  %s: %d files, %.2f s.", E.importer, E.file_count, E.usec / 1000000.0);
+	}
+	return report;
+}
+
 void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	ERR_FAIL_COND_MSG(importing, "Attempted to call reimport_files() recursively, this is not allowed.");
 	importing = true;
 
 	Vector<String> reloads;
 
+	import_cache.set_cache_dir(EDITOR_GET("filesystem/import/shared_cache_path"));
+	import_cache.reset_stats();
+
 	EditorProgress *ep = memnew(EditorProgress("reimport", TTR("(Re)Importing Assets"), p_files.size()));
 
 	// The method reimport_files runs on the main thread, and if VSync is enabled
@@ -3276,74 +3375,77 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	bool use_multiple_threads = false;
 #endif
 
-	int from = 0;
-	Semaphore imported_sem;
-	for (int i = 0; i < reimport_files.size(); i++) {
-		if (groups_to_reimport.has(reimport_files[i].path)) {
-			from = i + 1;
-			continue;
-		}
-
-		if (use_multiple_threads && reimport_files[i].threaded) {
-			if (i + 1 == reimport_files.size() || reimport_files[i + 1].importer != reimport_files[from].importer || groups_to_reimport.has(reimport_files[i + 1].path)) {
-				if (from - i == 0) {
-					// Single file, do not use threads.
-					ep->step(reimport_files[i].path.get_file(), i, false);
-					_reimport_file(reimport_files[i].path);
-				} else {
-					Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(reimport_files[from].importer);
-					if (importer.is_null()) {
-						ERR_PRINT(vformat("Invalid importer for \"%s\".", reimport_files[from].importer));
-						from = i + 1;
-						continue;
-					}
-
-					importer->import_threaded_begin();
-
-					ImportThreadData tdata;
-					tdata.reimport_from = from;
-					tdata.reimport_files = reimport_files.ptr();
-					tdata.imported_sem = &imported_sem;
+	LocalVector<ImportStage> stages;
+	get_import_stages(reimport_files, groups_to_reimport, use_multiple_threads, stages);
 
-					int item_count = i - from + 1;
-					WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, item_count, -1, false, vformat(TTR("Import resources of type: %s"), reimport_files[from].importer));
+	ImportFile *files = reimport_files.ptrw();
+	const uint64_t import_start_usec = OS::get_singleton()->get_ticks_usec();
+	int imported_count = 0;
+	Semaphore imported_sem;
+	for (const ImportStage &stage : stages) {
+		// Files of all the importers that can import in threads are imported in a single group task.
+		if (!stage.threaded_files.is_empty()) {
+			LocalVector<Ref<ResourceImporter>> threaded_importers;
+			HashSet<String> importer_names;
+			for (int idx : stage.threaded_files) {
+				if (importer_names.has(files[idx].importer)) {
+					continue;
+				}
+				importer_names.insert(files[idx].importer);
 
-					int imported_count = 0;
-					while (true) {
-						while (true) {
-							ep->step(reimport_files[imported_count].path.get_file(), from + imported_count, false);
-							if (imported_sem.try_wait()) {
-								imported_count++;
-								break;
-							}
-						}
-						if (imported_count == item_count) {
-							break;
-						}
-					}
+				Ref<ResourceImporter> importer = ResourceFormatImporter::get_singleton()->get_importer_by_name(files[idx].importer);
+				if (importer.is_null()) {
+					ERR_PRINT(vformat("Invalid importer for \"%s\".", files[idx].importer));
+					continue;
+				}
+				importer->import_threaded_begin();
+				threaded_importers.push_back(importer);
+			}
 
-					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
-					DEV_ASSERT(!imported_sem.try_wait());
+			ImportThreadData tdata;
+			tdata.reimport_files = files;
+			tdata.file_indices = stage.threaded_files.ptr();
+			tdata.imported_sem = &imported_sem;
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &EditorFileSystem::_reimport_thread, &tdata, stage.threaded_files.size(), -1, false, TTR("Import resources"));
 
-					importer->import_threaded_end();
+			uint32_t threaded_imported_count = 0;
+			while (threaded_imported_count < stage.threaded_files.size()) {
+				ep->step(files[stage.threaded_files[threaded_imported_count]].path.get_file(), imported_count, false);
+				if (imported_sem.try_wait()) {
+					threaded_imported_count++;
+					imported_count++;
 				}
+			}
+
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			DEV_ASSERT(!imported_sem.try_wait());
 
-				from = i + 1;
+			for (const Ref<ResourceImporter> &importer : threaded_importers) {
+				importer->import_threaded_end();
 			}
+		}
 
-		} else {
-			ep->step(reimport_files[i].path.get_file(), i, false);
-			_reimport_file(reimport_files[i].path);
+		// Importers that can't import in threads (including import plugins) may share state with anything,
+		// so they only run once the threaded files are done.
+		for (int idx : stage.main_thread_files) {
+			ep->step(files[idx].path.get_file(), imported_count++, false);
+			uint64_t file_start_usec = OS::get_singleton()->get_ticks_usec();
+			_reimport_file(files[idx].path);
+			files[idx].import_usec = OS::get_singleton()->get_ticks_usec() - file_start_usec;
+		}
+	}
 
-			// We need to increment the counter, maybe the next file is multithreaded
-			// and doesn't have the same importer.
-			from = i + 1;
+	// The times are mostly interesting when importing from the command line, e.g. in CI.
+	if (Main::is_cmdline_tool() || is_print_verbose_enabled()) {
+		const String import_times = get_import_times_report(reimport_files, OS::get_singleton()->get_ticks_usec() - import_start_usec);
+		if (!import_times.is_empty()) {
+			print_line(import_times);
 		}
 	}
 
 	// Reimport groups.
 
-	from = reimport_files.size();
+	int from = reimport_files.size();
 
 	if (groups_to_reimport.size()) {
 		HashMap<String, Vector<String>> group_files;
@@ -3363,6 +3465,16 @@ void EditorFileSystem::reimport_files(const Vector<String> &p_files) {
 	ResourceUID::get_singleton()->update_cache(); // After reimporting, update the cache.
 	_save_filesystem_cache();
 
+	const uint32_t cache_lookups = import_cache.get_hits() + import_cache.get_misses();
+	if (cache_lookups > 0) {
+		String cache_stats = vformat("Import cache: %d of %d files restored (%d%% hit rate), saved %.1f s of import time.", import_cache.get_hits(), cache_lookups, import_cache.get_hits() * 100 / cache_lookups, import_cache.get_saved_usec() / 1000000.0);
+		if (Main::is_cmdline_tool()) {
+			print_line(cache_stats);
+		} else {
+			print_verbose(cache_stats);
+		}
+	}
+
 	memdelete_notnull(ep);
 
 	_process_update_pending();
@@ -37,6 +37,7 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/safe_refcount.h"
+#include "editor/file_system/editor_import_cache.h"
 #include "scene/main/node.h"
 
 class FileAccess;
@@ -186,6 +187,7 @@ class EditorFileSystem : public Node {
 	bool filesystem_changed_queued = false;
 	bool scanning = false;
 	bool importing = false;
+	EditorImportCache import_cache;
 	bool first_scan = true;
 	bool scan_changes_pending = false;
 	float scan_total;
@@ -286,16 +288,30 @@ class EditorFileSystem : public Node {
 
 	Vector<String> _get_dependencies(const String &p_path);
 
+public:
 	struct ImportFile {
 		String path;
 		String importer;
 		bool threaded = false;
 		int order = 0;
+		uint64_t import_usec = 0;
 		bool operator<(const ImportFile &p_if) const {
 			return order == p_if.order ? (importer < p_if.importer) : (order < p_if.order);
 		}
 	};
 
+	// Files of one import order, as indices into the sorted file list. The threaded files are imported
+	// together first, then the main thread files one by one, with no other import running.
+	struct ImportStage {
+		LocalVector<int> threaded_files;
+		LocalVector<int> main_thread_files;
+	};
+
+	static void get_import_stages(const Vector<ImportFile> &p_files, const HashSet<String> &p_skip_files, bool p_use_threads, LocalVector<ImportStage> &r_stages);
+	static String get_import_times_report(const Vector<ImportFile> &p_files, uint64_t p_total_usec);
+
+private:
+
 	struct ScriptClassInfoUpdate : public ScriptClassInfo {
 		StringName type;
 		ScriptClassInfoUpdate() = default;
@@ -353,8 +369,8 @@ class EditorFileSystem : public Node {
 	void _refresh_filesystem();
 
 	struct ImportThreadData {
-		const ImportFile *reimport_files;
-		int reimport_from;
+		ImportFile *reimport_files = nullptr;
+		const int *file_indices = nullptr;
 		Semaphore *imported_sem = nullptr;
 	};
 
@@ -0,0 +1,194 @@
+/**************************************************************************/
+/*  editor_import_cache.cpp                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "editor_import_cache.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/config_file.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+#include "core/variant/variant_parser.h"
+#include "core/version.h"
+
+String EditorImportCache::_get_entry_dir(const String &p_key) const {
+	// Spread entries over subdirectories, so no single directory gets too large.
+	return cache_dir.path_join(p_key.substr(0, 2)).path_join(p_key);
+}
+
+void EditorImportCache::set_cache_dir(const String &p_dir) {
+	cache_dir = String();
+	if (p_dir.is_empty()) {
+		return;
+	}
+
+	String dir = ProjectSettings::get_singleton()->globalize_path(p_dir).simplify_path();
+	Error err = DirAccess::make_dir_recursive_absolute(dir);
+	ERR_FAIL_COND_MSG(err != OK, vformat("Cannot create import cache directory '%s', the import cache will not be used.", dir));
+	cache_dir = dir;
+
+	// The version string is the same for every build of a branch. Builds without a commit hash
+	// (e.g. from a source archive) are told apart by the modification time of the executable.
+	build_id = GODOT_VERSION_HASH;
+	if (build_id.is_empty()) {
+		build_id = itos(FileAccess::get_modified_time(OS::get_singleton()->get_executable_path()));
+	}
+}
+
+String EditorImportCache::get_key(const String &p_source_file, ResourceUID::ID p_uid, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) const {
+	String source_hash = FileAccess::get_sha256(p_source_file);
+	if (source_hash.is_empty()) {
+		return String();
+	}
+
+	// Imported files may reference the source path and UID, so they are part of the key as well.
+	String key = GODOT_VERSION_FULL_BUILD;
+	key += "\n" + build_id;
+	key += "\n" + source_hash;
+	key += "\n" + p_source_file;
+	key += "\n" + ResourceUID::get_singleton()->id_to_text(p_uid);
+	key += "\n" + p_importer->get_importer_name() + ":" + itos(p_importer->get_format_version());
+	key += "\n" + p_importer->get_import_settings_string();
+
+	// Same options and order as stored in the `.import` file.
+	for (const ResourceImporter::ImportOption &E : p_options) {
+		const Variant *value = p_params.getptr(E.option.name);
+		String value_text;
+		VariantWriter::write_to_string(value ? *value : E.default_value, value_text);
+		key += "\n" + String(E.option.name) + "=" + value_text;
+	}
+
+	return key.sha256_text();
+}
+
+bool EditorImportCache::restore(const String &p_key, const String &p_base_path, List<String> *r_platform_variants, Variant *r_metadata) {
+	uint64_t start_usec = OS::get_singleton()->get_ticks_usec();
+	String entry_dir = _get_entry_dir(p_key);
+
+	// The manifest is written before the entry is moved in place, so its presence means the entry is complete.
+	Ref<ConfigFile> manifest;
+	manifest.instantiate();
+	if (manifest->load(entry_dir.path_join("manifest.cfg")) != OK) {
+		misses.increment();
+		return false;
+	}
+
+	PackedStringArray suffixes = manifest->get_value("import", "files", PackedStringArray());
+	for (const String &suffix : suffixes) {
+		if (DirAccess::copy_absolute(entry_dir.path_join("out." + suffix), p_base_path + "." + suffix) != OK) {
+			misses.increment();
+			return false;
+		}
+	}
+
+	PackedStringArray variants = manifest->get_value("import", "platform_variants", PackedStringArray());
+	for (const String &variant : variants) {
+		r_platform_variants->push_back(variant);
+	}
+	*r_metadata = manifest->get_value("import", "metadata", Variant());
+
+	uint64_t import_usec = manifest->get_value("import", "import_usec", 0);
+	uint64_t restore_usec = OS::get_singleton()->get_ticks_usec() - start_usec;
+	if (import_usec > restore_usec) {
+		saved_usec.add(import_usec - restore_usec);
+	}
+	hits.increment();
+	return true;
+}
+
+void EditorImportCache::store(const String &p_key, const String &p_base_path, const String &p_save_extension, const List<String> &p_platform_variants, const Variant &p_metadata, uint64_t p_import_usec) {
+	if (p_save_extension.is_empty()) {
+		return;
+	}
+
+	String entry_dir = _get_entry_dir(p_key);
+	if (DirAccess::dir_exists_absolute(entry_dir)) {
+		// Stored by another import in the meantime.
+		return;
+	}
+
+	// Only the files reported by this import, same as the paths written to the `.import` file.
+	// Other files next to the base path may be left over from imports with different options.
+	PackedStringArray suffixes;
+	if (p_platform_variants.is_empty()) {
+		suffixes.push_back(p_save_extension);
+	} else {
+		for (const String &variant : p_platform_variants) {
+			suffixes.push_back(variant + "." + p_save_extension);
+		}
+	}
+
+	// Fill a temporary directory first and move it in place, so other processes sharing the cache never see partial entries.
+	String temp_dir = entry_dir + vformat(".tmp%d_%d", OS::get_singleton()->get_process_id(), (uint64_t)Thread::get_caller_id());
+	Error err = DirAccess::make_dir_recursive_absolute(temp_dir);
+	ERR_FAIL_COND_MSG(err != OK, vformat("Cannot create import cache entry '%s'.", temp_dir));
+
+	for (const String &suffix : suffixes) {
+		err = DirAccess::copy_absolute(p_base_path + "." + suffix, temp_dir.path_join("out." + suffix));
+		if (err != OK) {
+			break;
+		}
+	}
+
+	if (err == OK) {
+		PackedStringArray variants;
+		for (const String &variant : p_platform_variants) {
+			variants.push_back(variant);
+		}
+
+		Ref<ConfigFile> manifest;
+		manifest.instantiate();
+		manifest->set_value("import", "files", suffixes);
+		manifest->set_value("import", "platform_variants", variants);
+		manifest->set_value("import", "metadata", p_metadata);
+		manifest->set_value("import", "import_usec", p_import_usec);
+		err = manifest->save(temp_dir.path_join("manifest.cfg"));
+	}
+
+	if (err == OK) {
+		err = DirAccess::rename_absolute(temp_dir, entry_dir);
+	}
+
+	if (err != OK) {
+		// Either failed to write, or another process stored the same entry first.
+		Ref<DirAccess> da = DirAccess::open(temp_dir);
+		if (da.is_valid()) {
+			da->erase_contents_recursive();
+		}
+		DirAccess::remove_absolute(temp_dir);
+	}
+}
+
+void EditorImportCache::reset_stats() {
+	hits.set(0);
+	misses.set(0);
+	saved_usec.set(0);
+}
@@ -0,0 +1,68 @@
+/**************************************************************************/
+/*  editor_import_cache.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/resource_importer.h"
+#include "core/templates/safe_refcount.h"
+
+// Content addressed cache of import results, shared between projects and checkouts.
+// Entries are keyed by the source file contents together with everything else that
+// affects the import result (importer, its version and settings, the options and the
+// engine build), so a file that was already imported anywhere using the same cache
+// directory can be restored by copying the results instead of running the importer again.
+// Only importers that opt in with ResourceImporter::can_cache_import() are cached.
+class EditorImportCache {
+	String cache_dir;
+	String build_id;
+
+	SafeNumeric<uint32_t> hits;
+	SafeNumeric<uint32_t> misses;
+	SafeNumeric<uint64_t> saved_usec;
+
+	String _get_entry_dir(const String &p_key) const;
+
+public:
+	void set_cache_dir(const String &p_dir);
+	String get_cache_dir() const { return cache_dir; }
+	bool is_enabled() const { return !cache_dir.is_empty(); }
+
+	String get_key(const String &p_source_file, ResourceUID::ID p_uid, const Ref<ResourceImporter> &p_importer, const List<ResourceImporter::ImportOption> &p_options, const HashMap<StringName, Variant> &p_params) const;
+
+	// Copies the files stored for `p_key` to `p_base_path`. Returns `false` if there is no usable entry.
+	bool restore(const String &p_key, const String &p_base_path, List<String> *r_platform_variants, Variant *r_metadata);
+	// Stores the files of an import under `p_key`, i.e. `p_base_path` with the save extension, once per platform variant if there are any.
+	void store(const String &p_key, const String &p_base_path, const String &p_save_extension, const List<String> &p_platform_variants, const Variant &p_metadata, uint64_t p_import_usec);
+
+	void reset_stats();
+	uint32_t get_hits() const { return hits.get(); }
+	uint32_t get_misses() const { return misses.get(); }
+	uint64_t get_saved_usec() const { return saved_usec.get(); }
+};
@@ -1027,6 +1027,13 @@ String ResourceImporterTexture::get_import_settings_string() const {
 	return s;
 }
 
+bool ResourceImporterTexture::can_cache_import(const HashMap<StringName, Variant> &p_options) const {
+	// The editor-only variant depends on the editor scale and theme, and is written to a file of its own.
+	const bool use_editor_scale = p_options.has("editor/scale_with_editor_scale") && p_options["editor/scale_with_editor_scale"];
+	const bool convert_editor_colors = p_options.has("editor/convert_colors_with_editor_theme") && p_options["editor/convert_colors_with_editor_theme"];
+	return !use_editor_scale && !convert_editor_colors;
+}
+
 bool ResourceImporterTexture::are_import_settings_valid(const String &p_path, const Dictionary &p_meta) const {
 	if (p_meta.has("has_editor_variant")) {
 		String imported_path = ResourceFormatImporter::get_singleton()->get_internal_resource_path(p_path);
@@ -1919,7 +1919,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
 					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
-					*ret = temp_ret;
+					// The return value is only needed afterwards for error messages.
+					if (likely(err.error == Callable::CallError::CALL_OK)) {
+						*ret = std::move(temp_ret);
+					} else {
+						*ret = temp_ret;
+					}
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
 						if (base_type == Variant::OBJECT) {
@@ -2049,7 +2054,12 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
 					temp_ret = method->call(base_obj, (const Variant **)argptrs, argc, err);
-					*ret = temp_ret;
+					// The return value is only needed afterwards for error messages.
+					if (likely(err.error == Callable::CallError::CALL_OK)) {
+						*ret = std::move(temp_ret);
+					} else {
+						*ret = temp_ret;
+					}
 				} else {
 					temp_ret = method->call(base_obj, (const Variant **)argptrs, argc, err);
 				}
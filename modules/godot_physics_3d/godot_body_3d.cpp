@@ -799,6 +799,50 @@ bool GodotBody3D::sleep_test(real_t p_step) {
 	}
 }
 
+void GodotBody3D::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.self = get_self();
+	r_snapshot.transform = get_transform();
+	r_snapshot.inv_transform = get_inv_transform();
+	r_snapshot.new_transform = new_transform;
+	r_snapshot.linear_velocity = linear_velocity;
+	r_snapshot.angular_velocity = angular_velocity;
+	r_snapshot.prev_linear_velocity = prev_linear_velocity;
+	r_snapshot.prev_angular_velocity = prev_angular_velocity;
+	r_snapshot.constant_linear_velocity = constant_linear_velocity;
+	r_snapshot.constant_angular_velocity = constant_angular_velocity;
+	r_snapshot.applied_force = applied_force;
+	r_snapshot.applied_torque = applied_torque;
+	r_snapshot.constant_force = constant_force;
+	r_snapshot.constant_torque = constant_torque;
+	r_snapshot.still_time = still_time;
+	r_snapshot.active = active;
+}
+
+void GodotBody3D::restore_snapshot(const Snapshot &p_snapshot) {
+	// Only touch the broadphase for bodies that actually moved since the snapshot was taken.
+	// This includes static and sleeping bodies moved by the user, which never integrate.
+	if (get_transform() != p_snapshot.transform) {
+		// Also moves the shape AABBs in the broadphase, the space re-evaluates pairs afterwards.
+		_set_transform(p_snapshot.transform);
+		_set_inv_transform(p_snapshot.inv_transform);
+		_update_transform_dependent();
+	}
+
+	new_transform = p_snapshot.new_transform;
+	linear_velocity = p_snapshot.linear_velocity;
+	angular_velocity = p_snapshot.angular_velocity;
+	prev_linear_velocity = p_snapshot.prev_linear_velocity;
+	prev_angular_velocity = p_snapshot.prev_angular_velocity;
+	constant_linear_velocity = p_snapshot.constant_linear_velocity;
+	constant_angular_velocity = p_snapshot.constant_angular_velocity;
+	applied_force = p_snapshot.applied_force;
+	applied_torque = p_snapshot.applied_torque;
+	constant_force = p_snapshot.constant_force;
+	constant_torque = p_snapshot.constant_torque;
+	still_time = p_snapshot.still_time;
+	set_active(p_snapshot.active);
+}
+
 void GodotBody3D::set_state_sync_callback(const Callable &p_callable) {
 	body_state_callback = p_callable;
 }
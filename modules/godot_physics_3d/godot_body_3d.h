@@ -150,6 +150,29 @@ class GodotBody3D : public GodotCollisionObject3D {
 	friend class GodotPhysicsDirectBodyState3D; // i give up, too many functions to expose
 
 public:
+	// Plain-data copy of the simulation state, used by GodotSpace3D snapshots.
+	struct Snapshot {
+		RID self;
+		Transform3D transform;
+		Transform3D inv_transform;
+		Transform3D new_transform;
+		Vector3 linear_velocity;
+		Vector3 angular_velocity;
+		Vector3 prev_linear_velocity;
+		Vector3 prev_angular_velocity;
+		Vector3 constant_linear_velocity;
+		Vector3 constant_angular_velocity;
+		Vector3 applied_force;
+		Vector3 applied_torque;
+		Vector3 constant_force;
+		Vector3 constant_torque;
+		real_t still_time = 0.0;
+		bool active = false;
+	};
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+
 	void set_state_sync_callback(const Callable &p_callable);
 	void set_force_integration_callback(const Callable &p_callable, const Variant &p_udata = Variant());
 
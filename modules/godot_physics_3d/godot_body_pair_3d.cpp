@@ -595,8 +595,31 @@ void GodotBodyPair3D::solve(real_t p_step) {
 	}
 }
 
+void GodotBodyPair3D::save_snapshot(Snapshot &r_snapshot) const {
+	r_snapshot.body_A = A->get_self();
+	r_snapshot.body_B = B->get_self();
+	r_snapshot.shape_A = shape_A;
+	r_snapshot.shape_B = shape_B;
+	r_snapshot.sep_axis = sep_axis;
+	r_snapshot.contact_count = contact_count;
+	for (int i = 0; i < contact_count; i++) {
+		r_snapshot.contacts[i] = contacts[i];
+	}
+}
+
+void GodotBodyPair3D::restore_snapshot(const Snapshot &p_snapshot) {
+	ERR_FAIL_INDEX(p_snapshot.contact_count, MAX_CONTACTS + 1);
+
+	sep_axis = p_snapshot.sep_axis;
+	contact_count = p_snapshot.contact_count;
+	for (int i = 0; i < contact_count; i++) {
+		contacts[i] = p_snapshot.contacts[i];
+	}
+}
+
 GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p_B, int p_shape_B) :
-		GodotBodyContact3D(_arr, 2) {
+		GodotBodyContact3D(_arr, 2),
+		body_pair_list(this) {
 	A = p_A;
 	B = p_B;
 	shape_A = p_shape_A;
@@ -604,9 +627,11 @@ GodotBodyPair3D::GodotBodyPair3D(GodotBody3D *p_A, int p_shape_A, GodotBody3D *p
 	space = A->get_space();
 	A->add_constraint(this, 0);
 	B->add_constraint(this, 1);
+	space->body_pair_add_to_list(&body_pair_list);
 }
 
 GodotBodyPair3D::~GodotBodyPair3D() {
+	space->body_pair_remove_from_list(&body_pair_list);
 	A->remove_constraint(this);
 	B->remove_constraint(this);
 }
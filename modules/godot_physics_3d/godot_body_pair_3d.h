@@ -96,6 +96,8 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	Contact contacts[MAX_CONTACTS];
 	int contact_count = 0;
 
+	SelfList<GodotBodyPair3D> body_pair_list;
+
 	static void _contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal, void *p_userdata);
 
 	void contact_added_callback(const Vector3 &p_point_A, int p_index_A, const Vector3 &p_point_B, int p_index_B, const Vector3 &normal);
@@ -104,6 +106,26 @@ class GodotBodyPair3D : public GodotBodyContact3D {
 	bool _test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B);
 
 public:
+	// Warm-start data of a pair, used by GodotSpace3D snapshots.
+	struct Snapshot {
+		RID body_A;
+		RID body_B;
+		int shape_A = 0;
+		int shape_B = 0;
+		Vector3 sep_axis;
+		int contact_count = 0;
+		Contact contacts[MAX_CONTACTS];
+	};
+
+	void save_snapshot(Snapshot &r_snapshot) const;
+	void restore_snapshot(const Snapshot &p_snapshot);
+	void clear_contacts() { contact_count = 0; }
+
+	_FORCE_INLINE_ GodotBody3D *get_body_A() const { return A; }
+	_FORCE_INLINE_ GodotBody3D *get_body_B() const { return B; }
+	_FORCE_INLINE_ int get_shape_A() const { return shape_A; }
+	_FORCE_INLINE_ int get_shape_B() const { return shape_B; }
+
 	virtual bool setup(real_t p_step) override;
 	virtual bool pre_solve(real_t p_step) override;
 	virtual void solve(real_t p_step) override;
@@ -214,6 +214,22 @@ int GodotPhysicsServer3D::space_get_contact_count(RID p_space) const {
 	return space->get_debug_contact_count();
 }
 
+Vector<uint8_t> GodotPhysicsServer3D::space_save_snapshot(RID p_space) const {
+	const GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(space->is_locked(), Vector<uint8_t>(), "Space state is inaccessible right now, wait for iteration or physics process notification.");
+
+	return space->save_snapshot();
+}
+
+bool GodotPhysicsServer3D::space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) {
+	GodotSpace3D *space = space_owner.get_or_null(p_space);
+	ERR_FAIL_NULL_V(space, false);
+	ERR_FAIL_COND_V_MSG(space->is_locked(), false, "Space state is inaccessible right now, wait for iteration or physics process notification.");
+
+	return space->restore_snapshot(p_snapshot, body_owner);
+}
+
 RID GodotPhysicsServer3D::area_create() {
 	GodotArea3D *area = memnew(GodotArea3D);
 	RID rid = area_owner.make_rid(area);
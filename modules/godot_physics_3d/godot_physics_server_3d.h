@@ -116,6 +116,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const override;
 	virtual int space_get_contact_count(RID p_space) const override;
 
+	virtual Vector<uint8_t> space_save_snapshot(RID p_space) const override;
+	virtual bool space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) override;
+
 	/* AREA API */
 
 	virtual RID area_create() override;
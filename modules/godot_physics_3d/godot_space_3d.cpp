@@ -34,6 +34,7 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
+#include "core/io/marshalls.h"
 #include "godot_area_pair_3d.h"
 #include "godot_body_pair_3d.h"
 
@@ -1105,6 +1106,14 @@ void GodotSpace3D::body_remove_from_mass_properties_update_list(SelfList<GodotBo
 	mass_properties_update_list.remove(p_body);
 }
 
+void GodotSpace3D::body_pair_add_to_list(SelfList<GodotBodyPair3D> *p_body_pair) {
+	body_pair_list.add(p_body_pair);
+}
+
+void GodotSpace3D::body_pair_remove_from_list(SelfList<GodotBodyPair3D> *p_body_pair) {
+	body_pair_list.remove(p_body_pair);
+}
+
 GodotBroadPhase3D *GodotSpace3D::get_broadphase() {
 	return broadphase;
 }
@@ -1256,6 +1265,354 @@ GodotPhysicsDirectSpaceState3D *GodotSpace3D::get_direct_state() {
 	return direct_access;
 }
 
+static const uint32_t GODOT_SPACE_SNAPSHOT_VERSION_3D = 2;
+
+// Snapshots are written field by field in little endian, with every real stored as a double,
+// so they don't depend on struct layout or padding and stay valid across precision builds.
+class GodotSpaceSnapshotWriter3D {
+	LocalVector<uint8_t> data;
+
+	_FORCE_INLINE_ uint8_t *_grow(uint32_t p_bytes) {
+		const uint32_t pos = data.size();
+		data.resize(pos + p_bytes);
+		return data.ptr() + pos;
+	}
+
+public:
+	void put_u32(uint32_t p_value) { encode_uint32(p_value, _grow(4)); }
+	void put_u64(uint64_t p_value) { encode_uint64(p_value, _grow(8)); }
+	void put_real(real_t p_value) { encode_double(p_value, _grow(8)); }
+	void put_vector3(const Vector3 &p_value) {
+		for (int i = 0; i < 3; i++) {
+			put_real(p_value[i]);
+		}
+	}
+	void put_transform(const Transform3D &p_value) {
+		for (int i = 0; i < 3; i++) {
+			put_vector3(p_value.basis.rows[i]);
+		}
+		put_vector3(p_value.origin);
+	}
+
+	Vector<uint8_t> get_data() const {
+		Vector<uint8_t> result;
+		result.resize(data.size());
+		memcpy(result.ptrw(), data.ptr(), data.size());
+		return result;
+	}
+};
+
+class GodotSpaceSnapshotReader3D {
+	const uint8_t *ptr = nullptr;
+	int64_t size = 0;
+	int64_t pos = 0;
+	bool failed = false;
+
+	_FORCE_INLINE_ const uint8_t *_take(int64_t p_bytes) {
+		if (failed || pos + p_bytes > size) {
+			failed = true;
+			return nullptr;
+		}
+		const uint8_t *r = ptr + pos;
+		pos += p_bytes;
+		return r;
+	}
+
+public:
+	uint32_t get_u32() {
+		const uint8_t *r = _take(4);
+		return r ? decode_uint32(r) : 0;
+	}
+	uint64_t get_u64() {
+		const uint8_t *r = _take(8);
+		return r ? decode_uint64(r) : 0;
+	}
+	real_t get_real() {
+		const uint8_t *r = _take(8);
+		return r ? real_t(decode_double(r)) : 0.0;
+	}
+	Vector3 get_vector3() {
+		Vector3 v;
+		for (int i = 0; i < 3; i++) {
+			v[i] = get_real();
+		}
+		return v;
+	}
+	Transform3D get_transform() {
+		Transform3D t;
+		for (int i = 0; i < 3; i++) {
+			t.basis.rows[i] = get_vector3();
+		}
+		t.origin = get_vector3();
+		return t;
+	}
+
+	void fail() { failed = true; }
+	bool has_failed() const { return failed; }
+	bool is_at_end() const { return pos == size; }
+
+	GodotSpaceSnapshotReader3D(const Vector<uint8_t> &p_data) :
+			ptr(p_data.ptr()),
+			size(p_data.size()) {}
+};
+
+static void _write_body_snapshot(GodotSpaceSnapshotWriter3D &p_writer, const GodotBody3D::Snapshot &p_snapshot) {
+	p_writer.put_u64(p_snapshot.self.get_id());
+	p_writer.put_transform(p_snapshot.transform);
+	p_writer.put_transform(p_snapshot.inv_transform);
+	p_writer.put_transform(p_snapshot.new_transform);
+	p_writer.put_vector3(p_snapshot.linear_velocity);
+	p_writer.put_vector3(p_snapshot.angular_velocity);
+	p_writer.put_vector3(p_snapshot.prev_linear_velocity);
+	p_writer.put_vector3(p_snapshot.prev_angular_velocity);
+	p_writer.put_vector3(p_snapshot.constant_linear_velocity);
+	p_writer.put_vector3(p_snapshot.constant_angular_velocity);
+	p_writer.put_vector3(p_snapshot.applied_force);
+	p_writer.put_vector3(p_snapshot.applied_torque);
+	p_writer.put_vector3(p_snapshot.constant_force);
+	p_writer.put_vector3(p_snapshot.constant_torque);
+	p_writer.put_real(p_snapshot.still_time);
+	p_writer.put_u32(p_snapshot.active ? 1 : 0);
+}
+
+static void _read_body_snapshot(GodotSpaceSnapshotReader3D &p_reader, GodotBody3D::Snapshot &r_snapshot) {
+	r_snapshot.self = RID::from_uint64(p_reader.get_u64());
+	r_snapshot.transform = p_reader.get_transform();
+	r_snapshot.inv_transform = p_reader.get_transform();
+	r_snapshot.new_transform = p_reader.get_transform();
+	r_snapshot.linear_velocity = p_reader.get_vector3();
+	r_snapshot.angular_velocity = p_reader.get_vector3();
+	r_snapshot.prev_linear_velocity = p_reader.get_vector3();
+	r_snapshot.prev_angular_velocity = p_reader.get_vector3();
+	r_snapshot.constant_linear_velocity = p_reader.get_vector3();
+	r_snapshot.constant_angular_velocity = p_reader.get_vector3();
+	r_snapshot.applied_force = p_reader.get_vector3();
+	r_snapshot.applied_torque = p_reader.get_vector3();
+	r_snapshot.constant_force = p_reader.get_vector3();
+	r_snapshot.constant_torque = p_reader.get_vector3();
+	r_snapshot.still_time = p_reader.get_real();
+	r_snapshot.active = p_reader.get_u32() != 0;
+}
+
+static void _write_body_pair_snapshot(GodotSpaceSnapshotWriter3D &p_writer, const GodotBodyPair3D::Snapshot &p_snapshot) {
+	p_writer.put_u64(p_snapshot.body_A.get_id());
+	p_writer.put_u64(p_snapshot.body_B.get_id());
+	p_writer.put_u32(p_snapshot.shape_A);
+	p_writer.put_u32(p_snapshot.shape_B);
+	p_writer.put_vector3(p_snapshot.sep_axis);
+	p_writer.put_u32(p_snapshot.contact_count);
+	for (int i = 0; i < p_snapshot.contact_count; i++) {
+		const auto &c = p_snapshot.contacts[i];
+		p_writer.put_vector3(c.position);
+		p_writer.put_vector3(c.normal);
+		p_writer.put_u32(c.index_A);
+		p_writer.put_u32(c.index_B);
+		p_writer.put_vector3(c.local_A);
+		p_writer.put_vector3(c.local_B);
+		p_writer.put_vector3(c.acc_impulse);
+		p_writer.put_real(c.acc_normal_impulse);
+		p_writer.put_vector3(c.acc_tangent_impulse);
+		p_writer.put_real(c.acc_bias_impulse);
+		p_writer.put_real(c.acc_bias_impulse_center_of_mass);
+		p_writer.put_real(c.mass_normal);
+		p_writer.put_real(c.bias);
+		p_writer.put_real(c.bounce);
+		p_writer.put_real(c.depth);
+		p_writer.put_u32((c.active ? 1 : 0) | (c.used ? 2 : 0));
+		p_writer.put_vector3(c.rA);
+		p_writer.put_vector3(c.rB);
+	}
+}
+
+static void _read_body_pair_snapshot(GodotSpaceSnapshotReader3D &p_reader, GodotBodyPair3D::Snapshot &r_snapshot) {
+	r_snapshot.body_A = RID::from_uint64(p_reader.get_u64());
+	r_snapshot.body_B = RID::from_uint64(p_reader.get_u64());
+	r_snapshot.shape_A = p_reader.get_u32();
+	r_snapshot.shape_B = p_reader.get_u32();
+	r_snapshot.sep_axis = p_reader.get_vector3();
+	r_snapshot.contact_count = 0;
+
+	const uint32_t contact_count = p_reader.get_u32();
+	if (contact_count > sizeof(r_snapshot.contacts) / sizeof(r_snapshot.contacts[0])) {
+		p_reader.fail();
+		return;
+	}
+
+	for (uint32_t i = 0; i < contact_count; i++) {
+		auto &c = r_snapshot.contacts[i];
+		c.position = p_reader.get_vector3();
+		c.normal = p_reader.get_vector3();
+		c.index_A = p_reader.get_u32();
+		c.index_B = p_reader.get_u32();
+		c.local_A = p_reader.get_vector3();
+		c.local_B = p_reader.get_vector3();
+		c.acc_impulse = p_reader.get_vector3();
+		c.acc_normal_impulse = p_reader.get_real();
+		c.acc_tangent_impulse = p_reader.get_vector3();
+		c.acc_bias_impulse = p_reader.get_real();
+		c.acc_bias_impulse_center_of_mass = p_reader.get_real();
+		c.mass_normal = p_reader.get_real();
+		c.bias = p_reader.get_real();
+		c.bounce = p_reader.get_real();
+		c.depth = p_reader.get_real();
+		const uint32_t flags = p_reader.get_u32();
+		c.active = flags & 1;
+		c.used = flags & 2;
+		c.rA = p_reader.get_vector3();
+		c.rB = p_reader.get_vector3();
+	}
+	r_snapshot.contact_count = contact_count;
+}
+
+struct GodotBodyPairKey3D {
+	RID body_A;
+	RID body_B;
+	int shape_A = 0;
+	int shape_B = 0;
+
+	static _FORCE_INLINE_ uint32_t hash(const GodotBodyPairKey3D &p_key) {
+		uint32_t h = hash_murmur3_one_64(p_key.body_A.get_id());
+		h = hash_murmur3_one_64(p_key.body_B.get_id(), h);
+		h = hash_murmur3_one_32(p_key.shape_A, h);
+		h = hash_murmur3_one_32(p_key.shape_B, h);
+		return hash_fmix32(h);
+	}
+
+	_FORCE_INLINE_ bool operator==(const GodotBodyPairKey3D &p_key) const {
+		return body_A == p_key.body_A && body_B == p_key.body_B && shape_A == p_key.shape_A && shape_B == p_key.shape_B;
+	}
+
+	GodotBodyPairKey3D() {}
+	GodotBodyPairKey3D(const GodotBodyPair3D *p_pair) :
+			body_A(p_pair->get_body_A()->get_self()),
+			body_B(p_pair->get_body_B()->get_self()),
+			shape_A(p_pair->get_shape_A()),
+			shape_B(p_pair->get_shape_B()) {}
+	GodotBodyPairKey3D(const GodotBodyPair3D::Snapshot &p_snapshot) :
+			body_A(p_snapshot.body_A),
+			body_B(p_snapshot.body_B),
+			shape_A(p_snapshot.shape_A),
+			shape_B(p_snapshot.shape_B) {}
+};
+
+Vector<uint8_t> GodotSpace3D::save_snapshot() const {
+	uint32_t body_count = 0;
+	for (const GodotCollisionObject3D *E : objects) {
+		if (E->get_type() == GodotCollisionObject3D::TYPE_BODY) {
+			body_count++;
+		}
+	}
+	uint32_t body_pair_count = 0;
+	for (const SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		body_pair_count++;
+	}
+
+	GodotSpaceSnapshotWriter3D writer;
+	writer.put_u32(GODOT_SPACE_SNAPSHOT_VERSION_3D);
+	writer.put_u32(body_count);
+	writer.put_u32(body_pair_count);
+
+	// Active bodies go first and in list order, so restoring can rebuild the active list exactly.
+	// Islands and solver iterations follow that order, so it matters for a deterministic replay.
+	GodotBody3D::Snapshot body_snapshot;
+	for (const SelfList<GodotBody3D> *E = active_list.first(); E; E = E->next()) {
+		E->self()->save_snapshot(body_snapshot);
+		_write_body_snapshot(writer, body_snapshot);
+	}
+	for (GodotCollisionObject3D *E : objects) {
+		if (E->get_type() != GodotCollisionObject3D::TYPE_BODY) {
+			continue;
+		}
+		const GodotBody3D *body = static_cast<const GodotBody3D *>(E);
+		if (body->is_active()) {
+			continue;
+		}
+		body->save_snapshot(body_snapshot);
+		_write_body_snapshot(writer, body_snapshot);
+	}
+
+	GodotBodyPair3D::Snapshot body_pair_snapshot;
+	for (const SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		E->self()->save_snapshot(body_pair_snapshot);
+		_write_body_pair_snapshot(writer, body_pair_snapshot);
+	}
+
+	return writer.get_data();
+}
+
+bool GodotSpace3D::restore_snapshot(const Vector<uint8_t> &p_snapshot, RID_PtrOwner<GodotBody3D, true> &p_body_owner) {
+	GodotSpaceSnapshotReader3D reader(p_snapshot);
+
+	const uint32_t version = reader.get_u32();
+	ERR_FAIL_COND_V_MSG(reader.has_failed(), false, "Invalid physics space snapshot.");
+	ERR_FAIL_COND_V_MSG(version != GODOT_SPACE_SNAPSHOT_VERSION_3D, false, "Physics space snapshot was created by an incompatible version.");
+
+	// Decode everything first, so a corrupt snapshot leaves the space untouched.
+	const uint32_t body_count = reader.get_u32();
+	const uint32_t body_pair_count = reader.get_u32();
+
+	LocalVector<GodotBody3D::Snapshot> body_snapshots;
+	for (uint32_t i = 0; i < body_count && !reader.has_failed(); i++) {
+		body_snapshots.push_back(GodotBody3D::Snapshot());
+		_read_body_snapshot(reader, body_snapshots[i]);
+	}
+	LocalVector<GodotBodyPair3D::Snapshot> body_pair_snapshots;
+	for (uint32_t i = 0; i < body_pair_count && !reader.has_failed(); i++) {
+		body_pair_snapshots.push_back(GodotBodyPair3D::Snapshot());
+		_read_body_pair_snapshot(reader, body_pair_snapshots[i]);
+	}
+	ERR_FAIL_COND_V_MSG(reader.has_failed() || !reader.is_at_end(), false, "Invalid physics space snapshot.");
+
+	// Walk backwards and push each body to the front of the active list, which leaves
+	// the list in snapshot order. Bodies added after the snapshot was taken stay at the end.
+	for (int64_t i = int64_t(body_snapshots.size()) - 1; i >= 0; i--) {
+		GodotBody3D *body = p_body_owner.get_or_null(body_snapshots[i].self);
+		if (!body || body->get_space() != this) {
+			continue;
+		}
+		body->set_active(false);
+		body->restore_snapshot(body_snapshots[i]);
+	}
+
+	// Bodies that moved back only updated their shape AABBs. Update the broadphase now, so pairs
+	// that don't overlap at the restored transforms are dropped and the ones from the snapshot exist again.
+	broadphase->update();
+
+	// Pairs that still exist get their warm-start data back, any other pair starts cold.
+	// If the pair list did not change since the snapshot was taken, the records line up with it.
+	uint32_t live_pair_count = 0;
+	bool in_order = true;
+	for (const SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+		if (in_order && live_pair_count < body_pair_snapshots.size()) {
+			in_order = GodotBodyPairKey3D(E->self()) == GodotBodyPairKey3D(body_pair_snapshots[live_pair_count]);
+		}
+		live_pair_count++;
+	}
+
+	if (in_order && live_pair_count == body_pair_snapshots.size()) {
+		uint32_t i = 0;
+		for (SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+			E->self()->restore_snapshot(body_pair_snapshots[i++]);
+		}
+	} else {
+		HashMap<GodotBodyPairKey3D, GodotBodyPair3D *, GodotBodyPairKey3D> live_pairs;
+		live_pairs.reserve(live_pair_count);
+		for (SelfList<GodotBodyPair3D> *E = body_pair_list.first(); E; E = E->next()) {
+			E->self()->clear_contacts();
+			live_pairs.insert(GodotBodyPairKey3D(E->self()), E->self());
+		}
+
+		for (const GodotBodyPair3D::Snapshot &body_pair_snapshot : body_pair_snapshots) {
+			GodotBodyPair3D **pair = live_pairs.getptr(GodotBodyPairKey3D(body_pair_snapshot));
+			if (pair) {
+				(*pair)->restore_snapshot(body_pair_snapshot);
+			}
+		}
+	}
+
+	return true;
+}
+
 GodotSpace3D::GodotSpace3D() {
 	body_linear_velocity_sleep_threshold = GLOBAL_GET("physics/3d/sleep_threshold_linear");
 	body_angular_velocity_sleep_threshold = GLOBAL_GET("physics/3d/sleep_threshold_angular");
@@ -36,8 +36,11 @@
 #include "godot_collision_object_3d.h"
 #include "godot_soft_body_3d.h"
 
+#include "core/templates/rid_owner.h"
 #include "core/typedefs.h"
 
+class GodotBodyPair3D;
+
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
 	GDCLASS(GodotPhysicsDirectSpaceState3D, PhysicsDirectSpaceState3D);
 
@@ -80,6 +83,7 @@ private:
 	SelfList<GodotArea3D>::List monitor_query_list;
 	SelfList<GodotArea3D>::List area_moved_list;
 	SelfList<GodotSoftBody3D>::List active_soft_body_list;
+	SelfList<GodotBodyPair3D>::List body_pair_list;
 
 	static void *_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_self);
@@ -149,6 +153,9 @@ public:
 	void soft_body_add_to_active_list(SelfList<GodotSoftBody3D> *p_soft_body);
 	void soft_body_remove_from_active_list(SelfList<GodotSoftBody3D> *p_soft_body);
 
+	void body_pair_add_to_list(SelfList<GodotBodyPair3D> *p_body_pair);
+	void body_pair_remove_from_list(SelfList<GodotBodyPair3D> *p_body_pair);
+
 	GodotBroadPhase3D *get_broadphase();
 
 	void add_object(GodotCollisionObject3D *p_object);
@@ -206,6 +213,10 @@ public:
 
 	bool test_body_motion(GodotBody3D *p_body, const PhysicsServer3D::MotionParameters &p_parameters, PhysicsServer3D::MotionResult *r_result);
 
+	// Snapshots hold the simulation state of bodies and body pairs, not the shapes or settings of the space.
+	Vector<uint8_t> save_snapshot() const;
+	bool restore_snapshot(const Vector<uint8_t> &p_snapshot, RID_PtrOwner<GodotBody3D, true> &p_body_owner);
+
 	GodotSpace3D();
 	~GodotSpace3D();
 };
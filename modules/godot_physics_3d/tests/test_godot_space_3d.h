@@ -0,0 +1,242 @@
+/**************************************************************************/
+/*  test_godot_space_3d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotSpace3D {
+
+static const real_t STEP = 1.0 / 60.0;
+
+struct BodyState {
+	Transform3D transform;
+	Vector3 linear_velocity;
+	Vector3 angular_velocity;
+};
+
+static RID create_box_body(PhysicsServer3D *p_server, RID p_space, RID p_shape, PhysicsServer3D::BodyMode p_mode, const Vector3 &p_position) {
+	RID body = p_server->body_create();
+	p_server->body_set_mode(body, p_mode);
+	p_server->body_add_shape(body, p_shape);
+	p_server->body_set_space(body, p_space);
+	p_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), p_position));
+	return body;
+}
+
+static Vector<BodyState> get_body_states(PhysicsServer3D *p_server, const Vector<RID> &p_bodies) {
+	Vector<BodyState> states;
+	for (const RID &body : p_bodies) {
+		BodyState state;
+		state.transform = p_server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+		state.linear_velocity = p_server->body_get_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY);
+		state.angular_velocity = p_server->body_get_state(body, PhysicsServer3D::BODY_STATE_ANGULAR_VELOCITY);
+		states.push_back(state);
+	}
+	return states;
+}
+
+static void check_body_states(const Vector<BodyState> &p_a, const Vector<BodyState> &p_b) {
+	REQUIRE(p_a.size() == p_b.size());
+	for (int i = 0; i < p_a.size(); i++) {
+		CHECK(p_a[i].transform.is_equal_approx(p_b[i].transform));
+		CHECK(p_a[i].linear_velocity.is_equal_approx(p_b[i].linear_velocity));
+		CHECK(p_a[i].angular_velocity.is_equal_approx(p_b[i].angular_velocity));
+	}
+}
+
+TEST_CASE("[GodotPhysics3D] Space snapshot save, restore and resimulate") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D(false));
+	server->init();
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	RID floor_shape = server->box_shape_create();
+	server->shape_set_data(floor_shape, Vector3(20, 1, 20));
+	RID box_shape = server->box_shape_create();
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	RID floor = create_box_body(server, space, floor_shape, PhysicsServer3D::BODY_MODE_STATIC, Vector3(0, -1, 0));
+
+	// A small stack keeps contacts alive across the whole test, so warm-starting matters.
+	Vector<RID> bodies;
+	for (int i = 0; i < 4; i++) {
+		bodies.push_back(create_box_body(server, space, box_shape, PhysicsServer3D::BODY_MODE_RIGID, Vector3(i * 0.1, 0.5 + i * 1.05, 0)));
+	}
+
+	for (int i = 0; i < 20; i++) {
+		server->step(STEP);
+	}
+
+	const Vector<BodyState> saved_states = get_body_states(server, bodies);
+	const Vector<uint8_t> snapshot = server->space_save_snapshot(space);
+	CHECK_FALSE(snapshot.is_empty());
+
+	for (int i = 0; i < 8; i++) {
+		server->step(STEP);
+	}
+	const Vector<BodyState> simulated_states = get_body_states(server, bodies);
+
+	CHECK(server->space_restore_snapshot(space, snapshot));
+	check_body_states(get_body_states(server, bodies), saved_states);
+
+	for (int i = 0; i < 8; i++) {
+		server->step(STEP);
+	}
+	check_body_states(get_body_states(server, bodies), simulated_states);
+
+	for (const RID &body : bodies) {
+		server->free(body);
+	}
+	server->free(floor);
+	server->free(box_shape);
+	server->free(floor_shape);
+	server->free(space);
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics3D] Space snapshot restores sleeping state") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D(false));
+	server->init();
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	RID shape = server->sphere_shape_create();
+	server->shape_set_data(shape, 0.5);
+	RID body = create_box_body(server, space, shape, PhysicsServer3D::BODY_MODE_RIGID, Vector3(0, 10, 0));
+
+	server->body_set_state(body, PhysicsServer3D::BODY_STATE_SLEEPING, true);
+	const Vector<uint8_t> snapshot = server->space_save_snapshot(space);
+
+	server->body_set_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(0, 5, 0));
+	server->step(STEP);
+	CHECK_FALSE(bool(server->body_get_state(body, PhysicsServer3D::BODY_STATE_SLEEPING)));
+
+	CHECK(server->space_restore_snapshot(space, snapshot));
+	CHECK(bool(server->body_get_state(body, PhysicsServer3D::BODY_STATE_SLEEPING)));
+	CHECK(Vector3(server->body_get_state(body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY)).is_zero_approx());
+
+	// Sleeping bodies must not move when stepping after the restore.
+	const Transform3D transform = server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM);
+	server->step(STEP);
+	CHECK(Transform3D(server->body_get_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM)).is_equal_approx(transform));
+
+	server->free(body);
+	server->free(shape);
+	server->free(space);
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics3D] Space snapshot restores contacts with a moved static body") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D(false));
+	server->init();
+
+	RID space = server->space_create();
+	server->space_set_active(space, true);
+
+	RID floor_shape = server->box_shape_create();
+	server->shape_set_data(floor_shape, Vector3(20, 1, 20));
+	RID box_shape = server->box_shape_create();
+	server->shape_set_data(box_shape, Vector3(0.5, 0.5, 0.5));
+
+	const Transform3D floor_transform = Transform3D(Basis(), Vector3(0, -1, 0));
+	RID floor = create_box_body(server, space, floor_shape, PhysicsServer3D::BODY_MODE_STATIC, floor_transform.origin);
+	RID box = create_box_body(server, space, box_shape, PhysicsServer3D::BODY_MODE_RIGID, Vector3(0, 0.5, 0));
+	server->body_set_max_contacts_reported(box, 4);
+
+	const Vector<RID> bodies = { box };
+	for (int i = 0; i < 20; i++) {
+		server->step(STEP);
+	}
+	REQUIRE(server->body_get_direct_state(box)->get_contact_count() > 0);
+
+	const Vector<uint8_t> snapshot = server->space_save_snapshot(space);
+	for (int i = 0; i < 8; i++) {
+		server->step(STEP);
+	}
+	const Vector<BodyState> simulated_states = get_body_states(server, bodies);
+
+	// Static bodies never integrate, so moving one away only goes through the broadphase.
+	CHECK(server->space_restore_snapshot(space, snapshot));
+	server->body_set_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(0, -50, 0)));
+	for (int i = 0; i < 4; i++) {
+		server->step(STEP);
+	}
+	CHECK(server->body_get_direct_state(box)->get_contact_count() == 0);
+	CHECK(Vector3(server->body_get_state(box, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY)).y < 0.0);
+
+	// Restoring moves the floor back, which recreates the pair and its warm-start contacts.
+	CHECK(server->space_restore_snapshot(space, snapshot));
+	CHECK(Transform3D(server->body_get_state(floor, PhysicsServer3D::BODY_STATE_TRANSFORM)).is_equal_approx(floor_transform));
+	for (int i = 0; i < 8; i++) {
+		server->step(STEP);
+	}
+	CHECK(server->body_get_direct_state(box)->get_contact_count() > 0);
+	check_body_states(get_body_states(server, bodies), simulated_states);
+
+	server->free(box);
+	server->free(floor);
+	server->free(box_shape);
+	server->free(floor_shape);
+	server->free(space);
+	server->finish();
+	memdelete(server);
+}
+
+TEST_CASE("[GodotPhysics3D] Space snapshot rejects invalid data") {
+	GodotPhysicsServer3D *server = memnew(GodotPhysicsServer3D(false));
+	server->init();
+
+	RID space = server->space_create();
+	Vector<uint8_t> snapshot = server->space_save_snapshot(space);
+
+	ERR_PRINT_OFF;
+	CHECK_FALSE(server->space_restore_snapshot(space, Vector<uint8_t>()));
+
+	Vector<uint8_t> truncated = snapshot;
+	truncated.resize(truncated.size() - 1);
+	CHECK_FALSE(server->space_restore_snapshot(space, truncated));
+
+	snapshot.write[0] ^= 0xFF;
+	CHECK_FALSE(server->space_restore_snapshot(space, snapshot));
+	ERR_PRINT_ON;
+
+	server->free(space);
+	server->finish();
+	memdelete(server);
+}
+
+} // namespace TestGodotSpace3D
@@ -267,6 +267,14 @@ int JoltPhysicsServer3D::space_get_contact_count(RID p_space) const {
 #endif
 }
 
+Vector<uint8_t> JoltPhysicsServer3D::space_save_snapshot(RID p_space) const {
+	ERR_FAIL_V_MSG(Vector<uint8_t>(), "Space snapshots are not supported when using Jolt Physics.");
+}
+
+bool JoltPhysicsServer3D::space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) {
+	ERR_FAIL_V_MSG(false, "Space snapshots are not supported when using Jolt Physics.");
+}
+
 RID JoltPhysicsServer3D::area_create() {
 	JoltArea3D *area = memnew(JoltArea3D);
 	RID rid = area_owner.make_rid(area);
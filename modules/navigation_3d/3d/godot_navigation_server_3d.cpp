@@ -234,6 +234,48 @@ real_t GodotNavigationServer3D::map_get_link_connection_radius(RID p_map) const
 	return map->get_link_connection_radius();
 }
 
+COMMAND_2(map_set_use_hierarchical_pathfinding, RID, p_map, bool, p_enabled) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_use_hierarchical_pathfinding(p_enabled);
+}
+
+bool GodotNavigationServer3D::map_get_use_hierarchical_pathfinding(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, false);
+
+	return map->get_use_hierarchical_pathfinding();
+}
+
+COMMAND_2(map_set_hierarchical_cluster_size, RID, p_map, real_t, p_cluster_size) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_hierarchical_cluster_size(p_cluster_size);
+}
+
+real_t GodotNavigationServer3D::map_get_hierarchical_cluster_size(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_hierarchical_cluster_size();
+}
+
+COMMAND_2(map_set_path_query_queue_budget, RID, p_map, int, p_budget) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+
+	map->set_path_query_queue_budget(p_budget);
+}
+
+int GodotNavigationServer3D::map_get_path_query_queue_budget(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_path_query_queue_budget();
+}
+
 Vector<Vector3> GodotNavigationServer3D::map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers) {
 	const NavMap3D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector<Vector3>());
@@ -1215,6 +1257,22 @@ void GodotNavigationServer3D::bake_from_source_geometry_data_async(const Ref<Nav
 	NavMeshGenerator3D::get_singleton()->bake_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_callback);
 }
 
+void GodotNavigationServer3D::bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->bake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_changed_aabb, p_callback);
+}
+
+void GodotNavigationServer3D::bake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->bake_tiles_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_changed_aabb, p_callback);
+}
+
 bool GodotNavigationServer3D::is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const {
 	return NavMeshGenerator3D::get_singleton()->is_baking(p_navigation_mesh);
 }
@@ -1403,11 +1461,14 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	int _new_pm_path_query_queue_size = 0;
+	int _new_pm_path_query_latency_usec = 0;
 
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
 		active_maps[i]->sync();
 		active_maps[i]->step(p_delta_time);
+		active_maps[i]->process_path_queries();
 		active_maps[i]->dispatch_callbacks();
 
 		_new_pm_region_count += active_maps[i]->get_pm_region_count();
@@ -1419,6 +1480,8 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
+		_new_pm_path_query_queue_size += active_maps[i]->get_pm_path_query_queue_size();
+		_new_pm_path_query_latency_usec = MAX(_new_pm_path_query_latency_usec, active_maps[i]->get_pm_path_query_latency_usec());
 	}
 
 	pm_region_count = _new_pm_region_count;
@@ -1430,6 +1493,8 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_path_query_queue_size = _new_pm_path_query_queue_size;
+	pm_path_query_latency_usec = _new_pm_path_query_latency_usec;
 }
 
 void GodotNavigationServer3D::init() {
@@ -1457,6 +1522,16 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMap3D *map = map_owner.get_or_null(p_query_parameters->get_map());
+	ERR_FAIL_NULL(map);
+
+	NavMeshQueries3D::map_queue_path_query(map, p_query_parameters, p_query_result, p_callback);
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1544,6 +1619,12 @@ int GodotNavigationServer3D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_PATH_QUERY_QUEUE_SIZE: {
+			return pm_path_query_queue_size;
+		} break;
+		case INFO_PATH_QUERY_LATENCY: {
+			return pm_path_query_latency_usec;
+		} break;
 	}
 
 	return 0;
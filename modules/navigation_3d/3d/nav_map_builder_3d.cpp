@@ -36,6 +36,9 @@
 #include "nav_map_iteration_3d.h"
 #include "nav_region_iteration_3d.h"
 
+#include "core/templates/a_hash_map.h"
+#include "core/templates/hash_set.h"
+
 using namespace Nav3D;
 
 PointKey NavMapBuilder3D::get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size) {
@@ -70,6 +73,8 @@ void NavMapBuilder3D::build_navmap_iteration(NavMapIterationBuild3D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_hierarchical_clusters(r_build);
+
 	_build_update_map_iteration(r_build);
 }
 
@@ -304,34 +309,25 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 				continue;
 			}
 
-			for (Polygon &polyon : region->navmesh_polygons) {
-				for (uint32_t point_id = 2; point_id < polyon.vertices.size(); point_id += 1) {
-					const Face3 face(polyon.vertices[0], polyon.vertices[point_id - 1], polyon.vertices[point_id]);
-
-					{
-						const Vector3 start_point = face.get_closest_point_to(link_start_pos);
-						const real_t sqr_dist = start_point.distance_squared_to(link_start_pos);
-
-						// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-						if (sqr_dist < closest_start_sqr_dist) {
-							closest_start_sqr_dist = sqr_dist;
-							closest_start_point = start_point;
-							closest_start_polygon = &polyon;
-						}
-					}
-
-					{
-						const Vector3 end_point = face.get_closest_point_to(link_end_pos);
-						const real_t sqr_dist = end_point.distance_squared_to(link_end_pos);
-
-						// Pick the polygon that is within our radius and is closer than anything we've seen yet.
-						if (sqr_dist < closest_end_sqr_dist) {
-							closest_end_sqr_dist = sqr_dist;
-							closest_end_point = end_point;
-							closest_end_polygon = &polyon;
-						}
-					}
-				}
+			LocalVector<Polygon> &polygons = region->navmesh_polygons;
+			const NavPolygonBVH3D &polygons_bvh = region->get_polygons_bvh();
+			Vector3 point;
+
+			// Pick the polygon that is within our radius and is closer than anything we've seen yet.
+			int32_t polygon_index = polygons_bvh.find_closest(link_start_pos, closest_start_sqr_dist, [&](int32_t p_polygon_index) {
+				return NavMeshQueries3D::polygon_get_closest_face_point(polygons[p_polygon_index], link_start_pos, point);
+			});
+			if (polygon_index >= 0) {
+				closest_start_polygon = &polygons[polygon_index];
+				NavMeshQueries3D::polygon_get_closest_face_point(*closest_start_polygon, link_start_pos, closest_start_point);
+			}
+
+			polygon_index = polygons_bvh.find_closest(link_end_pos, closest_end_sqr_dist, [&](int32_t p_polygon_index) {
+				return NavMeshQueries3D::polygon_get_closest_face_point(polygons[p_polygon_index], link_end_pos, point);
+			});
+			if (polygon_index >= 0) {
+				closest_end_polygon = &polygons[polygon_index];
+				NavMeshQueries3D::polygon_get_closest_face_point(*closest_end_polygon, link_end_pos, closest_end_point);
 			}
 		}
 
@@ -386,6 +382,125 @@ void NavMapBuilder3D::_build_step_navlink_connections(NavMapIterationBuild3D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder3D::_build_step_hierarchical_clusters(NavMapIterationBuild3D &r_build) {
+	NavMapIteration3D *map_iteration = r_build.map_iteration;
+
+	LocalVector<PolygonCluster> &clusters = map_iteration->polygon_clusters;
+	LocalVector<uint32_t> &polygon_cluster_ids = map_iteration->polygon_cluster_ids;
+	clusters.clear();
+	polygon_cluster_ids.clear();
+
+	if (!r_build.use_hierarchical_pathfinding || r_build.hierarchical_cluster_size <= 0.0) {
+		return;
+	}
+
+	const real_t cluster_size = r_build.hierarchical_cluster_size;
+	HashMap<Vector3i, uint32_t> &cluster_keys = r_build.iter_cluster_keys;
+	cluster_keys.clear();
+
+	// Collect the polygons in the same order as the path query slots assign their ids.
+	LocalVector<const Polygon *> polygons;
+	polygons.reserve(r_build.polygon_count);
+	for (const Ref<NavRegionIteration3D> &region : map_iteration->region_iterations) {
+		for (const Polygon &polygon : region->navmesh_polygons) {
+			polygons.push_back(&polygon);
+		}
+	}
+	for (const Polygon &polygon : map_iteration->navlink_polygons) {
+		polygons.push_back(&polygon);
+	}
+
+	// Group the polygons by the grid cell that contains their center.
+	AHashMap<const Polygon *, uint32_t> polygon_to_cluster;
+	polygon_to_cluster.reserve(polygons.size());
+	LocalVector<real_t> cluster_weights;
+	polygon_cluster_ids.resize(polygons.size());
+
+	for (uint32_t polygon_index = 0; polygon_index < polygons.size(); polygon_index++) {
+		const Polygon *polygon = polygons[polygon_index];
+		if (polygon->vertices.is_empty()) {
+			// Unconnected link, nothing can path through it.
+			polygon_cluster_ids[polygon_index] = UINT32_MAX;
+			continue;
+		}
+
+		Vector3 center;
+		for (const Vector3 &vertex : polygon->vertices) {
+			center += vertex;
+		}
+		center /= polygon->vertices.size();
+
+		const Vector3i cluster_key(
+				static_cast<int>(Math::floor(center.x / cluster_size)),
+				static_cast<int>(Math::floor(center.y / cluster_size)),
+				static_cast<int>(Math::floor(center.z / cluster_size)));
+
+		HashMap<Vector3i, uint32_t>::Iterator cluster_it = cluster_keys.find(cluster_key);
+		if (!cluster_it) {
+			cluster_it = cluster_keys.insert(cluster_key, clusters.size());
+			clusters.push_back(PolygonCluster());
+			cluster_weights.push_back(0.0);
+		}
+		const uint32_t cluster_id = cluster_it->value;
+
+		polygon_cluster_ids[polygon_index] = cluster_id;
+		polygon_to_cluster.insert(polygon, cluster_id);
+
+		// Links have no surface area but still need to give their cluster a position.
+		const real_t weight = MAX(polygon->surface_area, (real_t)CMP_EPSILON);
+		PolygonCluster &cluster = clusters[cluster_id];
+		cluster.position += center * weight;
+		cluster.travel_cost += polygon->owner->get_travel_cost() * weight;
+		cluster_weights[cluster_id] += weight;
+	}
+
+	for (uint32_t cluster_id = 0; cluster_id < clusters.size(); cluster_id++) {
+		clusters[cluster_id].position /= cluster_weights[cluster_id];
+		clusters[cluster_id].travel_cost /= cluster_weights[cluster_id];
+	}
+
+	// Connect the clusters along every polygon connection that crosses a cluster border.
+	const HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>> &navbases_polygons_external_connections = map_iteration->navbases_polygons_external_connections;
+	HashSet<uint64_t> cluster_edges;
+
+	for (uint32_t polygon_index = 0; polygon_index < polygons.size(); polygon_index++) {
+		const uint32_t cluster_id = polygon_cluster_ids[polygon_index];
+		if (cluster_id == UINT32_MAX) {
+			continue;
+		}
+
+		const Polygon *polygon = polygons[polygon_index];
+		LocalVector<uint32_t> &neighbors = clusters[cluster_id].neighbors;
+
+		const LocalVector<LocalVector<Connection>> &internal_connections = polygon->owner->get_internal_connections();
+		const LocalVector<Connection> *polygon_connections[2] = { nullptr, nullptr };
+		if (polygon->id < internal_connections.size()) {
+			polygon_connections[0] = &internal_connections[polygon->id];
+		}
+		HashMap<const NavBaseIteration3D *, LocalVector<LocalVector<Connection>>>::ConstIterator external_it = navbases_polygons_external_connections.find(polygon->owner);
+		if (external_it && polygon->id < external_it->value.size()) {
+			polygon_connections[1] = &external_it->value[polygon->id];
+		}
+
+		for (const LocalVector<Connection> *connections : polygon_connections) {
+			if (!connections) {
+				continue;
+			}
+			for (const Connection &connection : *connections) {
+				const uint32_t *neighbor_id = polygon_to_cluster.getptr(connection.polygon);
+				if (!neighbor_id || *neighbor_id == cluster_id) {
+					continue;
+				}
+				const uint64_t edge_key = (uint64_t(cluster_id) << 32) | *neighbor_id;
+				if (!cluster_edges.has(edge_key)) {
+					cluster_edges.insert(edge_key);
+					neighbors.push_back(*neighbor_id);
+				}
+			}
+		}
+	}
+}
+
 void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_build) {
 	NavMapIteration3D *map_iteration = r_build.map_iteration;
 
@@ -419,6 +534,12 @@ void NavMapBuilder3D::_build_update_map_iteration(NavMapIterationBuild3D &r_buil
 		}
 
 		DEV_ASSERT(p_path_query_slot.path_corridor.size() == p_path_query_slot.poly_to_id.size());
+
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.path_clusters.clear();
+		p_path_query_slot.path_clusters.resize(map_iteration->polygon_clusters.size());
+		p_path_query_slot.poly_to_cluster = map_iteration->polygon_cluster_ids;
+		p_path_query_slot.use_cluster_corridor = false;
 	}
 
 	map_iteration->path_query_slots_mutex.unlock();
@@ -47,12 +47,15 @@ struct NavMapIterationBuild3D {
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
+	bool use_hierarchical_pathfinding = false;
+	real_t hierarchical_cluster_size = 0.0;
 	Nav3D::PerformanceData performance_data;
 	int polygon_count = 0;
 	int free_edge_count = 0;
 
 	HashMap<Nav3D::EdgeKey, Nav3D::EdgeConnectionPair, Nav3D::EdgeKey> iter_connection_pairs_map;
 	LocalVector<Nav3D::Connection> iter_free_edges;
+	HashMap<Vector3i, uint32_t> iter_cluster_keys;
 
 	NavMapIteration3D *map_iteration = nullptr;
 
@@ -63,6 +66,7 @@ struct NavMapIterationBuild3D {
 
 		iter_connection_pairs_map.clear();
 		iter_free_edges.clear();
+		iter_cluster_keys.clear();
 		polygon_count = 0;
 		free_edge_count = 0;
 
@@ -87,6 +91,11 @@ struct NavMapIteration3D {
 
 	LocalVector<Nav3D::Polygon> navlink_polygons;
 
+	// The abstract cluster graph used by hierarchical pathfinding, empty when disabled.
+	// Polygons are indexed in the same order as the path query slot polygon ids.
+	LocalVector<Nav3D::PolygonCluster> polygon_clusters;
+	LocalVector<uint32_t> polygon_cluster_ids;
+
 	HashMap<NavRegion3D *, Ref<NavRegionIteration3D>> region_ptr_to_region_iteration;
 
 	LocalVector<NavMeshQueries3D::PathQuerySlot> path_query_slots;
@@ -102,6 +111,8 @@ struct NavMapIteration3D {
 		external_region_connections.clear();
 		navbases_polygons_external_connections.clear();
 		navlink_polygons.clear();
+		polygon_clusters.clear();
+		polygon_cluster_ids.clear();
 		region_ptr_to_region_iteration.clear();
 	}
 };
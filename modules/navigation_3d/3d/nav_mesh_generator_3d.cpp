@@ -32,6 +32,8 @@
 
 #include "core/config/project_settings.h"
 #include "core/os/thread.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/pair.h"
 #include "scene/3d/node_3d.h"
 #include "scene/resources/3d/navigation_mesh_source_geometry_data_3d.h"
 #include "scene/resources/navigation_mesh.h"
@@ -158,10 +160,33 @@ void NavMeshGenerator3D::parse_source_geometry_data(Ref<NavigationMesh> p_naviga
 }
 
 void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+	generator_bake(p_navigation_mesh, p_source_geometry_data, AABB(), false, p_callback);
+}
+
+void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+	generator_bake_async(p_navigation_mesh, p_source_geometry_data, AABB(), false, p_callback);
+}
+
+void NavMeshGenerator3D::bake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND(p_navigation_mesh.is_null());
+	ERR_FAIL_COND_MSG(p_navigation_mesh->get_tile_size() <= 0.0, "NavigationMesh tile_size must be greater than 0.0 to bake tiles.");
+
+	generator_bake(p_navigation_mesh, p_source_geometry_data, p_changed_aabb, true, p_callback);
+}
+
+void NavMeshGenerator3D::bake_tiles_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND(p_navigation_mesh.is_null());
+	ERR_FAIL_COND_MSG(p_navigation_mesh->get_tile_size() <= 0.0, "NavigationMesh tile_size must be greater than 0.0 to bake tiles.");
+
+	generator_bake_async(p_navigation_mesh, p_source_geometry_data, p_changed_aabb, true, p_callback);
+}
+
+void NavMeshGenerator3D::generator_bake(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_changed_aabb, bool p_bake_changed_tiles_only, const Callable &p_callback) {
 	ERR_FAIL_COND(p_navigation_mesh.is_null());
 	ERR_FAIL_COND(p_source_geometry_data.is_null());
 
-	if (!p_source_geometry_data->has_data()) {
+	// Without any source geometry left the changed tiles still need to be removed from the navigation mesh.
+	if (!p_source_geometry_data->has_data() && !p_bake_changed_tiles_only) {
 		p_navigation_mesh->clear();
 		if (p_callback.is_valid()) {
 			generator_emit_callback(p_callback);
@@ -180,6 +205,8 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 
 	generator_task.navigation_mesh = p_navigation_mesh;
 	generator_task.source_geometry_data = p_source_geometry_data;
+	generator_task.changed_aabb = p_changed_aabb;
+	generator_task.bake_changed_tiles_only = p_bake_changed_tiles_only;
 	generator_task.status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
 
 	generator_bake_from_source_geometry_data(&generator_task);
@@ -195,11 +222,11 @@ void NavMeshGenerator3D::bake_from_source_geometry_data(Ref<NavigationMesh> p_na
 	p_navigation_mesh->emit_changed();
 }
 
-void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const Callable &p_callback) {
+void NavMeshGenerator3D::generator_bake_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_changed_aabb, bool p_bake_changed_tiles_only, const Callable &p_callback) {
 	ERR_FAIL_COND(p_navigation_mesh.is_null());
 	ERR_FAIL_COND(p_source_geometry_data.is_null());
 
-	if (!p_source_geometry_data->has_data()) {
+	if (!p_source_geometry_data->has_data() && !p_bake_changed_tiles_only) {
 		p_navigation_mesh->clear();
 		if (p_callback.is_valid()) {
 			generator_emit_callback(p_callback);
@@ -209,7 +236,7 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	}
 
 	if (!use_threads) {
-		bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback);
+		generator_bake(p_navigation_mesh, p_source_geometry_data, p_changed_aabb, p_bake_changed_tiles_only, p_callback);
 		return;
 	}
 
@@ -224,6 +251,8 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 
 	generator_task->navigation_mesh = p_navigation_mesh;
 	generator_task->source_geometry_data = p_source_geometry_data;
+	generator_task->changed_aabb = p_changed_aabb;
+	generator_task->bake_changed_tiles_only = p_bake_changed_tiles_only;
 	generator_task->callback = p_callback;
 	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
 	generator_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake, generator_task, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBake3D"));
@@ -301,27 +330,8 @@ void NavMeshGenerator3D::generator_parse_source_geometry_data(const Ref<Navigati
 	}
 }
 
-void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task) {
-	Ref<NavigationMesh> p_navigation_mesh = p_generator_task->navigation_mesh;
-	const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data = p_generator_task->source_geometry_data;
-
-	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
-		return;
-	}
-
-	Vector<float> source_geometry_vertices;
-	Vector<int> source_geometry_indices;
-	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
-
-	p_source_geometry_data->get_data(
-			source_geometry_vertices,
-			source_geometry_indices,
-			projected_obstructions);
-
-	if (source_geometry_vertices.size() < 3 || source_geometry_indices.size() < 3) {
-		return;
-	}
-
+// Runs the Recast steps from the heightfield creation up to the conversion to native navigation mesh data.
+static bool _generator_bake_recast(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, NavMeshGenerator3D::NavMeshBakeState &r_bake_state, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
 	rcHeightfield *hf = nullptr;
 	rcCompactHeightfield *chf = nullptr;
 	rcContourSet *cset = nullptr;
@@ -329,138 +339,48 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 	rcPolyMeshDetail *detail_mesh = nullptr;
 	rcContext ctx;
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
-
-	const float *verts = source_geometry_vertices.ptr();
-	const int nverts = source_geometry_vertices.size() / 3;
-	const int *tris = source_geometry_indices.ptr();
-	const int ntris = source_geometry_indices.size() / 3;
-
-	float bmin[3], bmax[3];
-	rcCalcBounds(verts, nverts, bmin, bmax);
-
-	rcConfig cfg;
-	memset(&cfg, 0, sizeof(cfg));
-
-	cfg.cs = p_navigation_mesh->get_cell_size();
-	cfg.ch = p_navigation_mesh->get_cell_height();
-	if (p_navigation_mesh->get_border_size() > 0.0) {
-		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
-	}
-	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
-	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
-
-	if (p_navigation_mesh->get_border_size() > 0.0 && !Math::is_zero_approx(Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()))) {
-		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
-		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
-		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
-		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
-		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
-		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
-		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
-	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
-		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
-	}
-	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
-		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
-	}
-
-	cfg.bmin[0] = bmin[0];
-	cfg.bmin[1] = bmin[1];
-	cfg.bmin[2] = bmin[2];
-	cfg.bmax[0] = bmax[0];
-	cfg.bmax[1] = bmax[1];
-	cfg.bmax[2] = bmax[2];
-
-	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
-	if (baking_aabb.has_volume()) {
-		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
-		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
-		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
-		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
-		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
-		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
-		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
-	}
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CALC_GRID_SIZE; // step #2
-	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
-
-	// ~30000000 seems to be around sweetspot where Editor baking breaks
-	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
-		ERR_FAIL_MSG("Baking interrupted."
-					 "\nNavigationMesh baking process would likely crash the engine."
-					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
-					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
-					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
-					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
-		return;
-	}
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_MARK_WALKABLE_TRIANGLES; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CONSTRUCT_COMPACT_HEIGHTFIELD; // step #5
 
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -475,13 +395,13 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_ERODE_WALKABLE_AREA; // step #6
 
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -496,43 +416,40 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 		}
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_SAMPLE_PARTITIONING; // step #7
 
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CREATING_CONTOURS; // step #8
 
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CREATING_POLYMESH; // step #9
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
 	rcFreeContourSet(cset);
 	cset = nullptr;
 
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
-
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_CONVERTING_NATIVE_NAVMESH; // step #10
 
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
@@ -546,7 +463,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -570,19 +487,526 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGenerat
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
-	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
+	r_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_BAKE_CLEANUP; // step #11
 
 	rcFreePolyMesh(poly_mesh);
 	poly_mesh = nullptr;
 	rcFreePolyMeshDetail(detail_mesh);
 	detail_mesh = nullptr;
 
+	return true;
+}
+
+
+struct NavMeshBakeTile3D {
+	Vector2i coords;
+	rcConfig cfg;
+	LocalVector<int> tris;
+
+	Vector<Vector3> vertices;
+	Vector<Vector<int>> polygons;
+};
+
+struct NavMeshBakeTiles3D {
+	Ref<NavigationMesh> navigation_mesh;
+	const float *verts = nullptr;
+	int nverts = 0;
+	const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> *projected_obstructions = nullptr;
+	LocalVector<NavMeshBakeTile3D> tiles;
+};
+
+static void _generator_thread_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshBakeTiles3D *bake_tiles = static_cast<NavMeshBakeTiles3D *>(p_arg);
+	NavMeshBakeTile3D &tile = bake_tiles->tiles[p_index];
+
+	// Tiles are baked in parallel so each one reports to its own state that nobody reads.
+	NavMeshGenerator3D::NavMeshBakeState tile_bake_state = NavMeshGenerator3D::NavMeshBakeState::BAKE_STATE_NONE;
+	_generator_bake_recast(bake_tiles->navigation_mesh, tile.cfg, bake_tiles->verts, bake_tiles->nverts, tile.tris.ptr(), tile.tris.size() / 3, *bake_tiles->projected_obstructions, tile_bake_state, tile.vertices, tile.polygons);
+}
+
+static inline Vector2i _get_tile_coords(const Vector3 &p_position, real_t p_tile_world_size) {
+	return Vector2i((int)Math::floor(p_position.x / p_tile_world_size), (int)Math::floor(p_position.z / p_tile_world_size));
+}
+
+// Returns the tile line the vertex lies on as (axis, line index), or (-1, 0) if it is not on a tile line for that axis.
+static inline Vector2i _get_tile_line(const Vector3 &p_vertex, int p_axis, real_t p_tile_world_size, real_t p_epsilon) {
+	const real_t value = p_axis == 0 ? p_vertex.x : p_vertex.z;
+	const int line = (int)Math::round(value / p_tile_world_size);
+	if (Math::abs(value - line * p_tile_world_size) > p_epsilon) {
+		return Vector2i(-1, 0);
+	}
+	return Vector2i(p_axis, line);
+}
+
+static void _generator_bake_tiles(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, const AABB &p_changed_aabb, bool p_bake_changed_tiles_only, bool p_use_group_task) {
+	const int tile_cells = MAX(1, (int)Math::round(p_navigation_mesh->get_tile_size() / p_cfg.cs));
+	const real_t tile_world_size = tile_cells * p_cfg.cs;
+
+	if (!Math::is_equal_approx(tile_world_size, (real_t)p_navigation_mesh->get_tile_size())) {
+		WARN_PRINT("Property tile_size is rounded to cell_size voxel units and loses precision.");
+	}
+
+	// Tiles need enough border voxels so that erosion and region building see the geometry of their neighbors.
+	p_cfg.tileSize = tile_cells;
+	p_cfg.borderSize = MAX(p_cfg.borderSize, p_cfg.walkableRadius + 3);
+	p_cfg.width = tile_cells + p_cfg.borderSize * 2;
+	p_cfg.height = tile_cells + p_cfg.borderSize * 2;
+
+	const real_t border_world_size = p_cfg.borderSize * p_cfg.cs;
+
+	// Snap the height bounds to cell_height so rebaked tiles voxelize at the same heights as the tiles they are stitched to.
+	p_cfg.bmin[1] = Math::floor(p_cfg.bmin[1] / p_cfg.ch) * p_cfg.ch;
+	p_cfg.bmax[1] = Math::ceil(p_cfg.bmax[1] / p_cfg.ch) * p_cfg.ch;
+
+	Vector2 area_min = Vector2(p_cfg.bmin[0], p_cfg.bmin[2]);
+	Vector2 area_max = Vector2(p_cfg.bmax[0], p_cfg.bmax[2]);
+	Vector2i tiles_min;
+	Vector2i tiles_max;
+	if (p_bake_changed_tiles_only) {
+		const Vector3 changed_end = p_changed_aabb.get_end();
+		area_min = Vector2(p_changed_aabb.position.x, p_changed_aabb.position.z);
+		area_max = Vector2(changed_end.x, changed_end.z);
+
+		AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+		if (baking_aabb.has_volume()) {
+			baking_aabb.position += p_navigation_mesh->get_filter_baking_aabb_offset();
+			const Vector3 baking_end = baking_aabb.get_end();
+			area_min = area_min.max(Vector2(baking_aabb.position.x, baking_aabb.position.z));
+			area_max = area_max.min(Vector2(baking_end.x, baking_end.z));
+		}
+		if (area_min.x > area_max.x || area_min.y > area_max.y) {
+			return;
+		}
+
+		// A change affects every tile whose bordered bounds overlap it.
+		tiles_min = Vector2i((int)Math::ceil((area_min.x - border_world_size) / tile_world_size) - 1, (int)Math::ceil((area_min.y - border_world_size) / tile_world_size) - 1);
+		tiles_max = Vector2i((int)Math::floor((area_max.x + border_world_size) / tile_world_size), (int)Math::floor((area_max.y + border_world_size) / tile_world_size));
+	} else {
+		tiles_min = Vector2i((int)Math::floor(area_min.x / tile_world_size), (int)Math::floor(area_min.y / tile_world_size));
+		tiles_max = Vector2i((int)Math::floor(area_max.x / tile_world_size), (int)Math::floor(area_max.y / tile_world_size));
+	}
+
+	const int64_t tile_count = int64_t(tiles_max.x - tiles_min.x + 1) * int64_t(tiles_max.y - tiles_min.y + 1);
+	if (tile_count * p_cfg.width * p_cfg.height > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_MSG("Baking interrupted."
+					 "\nNavigationMesh tile baking process would likely crash the engine."
+					 "\nThe area to bake is suspiciously big for the current Cell Size and Tile Size in the NavMesh Resource bake settings."
+					 "\nIt is advised to increase Cell Size and/or reduce the size of the changed area."
+					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+	}
+
+	ERR_FAIL_COND_MSG(tile_count > (1 << 20), "Too many NavigationMesh tiles to bake, increase tile_size or reduce the size of the changed area.");
+
+	NavMeshBakeTiles3D bake_tiles;
+	bake_tiles.navigation_mesh = p_navigation_mesh;
+	bake_tiles.verts = p_verts;
+	bake_tiles.nverts = p_nverts;
+	bake_tiles.projected_obstructions = &p_projected_obstructions;
+	bake_tiles.tiles.resize(tile_count);
+
+	HashMap<Vector2i, uint32_t> tile_indices;
+	uint32_t tile_index = 0;
+	for (int z = tiles_min.y; z <= tiles_max.y; z++) {
+		for (int x = tiles_min.x; x <= tiles_max.x; x++) {
+			NavMeshBakeTile3D &tile = bake_tiles.tiles[tile_index];
+			tile.coords = Vector2i(x, z);
+			tile.cfg = p_cfg;
+			tile.cfg.bmin[0] = x * tile_world_size - border_world_size;
+			tile.cfg.bmin[2] = z * tile_world_size - border_world_size;
+			tile.cfg.bmax[0] = (x + 1) * tile_world_size + border_world_size;
+			tile.cfg.bmax[2] = (z + 1) * tile_world_size + border_world_size;
+			tile_indices[tile.coords] = tile_index;
+			tile_index++;
+		}
+	}
+
+	// Assign every source triangle to the tiles whose bordered bounds it overlaps.
+	for (int i = 0; i < p_ntris; i++) {
+		const int *tri = &p_tris[i * 3];
+		Vector2 tri_min = Vector2(p_verts[tri[0] * 3 + 0], p_verts[tri[0] * 3 + 2]);
+		Vector2 tri_max = tri_min;
+		for (int j = 1; j < 3; j++) {
+			const Vector2 vertex = Vector2(p_verts[tri[j] * 3 + 0], p_verts[tri[j] * 3 + 2]);
+			tri_min = tri_min.min(vertex);
+			tri_max = tri_max.max(vertex);
+		}
+
+		const int x_begin = MAX(tiles_min.x, (int)Math::floor((tri_min.x - border_world_size) / tile_world_size));
+		const int x_end = MIN(tiles_max.x, (int)Math::floor((tri_max.x + border_world_size) / tile_world_size));
+		const int z_begin = MAX(tiles_min.y, (int)Math::floor((tri_min.y - border_world_size) / tile_world_size));
+		const int z_end = MIN(tiles_max.y, (int)Math::floor((tri_max.y + border_world_size) / tile_world_size));
+		for (int z = z_begin; z <= z_end; z++) {
+			for (int x = x_begin; x <= x_end; x++) {
+				LocalVector<int> &tile_tris = bake_tiles.tiles[tile_indices[Vector2i(x, z)]].tris;
+				tile_tris.push_back(tri[0]);
+				tile_tris.push_back(tri[1]);
+				tile_tris.push_back(tri[2]);
+			}
+		}
+	}
+
+	// Tiles without geometry are skipped but still count as rebaked so that their old polygons are removed.
+	LocalVector<uint32_t> tiles_to_bake;
+	for (uint32_t i = 0; i < bake_tiles.tiles.size(); i++) {
+		if (!bake_tiles.tiles[i].tris.is_empty()) {
+			tiles_to_bake.push_back(i);
+		}
+	}
+
+	if (p_use_group_task && tiles_to_bake.size() > 1) {
+		// Compact the tiles with geometry to the front so the group task indices map directly to them.
+		LocalVector<NavMeshBakeTile3D> empty_tiles;
+		LocalVector<NavMeshBakeTile3D> baked_tiles;
+		for (NavMeshBakeTile3D &tile : bake_tiles.tiles) {
+			if (tile.tris.is_empty()) {
+				empty_tiles.push_back(tile);
+			} else {
+				baked_tiles.push_back(tile);
+			}
+		}
+		const uint32_t baked_tile_count = baked_tiles.size();
+		for (NavMeshBakeTile3D &tile : empty_tiles) {
+			baked_tiles.push_back(tile);
+		}
+		bake_tiles.tiles = baked_tiles;
+
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&_generator_thread_bake_tile, &bake_tiles, baked_tile_count, -1, true, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t index : tiles_to_bake) {
+			_generator_thread_bake_tile(&bake_tiles, index);
+		}
+	}
+
+	HashSet<Vector2i> rebaked_tiles;
+	for (const NavMeshBakeTile3D &tile : bake_tiles.tiles) {
+		rebaked_tiles.insert(tile.coords);
+	}
+
+	const real_t epsilon = p_cfg.cs * 0.25;
+	const real_t height_tolerance = p_navigation_mesh->get_agent_max_climb() + p_cfg.ch;
+
+	// Tiles next to a rebaked tile need their seam polygons repaired against the new tile polygons.
+	HashSet<Vector2i> involved_tiles;
+	for (const Vector2i &coords : rebaked_tiles) {
+		involved_tiles.insert(coords);
+		involved_tiles.insert(coords + Vector2i(1, 0));
+		involved_tiles.insert(coords + Vector2i(-1, 0));
+		involved_tiles.insert(coords + Vector2i(0, 1));
+		involved_tiles.insert(coords + Vector2i(0, -1));
+	}
+
+	LocalVector<LocalVector<Vector3>> polygons;
+	LocalVector<bool> polygons_involved;
+
+	if (p_bake_changed_tiles_only) {
+		Vector<Vector3> old_vertices;
+		Vector<Vector<int>> old_polygons;
+		p_navigation_mesh->get_data(old_vertices, old_polygons);
+
+		for (const Vector<int> &old_polygon : old_polygons) {
+			LocalVector<Vector3> polygon;
+			Vector3 centroid;
+			for (int index : old_polygon) {
+				ERR_CONTINUE(index < 0 || index >= old_vertices.size());
+				polygon.push_back(old_vertices[index]);
+				centroid += old_vertices[index];
+			}
+			if (polygon.size() < 3) {
+				continue;
+			}
+			centroid /= polygon.size();
+
+			const Vector2i coords = _get_tile_coords(centroid, tile_world_size);
+			if (rebaked_tiles.has(coords)) {
+				continue;
+			}
+
+			const bool involved = involved_tiles.has(coords);
+			if (involved) {
+				// Drop seam vertices inserted by an earlier stitch towards a rebaked tile, the repair below adds the new ones.
+				for (uint32_t i = 0; i < polygon.size() && polygon.size() > 3;) {
+					const Vector3 &prev = polygon[(i + polygon.size() - 1) % polygon.size()];
+					const Vector3 &next = polygon[(i + 1) % polygon.size()];
+					bool remove = false;
+					for (int axis = 0; axis < 2 && !remove; axis++) {
+						const Vector2i line = _get_tile_line(polygon[i], axis, tile_world_size, epsilon);
+						if (line.x < 0 || _get_tile_line(prev, axis, tile_world_size, epsilon) != line || _get_tile_line(next, axis, tile_world_size, epsilon) != line) {
+							continue;
+						}
+						const int own = axis == 0 ? coords.x : coords.y;
+						const Vector2i other = axis == 0 ? Vector2i(line.y == own ? own - 1 : own + 1, coords.y) : Vector2i(coords.x, line.y == own ? own - 1 : own + 1);
+						remove = rebaked_tiles.has(other);
+					}
+					if (remove) {
+						polygon.remove_at(i);
+					} else {
+						i++;
+					}
+				}
+			}
+
+			polygons.push_back(polygon);
+			polygons_involved.push_back(involved);
+		}
+	}
+
+	for (const NavMeshBakeTile3D &tile : bake_tiles.tiles) {
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			LocalVector<Vector3> polygon;
+			for (int index : tile_polygon) {
+				polygon.push_back(tile.vertices[index]);
+			}
+			polygons.push_back(polygon);
+			polygons_involved.push_back(true);
+		}
+	}
+
+	// Collect the vertices on tile lines so the polygon edges along the tile seams can be split at the vertices of the neighbor tile.
+	HashMap<Vector2i, LocalVector<Vector3>> tile_line_vertices;
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		if (!polygons_involved[i]) {
+			continue;
+		}
+		for (const Vector3 &vertex : polygons[i]) {
+			for (int axis = 0; axis < 2; axis++) {
+				const Vector2i line = _get_tile_line(vertex, axis, tile_world_size, epsilon);
+				if (line.x >= 0) {
+					tile_line_vertices[line].push_back(vertex);
+				}
+			}
+		}
+	}
+
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		if (!polygons_involved[i]) {
+			continue;
+		}
+
+		const LocalVector<Vector3> &polygon = polygons[i];
+		LocalVector<Vector3> repaired_polygon;
+		for (uint32_t j = 0; j < polygon.size(); j++) {
+			const Vector3 &a = polygon[j];
+			const Vector3 &b = polygon[(j + 1) % polygon.size()];
+			repaired_polygon.push_back(a);
+
+			for (int axis = 0; axis < 2; axis++) {
+				const Vector2i line = _get_tile_line(a, axis, tile_world_size, epsilon);
+				if (line.x < 0 || _get_tile_line(b, axis, tile_world_size, epsilon) != line) {
+					continue;
+				}
+				const LocalVector<Vector3> *line_vertices = tile_line_vertices.getptr(line);
+				if (!line_vertices) {
+					break;
+				}
+
+				const real_t from = axis == 0 ? a.z : a.x;
+				const real_t to = axis == 0 ? b.z : b.x;
+				LocalVector<Pair<real_t, Vector3>> splits;
+				for (const Vector3 &vertex : *line_vertices) {
+					const real_t along = axis == 0 ? vertex.z : vertex.x;
+					if (along <= MIN(from, to) + epsilon || along >= MAX(from, to) - epsilon) {
+						continue;
+					}
+					const real_t weight = (along - from) / (to - from);
+					if (Math::abs(vertex.y - Math::lerp(a.y, b.y, weight)) > height_tolerance) {
+						continue;
+					}
+					splits.push_back(Pair<real_t, Vector3>(weight, vertex));
+				}
+				splits.sort_custom<PairSort<real_t, Vector3>>();
+				for (const Pair<real_t, Vector3> &split : splits) {
+					if (!repaired_polygon.is_empty() && repaired_polygon[repaired_polygon.size() - 1].is_equal_approx(split.second)) {
+						continue;
+					}
+					repaired_polygon.push_back(split.second);
+				}
+				break;
+			}
+		}
+		polygons[i] = repaired_polygon;
+	}
+
+	// Weld the vertices of all tiles so that seam edges share the same vertices.
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	HashMap<Vector3i, int> weld_vertex_to_index;
+	const Vector3 weld_size = Vector3(p_cfg.cs, p_cfg.ch, p_cfg.cs) * 0.25;
+
+	for (const LocalVector<Vector3> &polygon : polygons) {
+		Vector<int> nav_indices;
+		for (const Vector3 &vertex : polygon) {
+			const Vector3i key = Vector3i((vertex / weld_size).round());
+			int index;
+			const int *existing_index_ptr = weld_vertex_to_index.getptr(key);
+			if (existing_index_ptr) {
+				index = *existing_index_ptr;
+			} else {
+				index = nav_vertices.size();
+				weld_vertex_to_index[key] = index;
+				nav_vertices.push_back(vertex);
+			}
+			if (nav_indices.is_empty() || nav_indices[nav_indices.size() - 1] != index) {
+				nav_indices.push_back(index);
+			}
+		}
+		if (nav_indices.size() > 1 && nav_indices[0] == nav_indices[nav_indices.size() - 1]) {
+			nav_indices.remove_at(nav_indices.size() - 1);
+		}
+		if (nav_indices.size() >= 3) {
+			nav_polygons.push_back(nav_indices);
+		}
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+}
+
+void NavMeshGenerator3D::generator_bake_from_source_geometry_data(NavMeshGeneratorTask3D *p_generator_task) {
+	Ref<NavigationMesh> p_navigation_mesh = p_generator_task->navigation_mesh;
+	const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data = p_generator_task->source_geometry_data;
+
+	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
+		return;
+	}
+
+	Vector<float> source_geometry_vertices;
+	Vector<int> source_geometry_indices;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+
+	p_source_geometry_data->get_data(
+			source_geometry_vertices,
+			source_geometry_indices,
+			projected_obstructions);
+
+	const bool bake_changed_tiles_only = p_generator_task->bake_changed_tiles_only;
+	const bool has_geometry = source_geometry_vertices.size() >= 3 && source_geometry_indices.size() >= 3;
+
+	// Changed tiles are still rebaked without geometry so that their old polygons get removed.
+	if (!has_geometry && !bake_changed_tiles_only) {
+		return;
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CONFIGURATION; // step #1
+
+	const float *verts = source_geometry_vertices.ptr();
+	const int nverts = has_geometry ? source_geometry_vertices.size() / 3 : 0;
+	const int *tris = source_geometry_indices.ptr();
+	const int ntris = has_geometry ? source_geometry_indices.size() / 3 : 0;
+
+	rcConfig cfg;
+	memset(&cfg, 0, sizeof(cfg));
+
+	cfg.cs = p_navigation_mesh->get_cell_size();
+	cfg.ch = p_navigation_mesh->get_cell_height();
+	if (p_navigation_mesh->get_border_size() > 0.0) {
+		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
+	}
+	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
+	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
+	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
+	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
+	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
+	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
+	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
+	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
+	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
+	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
+	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
+
+	if (p_navigation_mesh->get_border_size() > 0.0 && !Math::is_zero_approx(Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()))) {
+		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
+		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
+		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
+	}
+	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
+	}
+	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
+		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
+	}
+
+	if (nverts > 0) {
+		float bmin[3], bmax[3];
+		rcCalcBounds(verts, nverts, bmin, bmax);
+
+		cfg.bmin[0] = bmin[0];
+		cfg.bmin[1] = bmin[1];
+		cfg.bmin[2] = bmin[2];
+		cfg.bmax[0] = bmax[0];
+		cfg.bmax[1] = bmax[1];
+		cfg.bmax[2] = bmax[2];
+	}
+
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
+		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
+		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
+		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
+		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
+		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
+	}
+
+	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CALC_GRID_SIZE; // step #2
+
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		// Tiles are baked in parallel unless this already runs on a worker thread, which would block waiting for the tile tasks.
+		const bool use_group_task = use_threads && WorkerThreadPool::get_singleton()->get_thread_index() == -1;
+
+		p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_CREATE_HEIGHTFIELD; // steps #3 to #11 for each tile
+		_generator_bake_tiles(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, p_generator_task->changed_aabb, bake_changed_tiles_only, use_group_task);
+
+		p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
+		return;
+	}
+
+	if (!has_geometry) {
+		return;
+	}
+
+	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+
+	// ~30000000 seems to be around sweetspot where Editor baking breaks
+	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_MSG("Baking interrupted."
+					 "\nNavigationMesh baking process would likely crash the engine."
+					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
+					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
+					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
+					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
+		return;
+	}
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+
+	if (!_generator_bake_recast(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, p_generator_task->bake_state, nav_vertices, nav_polygons)) {
+		return;
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
+
 	p_generator_task->bake_state = NavMeshBakeState::BAKE_STATE_BAKE_FINISHED; // step #12
 }
 
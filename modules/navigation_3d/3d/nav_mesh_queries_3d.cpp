@@ -36,6 +36,7 @@
 
 #include "core/math/geometry_2d.h"
 #include "core/math/geometry_3d.h"
+#include "core/templates/frame_arena.h"
 #include "servers/navigation/navigation_utilities.h"
 
 using namespace Nav3D;
@@ -52,6 +53,51 @@ bool NavMeshQueries3D::emit_callback(const Callable &p_callback) {
 	return ce.error == Callable::CallError::CALL_OK;
 }
 
+Vector3 NavMeshQueries3D::polygon_get_random_point(const Polygon &p_polygon, bool p_uniformly) {
+	if (p_polygon.vertices.size() < 3) {
+		return Vector3();
+	}
+
+	if (p_uniformly) {
+		real_t accumulated_polygon_area = 0;
+		RBMap<real_t, uint32_t> polygon_area_map;
+
+		for (uint32_t rpp_index = 2; rpp_index < p_polygon.vertices.size(); rpp_index++) {
+			real_t face_area = Face3(p_polygon.vertices[0], p_polygon.vertices[rpp_index - 1], p_polygon.vertices[rpp_index]).get_area();
+
+			if (face_area == 0.0) {
+				continue;
+			}
+			polygon_area_map[accumulated_polygon_area] = rpp_index;
+			accumulated_polygon_area += face_area;
+		}
+		if (polygon_area_map.is_empty() || accumulated_polygon_area == 0) {
+			// All faces have no real surface / no area.
+			return Vector3();
+		}
+
+		real_t polygon_area_map_pos = Math::random(real_t(0), accumulated_polygon_area);
+
+		RBMap<real_t, uint32_t>::Iterator polygon_E = polygon_area_map.find_closest(polygon_area_map_pos);
+		ERR_FAIL_COND_V(!polygon_E, Vector3());
+		uint32_t rrp_face_index = polygon_E->value;
+		ERR_FAIL_UNSIGNED_INDEX_V(rrp_face_index, p_polygon.vertices.size(), Vector3());
+
+		const Face3 face(p_polygon.vertices[0], p_polygon.vertices[rrp_face_index - 1], p_polygon.vertices[rrp_face_index]);
+
+		Vector3 face_random_position = face.get_random_point_inside();
+		return face_random_position;
+
+	} else {
+		uint32_t rrp_face_index = Math::random(int(2), p_polygon.vertices.size() - 1);
+
+		const Face3 face(p_polygon.vertices[0], p_polygon.vertices[rrp_face_index - 1], p_polygon.vertices[rrp_face_index]);
+
+		Vector3 face_random_position = face.get_random_point_inside();
+		return face_random_position;
+	}
+}
+
 Vector3 NavMeshQueries3D::polygons_get_random_point(const LocalVector<Polygon> &p_polygons, uint32_t p_navigation_layers, bool p_uniformly) {
 	const LocalVector<Polygon> &region_polygons = p_polygons;
 
@@ -85,48 +131,12 @@ Vector3 NavMeshQueries3D::polygons_get_random_point(const LocalVector<Polygon> &
 		uint32_t rrp_polygon_index = region_E->value;
 		ERR_FAIL_UNSIGNED_INDEX_V(rrp_polygon_index, region_polygons.size(), Vector3());
 
-		const Polygon &rr_polygon = region_polygons[rrp_polygon_index];
-
-		real_t accumulated_polygon_area = 0;
-		RBMap<real_t, uint32_t> polygon_area_map;
-
-		for (uint32_t rpp_index = 2; rpp_index < rr_polygon.vertices.size(); rpp_index++) {
-			real_t face_area = Face3(rr_polygon.vertices[0], rr_polygon.vertices[rpp_index - 1], rr_polygon.vertices[rpp_index]).get_area();
-
-			if (face_area == 0.0) {
-				continue;
-			}
-			polygon_area_map[accumulated_polygon_area] = rpp_index;
-			accumulated_polygon_area += face_area;
-		}
-		if (polygon_area_map.is_empty() || accumulated_polygon_area == 0) {
-			// All faces have no real surface / no area.
-			return Vector3();
-		}
-
-		real_t polygon_area_map_pos = Math::random(real_t(0), accumulated_polygon_area);
-
-		RBMap<real_t, uint32_t>::Iterator polygon_E = polygon_area_map.find_closest(polygon_area_map_pos);
-		ERR_FAIL_COND_V(!polygon_E, Vector3());
-		uint32_t rrp_face_index = polygon_E->value;
-		ERR_FAIL_UNSIGNED_INDEX_V(rrp_face_index, rr_polygon.vertices.size(), Vector3());
-
-		const Face3 face(rr_polygon.vertices[0], rr_polygon.vertices[rrp_face_index - 1], rr_polygon.vertices[rrp_face_index]);
-
-		Vector3 face_random_position = face.get_random_point_inside();
-		return face_random_position;
+		return polygon_get_random_point(region_polygons[rrp_polygon_index], p_uniformly);
 
 	} else {
 		uint32_t rrp_polygon_index = Math::random(int(0), region_polygons.size() - 1);
 
-		const Polygon &rr_polygon = region_polygons[rrp_polygon_index];
-
-		uint32_t rrp_face_index = Math::random(int(2), rr_polygon.vertices.size() - 1);
-
-		const Face3 face(rr_polygon.vertices[0], rr_polygon.vertices[rrp_face_index - 1], rr_polygon.vertices[rrp_face_index]);
-
-		Vector3 face_random_position = face.get_random_point_inside();
-		return face_random_position;
+		return polygon_get_random_point(region_polygons[rrp_polygon_index], p_uniformly);
 	}
 }
 
@@ -146,18 +156,13 @@ void NavMeshQueries3D::_query_task_push_back_point_with_metadata(NavMeshPathQuer
 	p_query_task.path_points.push_back(p_point);
 }
 
-void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
-	ERR_FAIL_NULL(map);
-	ERR_FAIL_COND(p_query_parameters.is_null());
-	ERR_FAIL_COND(p_query_result.is_null());
-
+void NavMeshQueries3D::query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters) {
 	using namespace NavigationUtilities;
 
-	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	NavMeshPathQueryTask3D &query_task = p_query_task;
 	query_task.start_position = p_query_parameters->get_start_position();
 	query_task.target_position = p_query_parameters->get_target_position();
 	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
-	query_task.callback = p_callback;
 
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
@@ -216,25 +221,107 @@ void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQue
 	query_task.path_search_max_polygons = p_query_parameters->get_path_search_max_polygons();
 	query_task.path_search_max_distance = p_query_parameters->get_path_search_max_distance();
 	query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
+}
 
-	map->query_path(query_task);
+void NavMeshQueries3D::query_task_dispatch_result(NavMeshPathQueryTask3D &p_query_task) {
+	ERR_FAIL_COND(p_query_task.query_result.is_null());
 
-	p_query_result->set_data(
-			query_task.path_points,
-			query_task.path_meta_point_types,
-			query_task.path_meta_point_rids,
-			query_task.path_meta_point_owners);
-	p_query_result->set_path_length(query_task.path_length);
+	p_query_task.query_result->set_data(
+			p_query_task.path_points,
+			p_query_task.path_meta_point_types,
+			p_query_task.path_meta_point_rids,
+			p_query_task.path_meta_point_owners);
+	p_query_task.query_result->set_path_length(p_query_task.path_length);
 
-	if (query_task.callback.is_valid()) {
-		if (emit_callback(query_task.callback)) {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
+	if (p_query_task.callback.is_valid()) {
+		if (emit_callback(p_query_task.callback)) {
+			p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_DISPATCHED;
 		} else {
-			query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
+			p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::CALLBACK_FAILED;
 		}
 	}
 }
 
+void NavMeshQueries3D::map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D query_task;
+	query_task_set_parameters(query_task, p_query_parameters);
+	query_task.query_result = p_query_result;
+	query_task.callback = p_callback;
+
+	map->query_path(query_task);
+
+	query_task_dispatch_result(query_task);
+}
+
+void NavMeshQueries3D::map_queue_path_query(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMeshQueries3D::NavMeshPathQueryTask3D *query_task = memnew(NavMeshQueries3D::NavMeshPathQueryTask3D);
+	query_task_set_parameters(*query_task, p_query_parameters);
+	query_task->query_result = p_query_result;
+	query_task->callback = p_callback;
+
+	map->queue_path_query(query_task);
+}
+
+bool NavMeshQueries3D::query_task_has_same_request(const NavMeshPathQueryTask3D &p_query_task_a, const NavMeshPathQueryTask3D &p_query_task_b) {
+	// Only compares what the path search reads after the start and end positions were snapped to the navigation mesh.
+	// The raw target position is kept as the search falls back to the polygon closest to it when the end is unreachable.
+	if (p_query_task_a.begin_polygon != p_query_task_b.begin_polygon ||
+			p_query_task_a.end_polygon != p_query_task_b.end_polygon ||
+			p_query_task_a.begin_position != p_query_task_b.begin_position ||
+			p_query_task_a.end_position != p_query_task_b.end_position ||
+			p_query_task_a.target_position != p_query_task_b.target_position ||
+			p_query_task_a.navigation_layers != p_query_task_b.navigation_layers ||
+			p_query_task_a.metadata_flags != p_query_task_b.metadata_flags ||
+			p_query_task_a.pathfinding_algorithm != p_query_task_b.pathfinding_algorithm ||
+			p_query_task_a.path_postprocessing != p_query_task_b.path_postprocessing ||
+			p_query_task_a.simplify_path != p_query_task_b.simplify_path ||
+			p_query_task_a.simplify_epsilon != p_query_task_b.simplify_epsilon ||
+			p_query_task_a.path_return_max_length != p_query_task_b.path_return_max_length ||
+			p_query_task_a.path_return_max_radius != p_query_task_b.path_return_max_radius ||
+			p_query_task_a.path_search_max_polygons != p_query_task_b.path_search_max_polygons ||
+			p_query_task_a.path_search_max_distance != p_query_task_b.path_search_max_distance ||
+			p_query_task_a.excluded_regions.size() != p_query_task_b.excluded_regions.size() ||
+			p_query_task_a.included_regions.size() != p_query_task_b.included_regions.size()) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < p_query_task_a.excluded_regions.size(); i++) {
+		if (p_query_task_a.excluded_regions[i] != p_query_task_b.excluded_regions[i]) {
+			return false;
+		}
+	}
+	for (uint32_t i = 0; i < p_query_task_a.included_regions.size(); i++) {
+		if (p_query_task_a.included_regions[i] != p_query_task_b.included_regions[i]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t NavMeshQueries3D::query_task_hash_request(const NavMeshPathQueryTask3D &p_query_task) {
+	uint32_t h = hash_murmur3_one_64((uint64_t)p_query_task.begin_polygon);
+	h = hash_murmur3_one_64((uint64_t)p_query_task.end_polygon, h);
+	h = hash_murmur3_one_real(p_query_task.end_position.x, h);
+	h = hash_murmur3_one_real(p_query_task.end_position.y, h);
+	h = hash_murmur3_one_real(p_query_task.end_position.z, h);
+	h = hash_murmur3_one_real(p_query_task.begin_position.x, h);
+	h = hash_murmur3_one_real(p_query_task.begin_position.y, h);
+	h = hash_murmur3_one_real(p_query_task.begin_position.z, h);
+	h = hash_murmur3_one_32(p_query_task.navigation_layers, h);
+	h = hash_murmur3_one_32(p_query_task.excluded_regions.size(), h);
+	h = hash_murmur3_one_32(p_query_task.included_regions.size(), h);
+	return hash_fmix32(h);
+}
+
 void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	real_t begin_d = FLT_MAX;
 	real_t end_d = FLT_MAX;
@@ -246,33 +333,30 @@ void NavMeshQueries3D::_query_task_find_start_end_positions(NavMeshPathQueryTask
 			continue;
 		}
 
-		// Find the initial poly and the end poly on this map.
-		for (const Polygon &p : region->get_navmesh_polygons()) {
-			// Only consider the polygon if it in a region with compatible layers.
-			if ((p_query_task.navigation_layers & p.owner->get_navigation_layers()) == 0) {
-				continue;
-			}
+		// Only consider the polygons if they are in a region with compatible layers.
+		if ((p_query_task.navigation_layers & region->get_navigation_layers()) == 0) {
+			continue;
+		}
 
-			// For each face check the distance between the origin/destination.
-			for (uint32_t point_id = 2; point_id < p.vertices.size(); point_id++) {
-				const Face3 face(p.vertices[0], p.vertices[point_id - 1], p.vertices[point_id]);
+		const LocalVector<Polygon> &polygons = region->get_navmesh_polygons();
+		const NavPolygonBVH3D &polygons_bvh = region->get_polygons_bvh();
+		Vector3 point;
 
-				Vector3 point = face.get_closest_point_to(p_query_task.start_position);
-				real_t distance_to_point = point.distance_to(p_query_task.start_position);
-				if (distance_to_point < begin_d) {
-					begin_d = distance_to_point;
-					p_query_task.begin_polygon = &p;
-					p_query_task.begin_position = point;
-				}
+		// Find the initial poly and the end poly on this map.
+		int32_t polygon_index = polygons_bvh.find_closest(p_query_task.start_position, begin_d, [&](int32_t p_polygon_index) {
+			return polygon_get_closest_face_point(polygons[p_polygon_index], p_query_task.start_position, point);
+		});
+		if (polygon_index >= 0) {
+			p_query_task.begin_polygon = &polygons[polygon_index];
+			polygon_get_closest_face_point(polygons[polygon_index], p_query_task.start_position, p_query_task.begin_position);
+		}
 
-				point = face.get_closest_point_to(p_query_task.target_position);
-				distance_to_point = point.distance_to(p_query_task.target_position);
-				if (distance_to_point < end_d) {
-					end_d = distance_to_point;
-					p_query_task.end_polygon = &p;
-					p_query_task.end_position = point;
-				}
-			}
+		polygon_index = polygons_bvh.find_closest(p_query_task.target_position, end_d, [&](int32_t p_polygon_index) {
+			return polygon_get_closest_face_point(polygons[p_polygon_index], p_query_task.target_position, point);
+		});
+		if (polygon_index >= 0) {
+			p_query_task.end_polygon = &polygons[polygon_index];
+			polygon_get_closest_face_point(polygons[polygon_index], p_query_task.target_position, p_query_task.end_position);
 		}
 	}
 }
@@ -294,8 +378,16 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	Vector3 new_entry = Geometry3D::get_closest_point_to_segment(p_least_cost_poly.entry, p_connection.pathway_start, p_connection.pathway_end);
 	real_t new_traveled_distance = p_least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + p_poly_enter_cost + p_least_cost_poly.traveled_distance;
 
+	const uint32_t neighbor_poly_id = p_query_task.path_query_slot->poly_to_id[p_connection.polygon];
+	if (p_query_task.path_query_slot->use_cluster_corridor) {
+		const uint32_t neighbor_cluster_id = p_query_task.path_query_slot->poly_to_cluster[neighbor_poly_id];
+		if (neighbor_cluster_id != UINT32_MAX && !p_query_task.path_query_slot->path_clusters[neighbor_cluster_id].in_corridor) {
+			return;
+		}
+	}
+
 	// Check if the neighbor polygon has already been processed.
-	NavigationPoly &neighbor_poly = navigation_polys[p_query_task.path_query_slot->poly_to_id[p_connection.polygon]];
+	NavigationPoly &neighbor_poly = navigation_polys[neighbor_poly_id];
 	if (new_traveled_distance < neighbor_poly.traveled_distance) {
 		// Add the polygon to the heap of polygons to traverse next.
 		neighbor_poly.back_navigation_poly_id = p_least_cost_id;
@@ -317,6 +409,96 @@ void NavMeshQueries3D::_query_task_search_polygon_connections(NavMeshPathQueryTa
 	}
 }
 
+bool NavMeshQueries3D::_query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	PathQuerySlot *path_query_slot = p_query_task.path_query_slot;
+	path_query_slot->use_cluster_corridor = false;
+
+	const LocalVector<PolygonCluster> &clusters = p_map_iteration.polygon_clusters;
+	if (clusters.is_empty()) {
+		return false;
+	}
+
+	const uint32_t begin_cluster_id = path_query_slot->poly_to_cluster[path_query_slot->poly_to_id[p_query_task.begin_polygon]];
+	const uint32_t end_cluster_id = path_query_slot->poly_to_cluster[path_query_slot->poly_to_id[p_query_task.end_polygon]];
+	if (begin_cluster_id == UINT32_MAX || end_cluster_id == UINT32_MAX || begin_cluster_id == end_cluster_id) {
+		return false;
+	}
+
+	// Short queries between neighboring clusters gain nothing from the abstract search.
+	if (clusters[begin_cluster_id].neighbors.has(end_cluster_id)) {
+		return false;
+	}
+
+	Heap<NavigationCluster *, NavClusterTravelCostGreaterThan, NavClusterHeapIndexer>
+			&traversable_clusters = path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	LocalVector<NavigationCluster> &navigation_clusters = path_query_slot->path_clusters;
+	for (NavigationCluster &navigation_cluster : navigation_clusters) {
+		navigation_cluster.reset();
+	}
+
+	const Vector3 &end_cluster_position = clusters[end_cluster_id].position;
+
+	navigation_clusters[begin_cluster_id].traveled_distance = 0.0;
+	uint32_t least_cost_id = begin_cluster_id;
+	bool found_route = false;
+
+	// A* over the cluster graph, the polygon search then refines the path inside the found clusters.
+	while (true) {
+		const NavigationCluster &least_cost_cluster = navigation_clusters[least_cost_id];
+		const PolygonCluster &cluster = clusters[least_cost_id];
+
+		for (uint32_t neighbor_id : cluster.neighbors) {
+			const PolygonCluster &neighbor = clusters[neighbor_id];
+			NavigationCluster &neighbor_cluster = navigation_clusters[neighbor_id];
+
+			const real_t new_traveled_distance = least_cost_cluster.traveled_distance + cluster.position.distance_to(neighbor.position) * neighbor.travel_cost;
+			if (new_traveled_distance < neighbor_cluster.traveled_distance) {
+				neighbor_cluster.back_navigation_cluster_id = least_cost_id;
+				neighbor_cluster.traveled_distance = new_traveled_distance;
+				neighbor_cluster.distance_to_destination = neighbor.position.distance_to(end_cluster_position);
+
+				if (neighbor_cluster.traversable_cluster_index != traversable_clusters.INVALID_INDEX) {
+					traversable_clusters.shift(neighbor_cluster.traversable_cluster_index);
+				} else {
+					traversable_clusters.push(&neighbor_cluster);
+				}
+			}
+		}
+
+		if (traversable_clusters.is_empty()) {
+			break;
+		}
+
+		least_cost_id = traversable_clusters.pop() - navigation_clusters.ptr();
+		if (least_cost_id == end_cluster_id) {
+			found_route = true;
+			break;
+		}
+	}
+
+	traversable_clusters.clear();
+
+	if (!found_route) {
+		// Let the flat search handle unreachable targets so it can find the closest reachable polygon.
+		return false;
+	}
+
+	// Allow the polygon search to use the clusters on the route and their direct neighbors.
+	uint32_t corridor_cluster_id = end_cluster_id;
+	while (corridor_cluster_id != UINT32_MAX) {
+		navigation_clusters[corridor_cluster_id].in_corridor = true;
+		for (uint32_t neighbor_id : clusters[corridor_cluster_id].neighbors) {
+			navigation_clusters[neighbor_id].in_corridor = true;
+		}
+		corridor_cluster_id = navigation_clusters[corridor_cluster_id].back_navigation_cluster_id;
+	}
+
+	path_query_slot->use_cluster_corridor = true;
+	return true;
+}
+
 void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
 	const Vector3 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
@@ -364,6 +546,8 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 
 	bool has_path_search_max = p_query_task.path_search_max_polygons > 0 || path_search_max_distance_sqr > 0.0;
 
+	_query_task_build_cluster_corridor(p_query_task, p_map_iteration);
+
 	while (true) {
 		const NavigationPoly &least_cost_poly = navigation_polys[least_cost_id];
 
@@ -401,6 +585,28 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_query_task.path_query_slot->use_cluster_corridor) {
+				// The cluster corridor did not lead to the end polygon with the layers, regions or search limits of this query.
+				// Search again without it so the result matches the flat search.
+				p_query_task.path_query_slot->use_cluster_corridor = false;
+
+				for (NavigationPoly &polygon : navigation_polys) {
+					polygon.reset();
+				}
+				least_cost_id = p_query_task.path_query_slot->poly_to_id[begin_poly];
+				navigation_polys[least_cost_id].poly = begin_poly;
+				navigation_polys[least_cost_id].entry = begin_point;
+				navigation_polys[least_cost_id].back_navigation_edge_pathway_start = begin_point;
+				navigation_polys[least_cost_id].back_navigation_edge_pathway_end = begin_point;
+				navigation_polys[least_cost_id].traveled_distance = 0.f;
+
+				reachable_end = nullptr;
+				distance_to_reachable_end = FLT_MAX;
+				path_search_max_reached = false;
+				processed_polygon_count = 0;
+				continue;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -513,10 +719,14 @@ void NavMeshQueries3D::_query_task_build_path_corridor(NavMeshPathQueryTask3D &p
 }
 
 void NavMeshQueries3D::query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
-	p_query_task.path_clear();
-
 	_query_task_find_start_end_positions(p_query_task, p_map_iteration);
 
+	query_task_map_iteration_build_path(p_query_task, p_map_iteration);
+}
+
+void NavMeshQueries3D::query_task_map_iteration_build_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration) {
+	p_query_task.path_clear();
+
 	// Check for trivial cases.
 	if (!p_query_task.begin_polygon || !p_query_task.end_polygon) {
 		p_query_task.status = NavMeshPathQueryTask3D::TaskStatus::QUERY_FINISHED;
@@ -696,7 +906,10 @@ void NavMeshQueries3D::_query_task_simplified_path_points(NavMeshPathQueryTask3D
 		return;
 	}
 
-	const LocalVector<uint32_t> &simplified_path_indices = NavMeshQueries3D::get_simplified_path_indices(p_query_task.path_points, p_query_task.simplify_epsilon);
+	FrameArena::Scope arena_scope;
+
+	FrameLocalVector<uint32_t> simplified_path_indices;
+	NavMeshQueries3D::get_simplified_path_indices(p_query_task.path_points, p_query_task.simplify_epsilon, simplified_path_indices);
 
 	uint32_t index_count = simplified_path_indices.size();
 
@@ -965,69 +1178,7 @@ ClosestPointQueryResult NavMeshQueries3D::map_iteration_get_closest_point_info(c
 
 	const LocalVector<Ref<NavRegionIteration3D>> &regions = p_map_iteration.region_iterations;
 	for (const Ref<NavRegionIteration3D> &region : regions) {
-		for (const Polygon &polygon : region->get_navmesh_polygons()) {
-			Vector3 plane_normal = (polygon.vertices[1] - polygon.vertices[0]).cross(polygon.vertices[2] - polygon.vertices[0]);
-			Vector3 closest_on_polygon;
-			real_t closest = FLT_MAX;
-			bool inside = true;
-			Vector3 previous = polygon.vertices[polygon.vertices.size() - 1];
-			for (uint32_t point_id = 0; point_id < polygon.vertices.size(); ++point_id) {
-				Vector3 edge = polygon.vertices[point_id] - previous;
-				Vector3 to_point = p_point - previous;
-				Vector3 edge_to_point_pormal = edge.cross(to_point);
-				bool clockwise = edge_to_point_pormal.dot(plane_normal) > 0;
-				// If we are not clockwise, the point will never be inside the polygon and so the closest point will be on an edge.
-				if (!clockwise) {
-					inside = false;
-					real_t point_projected_on_edge = edge.dot(to_point);
-					real_t edge_square = edge.length_squared();
-
-					if (point_projected_on_edge > edge_square) {
-						real_t distance = polygon.vertices[point_id].distance_squared_to(p_point);
-						if (distance < closest) {
-							closest_on_polygon = polygon.vertices[point_id];
-							closest = distance;
-						}
-					} else if (point_projected_on_edge < 0.f) {
-						real_t distance = previous.distance_squared_to(p_point);
-						if (distance < closest) {
-							closest_on_polygon = previous;
-							closest = distance;
-						}
-					} else {
-						// If we project on this edge, this will be the closest point.
-						real_t percent = point_projected_on_edge / edge_square;
-						closest_on_polygon = previous + percent * edge;
-						break;
-					}
-				}
-				previous = polygon.vertices[point_id];
-			}
-
-			if (inside) {
-				Vector3 plane_normalized = plane_normal.normalized();
-				real_t distance = plane_normalized.dot(p_point - polygon.vertices[0]);
-				real_t distance_squared = distance * distance;
-				if (distance_squared < closest_point_distance_squared) {
-					closest_point_distance_squared = distance_squared;
-					result.point = p_point - plane_normalized * distance;
-					result.normal = plane_normal;
-					result.owner = polygon.owner->get_self();
-
-					if (Math::is_zero_approx(distance)) {
-						break;
-					}
-				}
-			} else {
-				real_t distance = closest_on_polygon.distance_squared_to(p_point);
-				if (distance < closest_point_distance_squared) {
-					closest_point_distance_squared = distance;
-					result.point = closest_on_polygon;
-					result.normal = plane_normal;
-					result.owner = polygon.owner->get_self();
-				}
-			}
-		}
+		_region_iteration_get_closest_point_info(**region, p_point, closest_point_distance_squared, result);
 	}
 
 	return result;
@@ -1038,7 +1189,9 @@ Vector3 NavMeshQueries3D::map_iteration_get_random_point(const NavMapIteration3D
 		return Vector3();
 	}
 
-	LocalVector<uint32_t> accessible_regions;
+	FrameArena::Scope arena_scope;
+
+	FrameLocalVector<uint32_t> accessible_regions;
 	accessible_regions.reserve(p_map_iteration.region_iterations.size());
 
 	for (uint32_t i = 0; i < p_map_iteration.region_iterations.size(); i++) {
@@ -1056,7 +1209,7 @@ Vector3 NavMeshQueries3D::map_iteration_get_random_point(const NavMapIteration3D
 
 	if (p_uniformly) {
 		real_t accumulated_region_surface_area = 0;
-		RBMap<real_t, uint32_t> accessible_regions_area_map;
+		RBMap<real_t, uint32_t, Comparator<real_t>, FrameArenaAllocator> accessible_regions_area_map;
 
 		for (uint32_t accessible_region_index = 0; accessible_region_index < accessible_regions.size(); accessible_region_index++) {
 			const Ref<NavRegionIteration3D> &region = p_map_iteration.region_iterations[accessible_regions[accessible_region_index]];
@@ -1077,21 +1230,21 @@ Vector3 NavMeshQueries3D::map_iteration_get_random_point(const NavMapIteration3D
 
 		real_t random_accessible_regions_area_map = Math::random(real_t(0), accumulated_region_surface_area);
 
-		RBMap<real_t, uint32_t>::Iterator E = accessible_regions_area_map.find_closest(random_accessible_regions_area_map);
+		RBMap<real_t, uint32_t, Comparator<real_t>, FrameArenaAllocator>::Iterator E = accessible_regions_area_map.find_closest(random_accessible_regions_area_map);
 		ERR_FAIL_COND_V(!E, Vector3());
 		uint32_t random_region_index = E->value;
 		ERR_FAIL_UNSIGNED_INDEX_V(random_region_index, accessible_regions.size(), Vector3());
 
 		const Ref<NavRegionIteration3D> &random_region = p_map_iteration.region_iterations[accessible_regions[random_region_index]];
 
-		return NavMeshQueries3D::polygons_get_random_point(random_region->navmesh_polygons, p_navigation_layers, p_uniformly);
+		return NavMeshQueries3D::region_iteration_get_random_point(**random_region, p_navigation_layers, p_uniformly);
 
 	} else {
 		uint32_t random_region_index = Math::random(int(0), accessible_regions.size() - 1);
 
 		const Ref<NavRegionIteration3D> &random_region = p_map_iteration.region_iterations[accessible_regions[random_region_index]];
 
-		return NavMeshQueries3D::polygons_get_random_point(random_region->navmesh_polygons, p_navigation_layers, p_uniformly);
+		return NavMeshQueries3D::region_iteration_get_random_point(**random_region, p_navigation_layers, p_uniformly);
 	}
 }
 
@@ -1168,77 +1321,159 @@ Vector3 NavMeshQueries3D::polygons_get_closest_point_normal(const LocalVector<Po
 	return cp.normal;
 }
 
+real_t NavMeshQueries3D::polygon_get_closest_point_info(const Polygon &p_polygon, const Vector3 &p_point, Vector3 &r_closest_point, Vector3 &r_normal) {
+	const LocalVector<Vector3> &vertices = p_polygon.vertices;
+
+	Vector3 plane_normal = (vertices[1] - vertices[0]).cross(vertices[2] - vertices[0]);
+	Vector3 closest_on_polygon;
+	real_t closest = FLT_MAX;
+	bool inside = true;
+	Vector3 previous = vertices[vertices.size() - 1];
+	for (uint32_t point_id = 0; point_id < vertices.size(); ++point_id) {
+		Vector3 edge = vertices[point_id] - previous;
+		Vector3 to_point = p_point - previous;
+		Vector3 edge_to_point_pormal = edge.cross(to_point);
+		bool clockwise = edge_to_point_pormal.dot(plane_normal) > 0;
+		// If we are not clockwise, the point will never be inside the polygon and so the closest point will be on an edge.
+		if (!clockwise) {
+			inside = false;
+			real_t point_projected_on_edge = edge.dot(to_point);
+			real_t edge_square = edge.length_squared();
+
+			if (point_projected_on_edge > edge_square) {
+				real_t distance = vertices[point_id].distance_squared_to(p_point);
+				if (distance < closest) {
+					closest_on_polygon = vertices[point_id];
+					closest = distance;
+				}
+			} else if (point_projected_on_edge < 0.f) {
+				real_t distance = previous.distance_squared_to(p_point);
+				if (distance < closest) {
+					closest_on_polygon = previous;
+					closest = distance;
+				}
+			} else {
+				// If we project on this edge, this will be the closest point.
+				real_t percent = point_projected_on_edge / edge_square;
+				closest_on_polygon = previous + percent * edge;
+				break;
+			}
+		}
+		previous = vertices[point_id];
+	}
+
+	r_normal = plane_normal;
+
+	if (inside) {
+		Vector3 plane_normalized = plane_normal.normalized();
+		real_t distance = plane_normalized.dot(p_point - vertices[0]);
+		r_closest_point = p_point - plane_normalized * distance;
+		return distance * distance;
+	}
+
+	r_closest_point = closest_on_polygon;
+	return closest_on_polygon.distance_squared_to(p_point);
+}
+
+real_t NavMeshQueries3D::polygon_get_closest_face_point(const Polygon &p_polygon, const Vector3 &p_point, Vector3 &r_closest_point) {
+	real_t closest_distance_squared = FLT_MAX;
+
+	// For each face check the distance to the point.
+	for (uint32_t point_id = 2; point_id < p_polygon.vertices.size(); point_id++) {
+		const Face3 face(p_polygon.vertices[0], p_polygon.vertices[point_id - 1], p_polygon.vertices[point_id]);
+
+		const Vector3 point = face.get_closest_point_to(p_point);
+		const real_t distance_squared = point.distance_squared_to(p_point);
+		if (distance_squared < closest_distance_squared) {
+			closest_distance_squared = distance_squared;
+			r_closest_point = point;
+		}
+	}
+
+	return closest_distance_squared;
+}
+
 ClosestPointQueryResult NavMeshQueries3D::polygons_get_closest_point_info(const LocalVector<Polygon> &p_polygons, const Vector3 &p_point) {
 	ClosestPointQueryResult result;
 	real_t closest_point_distance_squared = FLT_MAX;
 
 	for (const Polygon &polygon : p_polygons) {
-		Vector3 plane_normal = (polygon.vertices[1] - polygon.vertices[0]).cross(polygon.vertices[2] - polygon.vertices[0]);
-		Vector3 closest_on_polygon;
-		real_t closest = FLT_MAX;
-		bool inside = true;
-		Vector3 previous = polygon.vertices[polygon.vertices.size() - 1];
-		for (uint32_t point_id = 0; point_id < polygon.vertices.size(); ++point_id) {
-			Vector3 edge = polygon.vertices[point_id] - previous;
-			Vector3 to_point = p_point - previous;
-			Vector3 edge_to_point_pormal = edge.cross(to_point);
-			bool clockwise = edge_to_point_pormal.dot(plane_normal) > 0;
-			// If we are not clockwise, the point will never be inside the polygon and so the closest point will be on an edge.
-			if (!clockwise) {
-				inside = false;
-				real_t point_projected_on_edge = edge.dot(to_point);
-				real_t edge_square = edge.length_squared();
-
-				if (point_projected_on_edge > edge_square) {
-					real_t distance = polygon.vertices[point_id].distance_squared_to(p_point);
-					if (distance < closest) {
-						closest_on_polygon = polygon.vertices[point_id];
-						closest = distance;
-					}
-				} else if (point_projected_on_edge < 0.f) {
-					real_t distance = previous.distance_squared_to(p_point);
-					if (distance < closest) {
-						closest_on_polygon = previous;
-						closest = distance;
-					}
-				} else {
-					// If we project on this edge, this will be the closest point.
-					real_t percent = point_projected_on_edge / edge_square;
-					closest_on_polygon = previous + percent * edge;
-					break;
-				}
-			}
-			previous = polygon.vertices[point_id];
+		if (polygon.vertices.size() < 3) {
+			continue;
 		}
 
-		if (inside) {
-			Vector3 plane_normalized = plane_normal.normalized();
-			real_t distance = plane_normalized.dot(p_point - polygon.vertices[0]);
-			real_t distance_squared = distance * distance;
-			if (distance_squared < closest_point_distance_squared) {
-				closest_point_distance_squared = distance_squared;
-				result.point = p_point - plane_normalized * distance;
-				result.normal = plane_normal;
-				result.owner = polygon.owner->get_self();
-
-				if (Math::is_zero_approx(distance)) {
-					break;
-				}
-			}
-		} else {
-			real_t distance = closest_on_polygon.distance_squared_to(p_point);
-			if (distance < closest_point_distance_squared) {
-				closest_point_distance_squared = distance;
-				result.point = closest_on_polygon;
-				result.normal = plane_normal;
-				result.owner = polygon.owner->get_self();
-			}
+		Vector3 closest_point;
+		Vector3 normal;
+		const real_t distance_squared = polygon_get_closest_point_info(polygon, p_point, closest_point, normal);
+		if (distance_squared < closest_point_distance_squared) {
+			closest_point_distance_squared = distance_squared;
+			result.point = closest_point;
+			result.normal = normal;
+			result.owner = polygon.owner->get_self();
 		}
 	}
 
 	return result;
 }
 
+ClosestPointQueryResult NavMeshQueries3D::region_iteration_get_closest_point_info(const NavRegionIteration3D &p_region_iteration, const Vector3 &p_point) {
+	ClosestPointQueryResult result;
+	real_t closest_point_distance_squared = FLT_MAX;
+
+	_region_iteration_get_closest_point_info(p_region_iteration, p_point, closest_point_distance_squared, result);
+
+	return result;
+}
+
+bool NavMeshQueries3D::_region_iteration_get_closest_point_info(const NavRegionIteration3D &p_region_iteration, const Vector3 &p_point, real_t &r_distance_squared, ClosestPointQueryResult &r_result) {
+	const LocalVector<Polygon> &polygons = p_region_iteration.get_navmesh_polygons();
+
+	Vector3 closest_point;
+	Vector3 normal;
+	const int32_t polygon_index = p_region_iteration.get_polygons_bvh().find_closest(p_point, r_distance_squared, [&](int32_t p_polygon_index) {
+		return polygon_get_closest_point_info(polygons[p_polygon_index], p_point, closest_point, normal);
+	});
+	if (polygon_index < 0) {
+		return false;
+	}
+
+	const Polygon &polygon = polygons[polygon_index];
+	polygon_get_closest_point_info(polygon, p_point, r_result.point, r_result.normal);
+	r_result.owner = polygon.owner->get_self();
+	return true;
+}
+
+Vector3 NavMeshQueries3D::region_iteration_get_random_point(const NavRegionIteration3D &p_region_iteration, uint32_t p_navigation_layers, bool p_uniformly) {
+	const LocalVector<Polygon> &region_polygons = p_region_iteration.get_navmesh_polygons();
+	const LocalVector<real_t> &accumulated_surface_area = p_region_iteration.get_polygons_accumulated_surface_area();
+
+	if (!p_uniformly || region_polygons.is_empty() || accumulated_surface_area.size() != region_polygons.size()) {
+		return polygons_get_random_point(region_polygons, p_navigation_layers, p_uniformly);
+	}
+
+	const real_t surface_area = accumulated_surface_area[accumulated_surface_area.size() - 1];
+	if (surface_area == 0.0) {
+		// All polygons have no real surface / no area.
+		return Vector3();
+	}
+
+	const real_t random_surface_area = Math::random(real_t(0), surface_area);
+
+	// Find the first polygon whose accumulated area is past the random position, polygons without area are never picked.
+	uint32_t low = 0;
+	uint32_t high = accumulated_surface_area.size() - 1;
+	while (low < high) {
+		const uint32_t middle = (low + high) / 2;
+		if (accumulated_surface_area[middle] > random_surface_area) {
+			high = middle;
+		} else {
+			low = middle + 1;
+		}
+	}
+
+	return polygon_get_random_point(region_polygons[low], p_uniformly);
+}
+
 RID NavMeshQueries3D::polygons_get_closest_point_owner(const LocalVector<Polygon> &p_polygons, const Vector3 &p_point) {
 	ClosestPointQueryResult cp = polygons_get_closest_point_info(p_polygons, p_point);
 	return cp.owner;
@@ -1330,20 +1565,26 @@ bool NavMeshQueries3D::_query_task_is_connection_owner_usable(const NavMeshPathQ
 	return owner_usable;
 }
 
-LocalVector<uint32_t> NavMeshQueries3D::get_simplified_path_indices(const LocalVector<Vector3> &p_path, real_t p_epsilon) {
+template <typename IndexVector>
+void NavMeshQueries3D::get_simplified_path_indices(const LocalVector<Vector3> &p_path, real_t p_epsilon, IndexVector &r_simplified_path_indices) {
 	p_epsilon = MAX(0.0, p_epsilon);
 	real_t squared_epsilon = p_epsilon * p_epsilon;
 
-	LocalVector<uint32_t> simplified_path_indices;
-	simplified_path_indices.reserve(p_path.size());
-	simplified_path_indices.push_back(0);
-	simplify_path_segment(0, p_path.size() - 1, p_path, squared_epsilon, simplified_path_indices);
-	simplified_path_indices.push_back(p_path.size() - 1);
+	r_simplified_path_indices.clear();
+	r_simplified_path_indices.reserve(p_path.size());
+	r_simplified_path_indices.push_back(0);
+	simplify_path_segment(0, p_path.size() - 1, p_path, squared_epsilon, r_simplified_path_indices);
+	r_simplified_path_indices.push_back(p_path.size() - 1);
+}
 
+LocalVector<uint32_t> NavMeshQueries3D::get_simplified_path_indices(const LocalVector<Vector3> &p_path, real_t p_epsilon) {
+	LocalVector<uint32_t> simplified_path_indices;
+	get_simplified_path_indices(p_path, p_epsilon, simplified_path_indices);
 	return simplified_path_indices;
 }
 
-void NavMeshQueries3D::simplify_path_segment(int p_start_inx, int p_end_inx, const LocalVector<Vector3> &p_points, real_t p_epsilon, LocalVector<uint32_t> &r_simplified_path_indices) {
+template <typename IndexVector>
+void NavMeshQueries3D::simplify_path_segment(int p_start_inx, int p_end_inx, const LocalVector<Vector3> &p_points, real_t p_epsilon, IndexVector &r_simplified_path_indices) {
 	const Vector3 path_segment_a = p_points[p_start_inx];
 	const Vector3 path_segment_b = p_points[p_end_inx];
 
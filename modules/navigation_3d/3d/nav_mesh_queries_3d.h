@@ -42,6 +42,7 @@
 using namespace NavigationUtilities;
 
 class NavMap3D;
+class NavRegionIteration3D;
 struct NavMapIteration3D;
 
 class NavMeshQueries3D {
@@ -52,6 +53,11 @@ public:
 		bool in_use = false;
 		uint32_t slot_index = 0;
 		AHashMap<const Nav3D::Polygon *, uint32_t> poly_to_id;
+
+		LocalVector<Nav3D::NavigationCluster> path_clusters;
+		Heap<Nav3D::NavigationCluster *, Nav3D::NavClusterTravelCostGreaterThan, Nav3D::NavClusterHeapIndexer> traversable_clusters;
+		LocalVector<uint32_t> poly_to_cluster;
+		bool use_cluster_corridor = false;
 	};
 
 	struct NavMeshPathQueryTask3D {
@@ -107,6 +113,9 @@ public:
 		Callable callback;
 		NavMeshPathQueryTask3D::TaskStatus status = NavMeshPathQueryTask3D::TaskStatus::QUERY_STARTED;
 
+		// Queued processing.
+		uint64_t queued_usec = 0;
+
 		void path_clear() {
 			path_points.clear();
 			path_meta_point_types.clear();
@@ -124,6 +133,10 @@ public:
 
 	static bool emit_callback(const Callable &p_callback);
 
+	static real_t polygon_get_closest_point_info(const Nav3D::Polygon &p_polygon, const Vector3 &p_point, Vector3 &r_closest_point, Vector3 &r_normal);
+	static real_t polygon_get_closest_face_point(const Nav3D::Polygon &p_polygon, const Vector3 &p_point, Vector3 &r_closest_point);
+	static Vector3 polygon_get_random_point(const Nav3D::Polygon &p_polygon, bool p_uniformly);
+
 	static Vector3 polygons_get_random_point(const LocalVector<Nav3D::Polygon> &p_polygons, uint32_t p_navigation_layers, bool p_uniformly);
 
 	static Vector3 polygons_get_closest_point_to_segment(const LocalVector<Nav3D::Polygon> &p_polygons, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision);
@@ -132,6 +145,10 @@ public:
 	static Nav3D::ClosestPointQueryResult polygons_get_closest_point_info(const LocalVector<Nav3D::Polygon> &p_polygons, const Vector3 &p_point);
 	static RID polygons_get_closest_point_owner(const LocalVector<Nav3D::Polygon> &p_polygons, const Vector3 &p_point);
 
+	static Nav3D::ClosestPointQueryResult region_iteration_get_closest_point_info(const NavRegionIteration3D &p_region_iteration, const Vector3 &p_point);
+	static bool _region_iteration_get_closest_point_info(const NavRegionIteration3D &p_region_iteration, const Vector3 &p_point, real_t &r_distance_squared, Nav3D::ClosestPointQueryResult &r_result);
+	static Vector3 region_iteration_get_random_point(const NavRegionIteration3D &p_region_iteration, uint32_t p_navigation_layers, bool p_uniformly);
+
 	static Vector3 map_iteration_get_closest_point_to_segment(const NavMapIteration3D &p_map_iteration, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision);
 	static Vector3 map_iteration_get_closest_point(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Vector3 map_iteration_get_closest_point_normal(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
@@ -140,10 +157,17 @@ public:
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
 
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
+	static void map_queue_path_query(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
 
+	static void query_task_set_parameters(NavMeshPathQueryTask3D &p_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters);
+	static void query_task_dispatch_result(NavMeshPathQueryTask3D &p_query_task);
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static void query_task_map_iteration_build_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool query_task_has_same_request(const NavMeshPathQueryTask3D &p_query_task_a, const NavMeshPathQueryTask3D &p_query_task_b);
+	static uint32_t query_task_hash_request(const NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool _query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
@@ -155,7 +179,10 @@ public:
 
 	static void _query_task_search_polygon_connections(NavMeshPathQueryTask3D &p_query_task, const Nav3D::Connection &p_connection, uint32_t p_least_cost_id, const Nav3D::NavigationPoly &p_least_cost_poly, real_t p_poly_enter_cost, const Vector3 &p_end_point);
 
-	static void simplify_path_segment(int p_start_inx, int p_end_inx, const LocalVector<Vector3> &p_points, real_t p_epsilon, LocalVector<uint32_t> &r_simplified_path_indices);
+	template <typename IndexVector>
+	static void simplify_path_segment(int p_start_inx, int p_end_inx, const LocalVector<Vector3> &p_points, real_t p_epsilon, IndexVector &r_simplified_path_indices);
+	template <typename IndexVector>
+	static void get_simplified_path_indices(const LocalVector<Vector3> &p_path, real_t p_epsilon, IndexVector &r_simplified_path_indices);
 	static LocalVector<uint32_t> get_simplified_path_indices(const LocalVector<Vector3> &p_path, real_t p_epsilon);
 
 	static float _calculate_path_length(const LocalVector<Vector3> &p_path, uint32_t p_start_index, uint32_t p_end_index);
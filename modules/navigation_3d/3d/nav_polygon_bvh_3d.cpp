@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*  nav_polygon_bvh_3d.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "nav_polygon_bvh_3d.h"
+
+#include "core/templates/sort_array.h"
+
+using namespace Nav3D;
+
+int NavPolygonBVH3D::_create_bvh(BVH *p_bvh, BVH **p_bb, int p_from, int p_size, int p_depth, int &r_max_depth, int &r_max_alloc) {
+	if (p_depth > r_max_depth) {
+		r_max_depth = p_depth;
+	}
+
+	if (p_size == 1) {
+		return p_bb[p_from] - p_bvh;
+	} else if (p_size == 0) {
+		return -1;
+	}
+
+	AABB aabb;
+	aabb = p_bb[p_from]->aabb;
+	for (int i = 1; i < p_size; i++) {
+		aabb.merge_with(p_bb[p_from + i]->aabb);
+	}
+
+	// Split by the longest axis of the polygon centers, the polygon bounds of a navigation mesh overlap too much on the up axis.
+	AABB center_aabb(p_bb[p_from]->center, Vector3());
+	for (int i = 1; i < p_size; i++) {
+		center_aabb.expand_to(p_bb[p_from + i]->center);
+	}
+
+	switch (center_aabb.get_longest_axis_index()) {
+		case Vector3::AXIS_X: {
+			SortArray<BVH *, BVHCmpX> sort_x;
+			sort_x.nth_element(0, p_size, p_size / 2, &p_bb[p_from]);
+		} break;
+		case Vector3::AXIS_Y: {
+			SortArray<BVH *, BVHCmpY> sort_y;
+			sort_y.nth_element(0, p_size, p_size / 2, &p_bb[p_from]);
+		} break;
+		case Vector3::AXIS_Z: {
+			SortArray<BVH *, BVHCmpZ> sort_z;
+			sort_z.nth_element(0, p_size, p_size / 2, &p_bb[p_from]);
+		} break;
+	}
+
+	int left = _create_bvh(p_bvh, p_bb, p_from, p_size / 2, p_depth + 1, r_max_depth, r_max_alloc);
+	int right = _create_bvh(p_bvh, p_bb, p_from + p_size / 2, p_size - p_size / 2, p_depth + 1, r_max_depth, r_max_alloc);
+
+	int index = r_max_alloc++;
+	BVH *_new = &p_bvh[index];
+	_new->aabb = aabb;
+	_new->center = aabb.get_center();
+	_new->polygon_index = -1;
+	_new->left = left;
+	_new->right = right;
+
+	return index;
+}
+
+void NavPolygonBVH3D::create(const LocalVector<Polygon> &p_polygons) {
+	clear();
+
+	int polygon_count = 0;
+	for (const Polygon &polygon : p_polygons) {
+		if (polygon.vertices.size() >= 3) {
+			polygon_count++;
+		}
+	}
+
+	if (polygon_count == 0) {
+		return;
+	}
+
+	bvh.resize(polygon_count * 2 - 1);
+	LocalVector<BVH *> bb;
+	bb.resize(polygon_count);
+
+	int leaf_index = 0;
+	for (uint32_t polygon_index = 0; polygon_index < p_polygons.size(); polygon_index++) {
+		const Polygon &polygon = p_polygons[polygon_index];
+		if (polygon.vertices.size() < 3) {
+			continue;
+		}
+
+		BVH &leaf = bvh[leaf_index];
+		leaf.aabb = AABB(polygon.vertices[0], Vector3());
+		for (uint32_t vertex_index = 1; vertex_index < polygon.vertices.size(); vertex_index++) {
+			leaf.aabb.expand_to(polygon.vertices[vertex_index]);
+		}
+		leaf.center = leaf.aabb.get_center();
+		leaf.left = -1;
+		leaf.right = -1;
+		leaf.polygon_index = polygon_index;
+
+		bb[leaf_index] = &leaf;
+		leaf_index++;
+	}
+
+	int max_alloc = polygon_count;
+	max_depth = 0;
+	root = _create_bvh(bvh.ptr(), bb.ptr(), 0, polygon_count, 1, max_depth, max_alloc);
+}
+
+void NavPolygonBVH3D::clear() {
+	bvh.clear();
+	root = -1;
+	max_depth = 0;
+}
@@ -0,0 +1,131 @@
+/**************************************************************************/
+/*  nav_polygon_bvh_3d.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../nav_utils_3d.h"
+
+#include "core/math/aabb.h"
+#include "core/templates/local_vector.h"
+
+// Static bounding volume hierarchy over the polygons of a navigation mesh.
+// Built once per iteration and used to find the closest polygon to a point
+// without visiting every polygon.
+class NavPolygonBVH3D {
+	struct BVH {
+		AABB aabb;
+		Vector3 center; // Used for sorting.
+		int left = -1;
+		int right = -1;
+
+		int32_t polygon_index = -1;
+	};
+
+	struct BVHCmpX {
+		bool operator()(const BVH *p_left, const BVH *p_right) const {
+			return p_left->center.x < p_right->center.x;
+		}
+	};
+
+	struct BVHCmpY {
+		bool operator()(const BVH *p_left, const BVH *p_right) const {
+			return p_left->center.y < p_right->center.y;
+		}
+	};
+
+	struct BVHCmpZ {
+		bool operator()(const BVH *p_left, const BVH *p_right) const {
+			return p_left->center.z < p_right->center.z;
+		}
+	};
+
+	int _create_bvh(BVH *p_bvh, BVH **p_bb, int p_from, int p_size, int p_depth, int &r_max_depth, int &r_max_alloc);
+
+	_FORCE_INLINE_ static real_t _get_aabb_distance_squared(const AABB &p_aabb, const Vector3 &p_point) {
+		const Vector3 outside = (p_aabb.position - p_point).max(p_point - (p_aabb.position + p_aabb.size)).maxf(0.0);
+		return outside.length_squared();
+	}
+
+	LocalVector<BVH> bvh;
+	int root = -1;
+	int max_depth = 0;
+
+public:
+	void create(const LocalVector<Nav3D::Polygon> &p_polygons);
+	void clear();
+
+	bool is_empty() const { return root < 0; }
+
+	// Returns the index of the polygon with the smallest distance reported by `p_polygon_distance_squared`, or -1.
+	// `p_polygon_distance_squared(polygon_index)` must never return less than the squared distance from the point
+	// to the polygon bounds. Only polygons closer than `r_distance_squared` are accepted, which is updated on success.
+	// Ties resolve to the lowest polygon index, same as a linear scan with a strict comparison.
+	template <typename F>
+	int32_t find_closest(const Vector3 &p_point, real_t &r_distance_squared, const F &p_polygon_distance_squared) const {
+		if (root < 0) {
+			return -1;
+		}
+
+		int32_t closest_polygon_index = -1;
+
+		int *stack = (int *)alloca(sizeof(int) * (max_depth + 1));
+		int stack_size = 0;
+		stack[stack_size++] = root;
+
+		while (stack_size > 0) {
+			const BVH &node = bvh[stack[--stack_size]];
+			if (_get_aabb_distance_squared(node.aabb, p_point) > r_distance_squared) {
+				continue;
+			}
+
+			if (node.polygon_index >= 0) {
+				const real_t distance_squared = p_polygon_distance_squared(node.polygon_index);
+				if (distance_squared < r_distance_squared || (distance_squared == r_distance_squared && node.polygon_index < closest_polygon_index)) {
+					r_distance_squared = distance_squared;
+					closest_polygon_index = node.polygon_index;
+				}
+				continue;
+			}
+
+			// Visit the nearer child first so the search bound shrinks quickly.
+			const real_t left_distance_squared = _get_aabb_distance_squared(bvh[node.left].aabb, p_point);
+			const real_t right_distance_squared = _get_aabb_distance_squared(bvh[node.right].aabb, p_point);
+			if (left_distance_squared < right_distance_squared) {
+				stack[stack_size++] = node.right;
+				stack[stack_size++] = node.left;
+			} else {
+				stack[stack_size++] = node.left;
+				stack[stack_size++] = node.right;
+			}
+		}
+
+		return closest_polygon_index;
+	}
+};
@@ -47,6 +47,8 @@ void NavRegionBuilder3D::build_iteration(NavRegionIterationBuild3D &r_build) {
 
 	_build_step_process_navmesh_data(r_build);
 
+	_build_step_index_polygons(r_build);
+
 	_build_step_find_edge_connection_pairs(r_build);
 
 	_build_step_merge_edge_connection_pairs(r_build);
@@ -146,6 +148,22 @@ void NavRegionBuilder3D::_build_step_process_navmesh_data(NavRegionIterationBuil
 	performance_data.pm_polygon_count = navmesh_polygons.size();
 }
 
+void NavRegionBuilder3D::_build_step_index_polygons(NavRegionIterationBuild3D &r_build) {
+	Ref<NavRegionIteration3D> region_iteration = r_build.region_iteration;
+	const LocalVector<Nav3D::Polygon> &navmesh_polygons = region_iteration->navmesh_polygons;
+
+	region_iteration->polygons_bvh.create(navmesh_polygons);
+
+	LocalVector<real_t> &accumulated_surface_area = region_iteration->polygons_accumulated_surface_area;
+	accumulated_surface_area.resize(navmesh_polygons.size());
+
+	real_t surface_area = 0.0;
+	for (uint32_t i = 0; i < navmesh_polygons.size(); i++) {
+		surface_area += navmesh_polygons[i].surface_area;
+		accumulated_surface_area[i] = surface_area;
+	}
+}
+
 Nav3D::PointKey NavRegionBuilder3D::get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size) {
 	const int x = static_cast<int>(Math::floor(p_pos.x / p_cell_size.x));
 	const int y = static_cast<int>(Math::floor(p_pos.y / p_cell_size.y));
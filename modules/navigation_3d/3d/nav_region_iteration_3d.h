@@ -32,6 +32,7 @@
 
 #include "../nav_utils_3d.h"
 #include "nav_base_iteration_3d.h"
+#include "nav_polygon_bvh_3d.h"
 #include "scene/resources/navigation_mesh.h"
 
 #include "core/math/aabb.h"
@@ -79,13 +80,22 @@ public:
 	AABB bounds;
 	LocalVector<Nav3D::ConnectableEdge> external_edges;
 
+	// Spatial index over the navmesh polygons for closest point queries.
+	NavPolygonBVH3D polygons_bvh;
+	// Running sum of the polygon surface areas, used to pick uniformly distributed random points.
+	LocalVector<real_t> polygons_accumulated_surface_area;
+
 	const Transform3D &get_transform() const { return transform; }
 	real_t get_surface_area() const { return surface_area; }
 	AABB get_bounds() const { return bounds; }
 	const LocalVector<Nav3D::ConnectableEdge> &get_external_edges() const { return external_edges; }
+	const NavPolygonBVH3D &get_polygons_bvh() const { return polygons_bvh; }
+	const LocalVector<real_t> &get_polygons_accumulated_surface_area() const { return polygons_accumulated_surface_area; }
 
 	virtual ~NavRegionIteration3D() override {
 		external_edges.clear();
+		polygons_bvh.clear();
+		polygons_accumulated_surface_area.clear();
 		navmesh_polygons.clear();
 		internal_connections.clear();
 	}
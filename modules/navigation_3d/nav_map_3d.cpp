@@ -126,6 +126,23 @@ void NavMap3D::set_link_connection_radius(real_t p_link_connection_radius) {
 	iteration_dirty = true;
 }
 
+void NavMap3D::set_use_hierarchical_pathfinding(bool p_enabled) {
+	if (use_hierarchical_pathfinding == p_enabled) {
+		return;
+	}
+	use_hierarchical_pathfinding = p_enabled;
+	iteration_dirty = true;
+}
+
+void NavMap3D::set_hierarchical_cluster_size(real_t p_cluster_size) {
+	ERR_FAIL_COND_MSG(p_cluster_size <= 0.0, "Hierarchical pathfinding cluster size must be positive.");
+	if (hierarchical_cluster_size == p_cluster_size) {
+		return;
+	}
+	hierarchical_cluster_size = p_cluster_size;
+	iteration_dirty = true;
+}
+
 const Vector3 &NavMap3D::get_merge_rasterizer_cell_size() const {
 	return merge_rasterizer_cell_size;
 }
@@ -143,41 +160,198 @@ PointKey NavMap3D::get_point_key(const Vector3 &p_pos) const {
 	return p;
 }
 
-void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
-	if (iteration_id == 0) {
-		return;
-	}
-
-	GET_MAP_ITERATION();
+NavMeshQueries3D::PathQuerySlot *NavMap3D::_acquire_path_query_slot(NavMapIteration3D &p_map_iteration) {
+	p_map_iteration.path_query_slots_semaphore.wait();
 
-	map_iteration.path_query_slots_semaphore.wait();
+	NavMeshQueries3D::PathQuerySlot *path_query_slot = nullptr;
 
-	map_iteration.path_query_slots_mutex.lock();
-	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : map_iteration.path_query_slots) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	for (NavMeshQueries3D::PathQuerySlot &p_path_query_slot : p_map_iteration.path_query_slots) {
 		if (!p_path_query_slot.in_use) {
 			p_path_query_slot.in_use = true;
-			p_query_task.path_query_slot = &p_path_query_slot;
+			path_query_slot = &p_path_query_slot;
 			break;
 		}
 	}
-	map_iteration.path_query_slots_mutex.unlock();
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	if (path_query_slot == nullptr) {
+		p_map_iteration.path_query_slots_semaphore.post();
+		ERR_FAIL_NULL_V_MSG(path_query_slot, nullptr, "No unused NavMap3D path query slot found! This should never happen :(.");
+	}
 
+	return path_query_slot;
+}
+
+void NavMap3D::_release_path_query_slot(NavMapIteration3D &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot) {
+	p_map_iteration.path_query_slots_mutex.lock();
+	p_map_iteration.path_query_slots[p_path_query_slot->slot_index].in_use = false;
+	p_map_iteration.path_query_slots_mutex.unlock();
+
+	p_map_iteration.path_query_slots_semaphore.post();
+}
+
+void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task) {
+	if (iteration_id == 0) {
+		return;
+	}
+
+	GET_MAP_ITERATION();
+
+	p_query_task.path_query_slot = _acquire_path_query_slot(map_iteration);
 	if (p_query_task.path_query_slot == nullptr) {
-		map_iteration.path_query_slots_semaphore.post();
-		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap3D path query slot found! This should never happen :(.");
+		return;
 	}
 
 	p_query_task.map_up = map_iteration.map_up;
 
 	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
 
-	map_iteration.path_query_slots_mutex.lock();
-	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
-	map_iteration.path_query_slots[used_slot_index].in_use = false;
+	_release_path_query_slot(map_iteration, p_query_task.path_query_slot);
 	p_query_task.path_query_slot = nullptr;
-	map_iteration.path_query_slots_mutex.unlock();
+}
+
+void NavMap3D::queue_path_query(NavMeshQueries3D::NavMeshPathQueryTask3D *p_query_task) {
+	ERR_FAIL_NULL(p_query_task);
+
+	p_query_task->queued_usec = OS::get_singleton()->get_ticks_usec();
+
+	MutexLock lock(path_query_queue_mutex);
+	path_query_queue.push_back(p_query_task);
+}
+
+uint32_t NavMap3D::get_path_query_queue_size() const {
+	MutexLock lock(path_query_queue_mutex);
+	return path_query_queue.size();
+}
+
+void NavMap3D::set_path_query_queue_budget(int p_budget) {
+	ERR_FAIL_COND_MSG(p_budget < 0, "Path query queue budget must be 0 or greater.");
+	path_query_queue_budget = p_budget;
+}
+
+void NavMap3D::_resolve_queued_path_query_positions(uint32_t p_index, NavMeshQueries3D::NavMeshPathQueryTask3D **p_query_tasks) {
+	NavMeshQueries3D::NavMeshPathQueryTask3D *query_task = p_query_tasks[p_index];
+	query_task->map_up = path_query_batch_iteration->map_up;
+	NavMeshQueries3D::_query_task_find_start_end_positions(*query_task, *path_query_batch_iteration);
+}
+
+void NavMap3D::_build_queued_path_query(uint32_t p_index, NavMeshQueries3D::NavMeshPathQueryTask3D **p_query_tasks) {
+	NavMeshQueries3D::NavMeshPathQueryTask3D *query_task = p_query_tasks[p_index];
+
+	query_task->path_query_slot = _acquire_path_query_slot(*path_query_batch_iteration);
+	if (query_task->path_query_slot == nullptr) {
+		query_task->status = NavMeshQueries3D::NavMeshPathQueryTask3D::TaskStatus::QUERY_FAILED;
+		return;
+	}
+
+	NavMeshQueries3D::query_task_map_iteration_build_path(*query_task, *path_query_batch_iteration);
 
-	map_iteration.path_query_slots_semaphore.post();
+	_release_path_query_slot(*path_query_batch_iteration, query_task->path_query_slot);
+	query_task->path_query_slot = nullptr;
+}
+
+void NavMap3D::process_path_queries() {
+	// Results of the previous batch must be dispatched before a new one is taken out of the queue.
+	ERR_FAIL_COND(!path_query_batch.is_empty());
+
+	path_query_queue_mutex.lock();
+	uint32_t batch_size = path_query_queue.size();
+	if (path_query_queue_budget > 0 && batch_size > (uint32_t)path_query_queue_budget) {
+		batch_size = path_query_queue_budget;
+	}
+	if (batch_size > 0) {
+		// The queue is first in first out so queries can not starve when the budget is exceeded every step.
+		path_query_batch.resize(batch_size);
+		for (uint32_t i = 0; i < batch_size; i++) {
+			path_query_batch[i] = path_query_queue[i];
+		}
+		uint32_t remaining_size = path_query_queue.size() - batch_size;
+		for (uint32_t i = 0; i < remaining_size; i++) {
+			path_query_queue[i] = path_query_queue[batch_size + i];
+		}
+		path_query_queue.resize(remaining_size);
+	}
+	performance_data.pm_path_query_queue_size = path_query_queue.size();
+	path_query_queue_mutex.unlock();
+
+	if (batch_size == 0 || iteration_id == 0) {
+		// Without any map iteration there is nothing to path on, the queries are dispatched with empty results.
+		return;
+	}
+
+	GET_MAP_ITERATION();
+	path_query_batch_iteration = &map_iteration;
+
+	const bool use_multiple_threads = use_threads && batch_size > 1;
+
+	if (use_multiple_threads) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_resolve_queued_path_query_positions, path_query_batch.ptr(), batch_size, -1, true, SNAME("NavMapPathQueries3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < batch_size; i++) {
+			_resolve_queued_path_query_positions(i, path_query_batch.ptr());
+		}
+	}
+
+	// Queries that snapped to the same positions with the same parameters share a single path search.
+	struct RequestKey {
+		const NavMeshQueries3D::NavMeshPathQueryTask3D *query_task = nullptr;
+
+		static uint32_t hash(const RequestKey &p_key) {
+			return NavMeshQueries3D::query_task_hash_request(*p_key.query_task);
+		}
+		bool operator==(const RequestKey &p_key) const {
+			return NavMeshQueries3D::query_task_has_same_request(*query_task, *p_key.query_task);
+		}
+	};
+
+	HashMap<RequestKey, uint32_t, RequestKey> request_to_source;
+	request_to_source.reserve(batch_size);
+	path_query_batch_sources.resize(batch_size);
+	path_query_batch_unique.clear();
+
+	for (uint32_t i = 0; i < batch_size; i++) {
+		RequestKey key;
+		key.query_task = path_query_batch[i];
+
+		HashMap<RequestKey, uint32_t, RequestKey>::Iterator found = request_to_source.find(key);
+		if (found) {
+			path_query_batch_sources[i] = found->value;
+		} else {
+			request_to_source.insert(key, i);
+			path_query_batch_sources[i] = i;
+			path_query_batch_unique.push_back(path_query_batch[i]);
+		}
+	}
+
+	const uint32_t unique_count = path_query_batch_unique.size();
+
+	if (use_multiple_threads && unique_count > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_build_queued_path_query, path_query_batch_unique.ptr(), unique_count, -1, true, SNAME("NavMapPathQueries3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < unique_count; i++) {
+			_build_queued_path_query(i, path_query_batch_unique.ptr());
+		}
+	}
+
+	for (uint32_t i = 0; i < batch_size; i++) {
+		if (path_query_batch_sources[i] == i) {
+			continue;
+		}
+		const NavMeshQueries3D::NavMeshPathQueryTask3D *source_task = path_query_batch[path_query_batch_sources[i]];
+		NavMeshQueries3D::NavMeshPathQueryTask3D *query_task = path_query_batch[i];
+		query_task->path_points = source_task->path_points;
+		query_task->path_meta_point_types = source_task->path_meta_point_types;
+		query_task->path_meta_point_rids = source_task->path_meta_point_rids;
+		query_task->path_meta_point_owners = source_task->path_meta_point_owners;
+		query_task->path_length = source_task->path_length;
+		query_task->status = source_task->status;
+	}
+
+	path_query_batch_unique.clear();
+	path_query_batch_iteration = nullptr;
 }
 
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
@@ -368,6 +542,8 @@ void NavMap3D::_build_iteration() {
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
+	iteration_build.use_hierarchical_pathfinding = get_use_hierarchical_pathfinding();
+	iteration_build.hierarchical_cluster_size = get_hierarchical_cluster_size();
 
 	next_map_iteration.clear();
 
@@ -647,6 +823,23 @@ void NavMap3D::dispatch_callbacks() {
 	for (NavAgent3D *agent : active_3d_avoidance_agents) {
 		agent->dispatch_avoidance_callback();
 	}
+
+	if (path_query_batch.is_empty()) {
+		performance_data.pm_path_query_latency_usec = 0;
+		return;
+	}
+
+	const uint64_t dispatch_usec = OS::get_singleton()->get_ticks_usec();
+	uint64_t max_latency_usec = 0;
+
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : path_query_batch) {
+		max_latency_usec = MAX(max_latency_usec, dispatch_usec - query_task->queued_usec);
+		NavMeshQueries3D::query_task_dispatch_result(*query_task);
+		memdelete(query_task);
+	}
+	path_query_batch.clear();
+
+	performance_data.pm_path_query_latency_usec = (int)MIN(max_latency_usec, (uint64_t)INT32_MAX);
 }
 
 void NavMap3D::_update_merge_rasterizer_cell_dimensions() {
@@ -857,6 +1050,7 @@ NavMap3D::NavMap3D() {
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
 
 	path_query_slots_max = GLOBAL_GET("navigation/pathfinding/max_threads");
+	path_query_queue_budget = MAX(0, int(GLOBAL_GET("navigation/3d/path_query_queue_budget")));
 
 	int processor_count = OS::get_singleton()->get_processor_count();
 	if (path_query_slots_max < 0) {
@@ -892,6 +1086,19 @@ NavMap3D::~NavMap3D() {
 		iteration_build_thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
 	}
 
+	// Queries still pending when the map is freed are dropped without calling their callbacks.
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : path_query_batch) {
+		memdelete(query_task);
+	}
+	path_query_batch.clear();
+
+	path_query_queue_mutex.lock();
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : path_query_queue) {
+		memdelete(query_task);
+	}
+	path_query_queue.clear();
+	path_query_queue_mutex.unlock();
+
 	RWLockWrite write_lock(iteration_slot_rwlock);
 	for (NavMapIteration3D &iteration_slot : iteration_slots) {
 		iteration_slot.clear();
@@ -71,6 +71,10 @@ class NavMap3D : public NavRid3D {
 	/// This value is used to limit how far links search to find polygons to connect to.
 	real_t link_connection_radius = NavigationDefaults3D::LINK_CONNECTION_RADIUS;
 
+	/// Long path queries first search a graph of polygon clusters with this size before refining on polygons.
+	bool use_hierarchical_pathfinding = false;
+	real_t hierarchical_cluster_size = NavigationDefaults3D::HIERARCHICAL_CLUSTER_SIZE;
+
 	bool map_settings_dirty = true;
 
 	/// Map regions
@@ -137,6 +141,15 @@ class NavMap3D : public NavRid3D {
 
 	int path_query_slots_max = 4;
 
+	/// Path queries waiting for a physics step, and the batch taken out of it for the current step.
+	int path_query_queue_budget = NavigationDefaults3D::PATH_QUERY_QUEUE_BUDGET;
+	mutable Mutex path_query_queue_mutex;
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> path_query_queue;
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> path_query_batch;
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> path_query_batch_unique;
+	LocalVector<uint32_t> path_query_batch_sources;
+	NavMapIteration3D *path_query_batch_iteration = nullptr;
+
 	bool use_async_iterations = true;
 
 	uint32_t iteration_slot_index = 0;
@@ -193,10 +206,27 @@ public:
 		return link_connection_radius;
 	}
 
+	void set_use_hierarchical_pathfinding(bool p_enabled);
+	bool get_use_hierarchical_pathfinding() const {
+		return use_hierarchical_pathfinding;
+	}
+
+	void set_hierarchical_cluster_size(real_t p_cluster_size);
+	real_t get_hierarchical_cluster_size() const {
+		return hierarchical_cluster_size;
+	}
+
 	Nav3D::PointKey get_point_key(const Vector3 &p_pos) const;
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	void queue_path_query(NavMeshQueries3D::NavMeshPathQueryTask3D *p_query_task);
+	uint32_t get_path_query_queue_size() const;
+
+	void set_path_query_queue_budget(int p_budget);
+	int get_path_query_queue_budget() const {
+		return path_query_queue_budget;
+	}
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
@@ -237,6 +267,7 @@ public:
 
 	void sync();
 	void step(double p_delta_time);
+	void process_path_queries();
 	void dispatch_callbacks();
 
 	// Performance Monitor
@@ -249,6 +280,8 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	int get_pm_path_query_queue_size() const { return performance_data.pm_path_query_queue_size; }
+	int get_pm_path_query_latency_usec() const { return performance_data.pm_path_query_latency_usec; }
 
 	int get_region_connections_count(NavRegion3D *p_region) const;
 	Vector3 get_region_connection_pathway_start(NavRegion3D *p_region, int p_connection_id) const;
@@ -280,6 +313,11 @@ private:
 	void compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent);
 	void compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent);
 
+	NavMeshQueries3D::PathQuerySlot *_acquire_path_query_slot(NavMapIteration3D &p_map_iteration);
+	void _release_path_query_slot(NavMapIteration3D &p_map_iteration, NavMeshQueries3D::PathQuerySlot *p_path_query_slot);
+	void _resolve_queued_path_query_positions(uint32_t p_index, NavMeshQueries3D::NavMeshPathQueryTask3D **p_query_tasks);
+	void _build_queued_path_query(uint32_t p_index, NavMeshQueries3D::NavMeshPathQueryTask3D **p_query_tasks);
+
 	void _sync_avoidance();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
@@ -170,6 +170,66 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct PolygonCluster {
+	/// Area weighted center of the polygons in this cluster.
+	Vector3 position;
+
+	/// Area weighted travel cost of the polygons in this cluster.
+	real_t travel_cost = 0.0;
+
+	/// Clusters that can be entered directly from a polygon of this cluster.
+	LocalVector<uint32_t> neighbors;
+};
+
+struct NavigationCluster {
+	/// Index in the heap of traversable clusters.
+	uint32_t traversable_cluster_index = UINT32_MAX;
+
+	/// Used to travel the cluster path backwards.
+	uint32_t back_navigation_cluster_id = UINT32_MAX;
+
+	/// The distance traveled until now (g cost).
+	real_t traveled_distance = FLT_MAX;
+	/// The distance to the destination (h cost).
+	real_t distance_to_destination = 0.0;
+
+	/// True if the polygon search is allowed to enter this cluster.
+	bool in_corridor = false;
+
+	/// The total travel cost (f cost).
+	real_t total_travel_cost() const {
+		return traveled_distance + distance_to_destination;
+	}
+
+	void reset() {
+		traversable_cluster_index = UINT32_MAX;
+		back_navigation_cluster_id = UINT32_MAX;
+		traveled_distance = FLT_MAX;
+		distance_to_destination = 0.0;
+		in_corridor = false;
+	}
+};
+
+struct NavClusterTravelCostGreaterThan {
+	// Returns `true` if the travel cost of `a` is higher than that of `b`.
+	bool operator()(const NavigationCluster *p_cluster_a, const NavigationCluster *p_cluster_b) const {
+		real_t f_cost_a = p_cluster_a->total_travel_cost();
+		real_t f_cost_b = p_cluster_b->total_travel_cost();
+
+		if (f_cost_a != f_cost_b) {
+			return f_cost_a > f_cost_b;
+		} else {
+			return p_cluster_a->distance_to_destination > p_cluster_b->distance_to_destination;
+		}
+	}
+};
+
+struct NavClusterHeapIndexer {
+	void operator()(NavigationCluster *p_cluster, uint32_t p_heap_index) const {
+		p_cluster->traversable_cluster_index = p_heap_index;
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector3 point;
 	Vector3 normal;
@@ -191,6 +251,8 @@ struct PerformanceData {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	int pm_path_query_queue_size = 0;
+	int pm_path_query_latency_usec = 0;
 
 	void reset() {
 		pm_region_count = 0;
@@ -202,6 +264,8 @@ struct PerformanceData {
 		pm_edge_connection_count = 0;
 		pm_edge_free_count = 0;
 		pm_obstacle_count = 0;
+		pm_path_query_queue_size = 0;
+		pm_path_query_latency_usec = 0;
 	}
 };
 
@@ -0,0 +1,155 @@
+/**************************************************************************/
+/*  test_nav_mesh_queries_3d.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../3d/nav_mesh_queries_3d.h"
+#include "../3d/nav_region_iteration_3d.h"
+
+#include "core/math/random_pcg.h"
+#include "tests/test_macros.h"
+
+namespace TestNavMeshQueries3D {
+
+// Builds a bumpy grid of triangles so polygon bounds overlap on the up axis like on real navigation meshes.
+static Ref<NavRegionIteration3D> create_grid_region_iteration(int p_size, real_t p_cell_size) {
+	Ref<NavRegionIteration3D> region_iteration;
+	region_iteration.instantiate();
+
+	RandomPCG rng(7);
+	LocalVector<Vector3> grid_vertices;
+	grid_vertices.resize((p_size + 1) * (p_size + 1));
+	for (int z = 0; z <= p_size; z++) {
+		for (int x = 0; x <= p_size; x++) {
+			grid_vertices[z * (p_size + 1) + x] = Vector3(x * p_cell_size, rng.random(-0.5f, 0.5f), z * p_cell_size);
+		}
+	}
+
+	LocalVector<Nav3D::Polygon> &polygons = region_iteration->navmesh_polygons;
+	polygons.resize(p_size * p_size * 2);
+	for (int z = 0; z < p_size; z++) {
+		for (int x = 0; x < p_size; x++) {
+			const Vector3 &a = grid_vertices[z * (p_size + 1) + x];
+			const Vector3 &b = grid_vertices[z * (p_size + 1) + x + 1];
+			const Vector3 &c = grid_vertices[(z + 1) * (p_size + 1) + x + 1];
+			const Vector3 &d = grid_vertices[(z + 1) * (p_size + 1) + x];
+			const Vector3 triangles[2][3] = { { a, b, c }, { a, c, d } };
+
+			for (int i = 0; i < 2; i++) {
+				const uint32_t polygon_id = (z * p_size + x) * 2 + i;
+				Nav3D::Polygon &polygon = polygons[polygon_id];
+				polygon.id = polygon_id;
+				polygon.owner = region_iteration.ptr();
+				polygon.vertices.resize(3);
+				polygon.vertices[0] = triangles[i][0];
+				polygon.vertices[1] = triangles[i][1];
+				polygon.vertices[2] = triangles[i][2];
+				polygon.surface_area = Face3(triangles[i][0], triangles[i][1], triangles[i][2]).get_area();
+			}
+		}
+	}
+
+	region_iteration->polygons_bvh.create(polygons);
+	region_iteration->polygons_accumulated_surface_area.resize(polygons.size());
+	real_t surface_area = 0.0;
+	for (uint32_t i = 0; i < polygons.size(); i++) {
+		surface_area += polygons[i].surface_area;
+		region_iteration->polygons_accumulated_surface_area[i] = surface_area;
+	}
+	region_iteration->surface_area = surface_area;
+
+	return region_iteration;
+}
+
+TEST_CASE("[Navigation3D][NavMeshQueries3D] Indexed closest point queries should match the linear scan") {
+	Ref<NavRegionIteration3D> region_iteration = create_grid_region_iteration(32, 1.0);
+	const LocalVector<Nav3D::Polygon> &polygons = region_iteration->get_navmesh_polygons();
+	REQUIRE_FALSE(region_iteration->get_polygons_bvh().is_empty());
+
+	RandomPCG rng(42);
+	for (int i = 0; i < 256; i++) {
+		const Vector3 point(rng.random(-8.0f, 40.0f), rng.random(-4.0f, 4.0f), rng.random(-8.0f, 40.0f));
+
+		const Nav3D::ClosestPointQueryResult linear_result = NavMeshQueries3D::polygons_get_closest_point_info(polygons, point);
+		const Nav3D::ClosestPointQueryResult indexed_result = NavMeshQueries3D::region_iteration_get_closest_point_info(**region_iteration, point);
+		CHECK_EQ(indexed_result.point, linear_result.point);
+		CHECK_EQ(indexed_result.normal, linear_result.normal);
+
+		// Closest face point, as used to snap path start and end positions.
+		real_t linear_distance_squared = FLT_MAX;
+		int32_t linear_polygon_index = -1;
+		for (uint32_t polygon_index = 0; polygon_index < polygons.size(); polygon_index++) {
+			Vector3 face_point;
+			const real_t distance_squared = NavMeshQueries3D::polygon_get_closest_face_point(polygons[polygon_index], point, face_point);
+			if (distance_squared < linear_distance_squared) {
+				linear_distance_squared = distance_squared;
+				linear_polygon_index = polygon_index;
+			}
+		}
+
+		real_t indexed_distance_squared = FLT_MAX;
+		Vector3 face_point;
+		const int32_t indexed_polygon_index = region_iteration->get_polygons_bvh().find_closest(point, indexed_distance_squared, [&](int32_t p_polygon_index) {
+			return NavMeshQueries3D::polygon_get_closest_face_point(polygons[p_polygon_index], point, face_point);
+		});
+		CHECK_EQ(indexed_polygon_index, linear_polygon_index);
+		CHECK_EQ(indexed_distance_squared, linear_distance_squared);
+	}
+}
+
+TEST_CASE("[Navigation3D][NavMeshQueries3D] Indexed closest point queries should respect the search radius") {
+	Ref<NavRegionIteration3D> region_iteration = create_grid_region_iteration(8, 1.0);
+	const LocalVector<Nav3D::Polygon> &polygons = region_iteration->get_navmesh_polygons();
+
+	real_t distance_squared = 1.0;
+	Vector3 face_point;
+	const int32_t polygon_index = region_iteration->get_polygons_bvh().find_closest(Vector3(20, 0, 20), distance_squared, [&](int32_t p_polygon_index) {
+		return NavMeshQueries3D::polygon_get_closest_face_point(polygons[p_polygon_index], Vector3(20, 0, 20), face_point);
+	});
+	CHECK_EQ(polygon_index, -1);
+	CHECK_EQ(distance_squared, 1.0);
+}
+
+TEST_CASE("[Navigation3D][NavMeshQueries3D] Uniform random points should lie on the region polygons") {
+	Ref<NavRegionIteration3D> region_iteration = create_grid_region_iteration(16, 2.0);
+
+	for (int i = 0; i < 64; i++) {
+		const Vector3 random_point = NavMeshQueries3D::region_iteration_get_random_point(**region_iteration, 1, true);
+		const Nav3D::ClosestPointQueryResult result = NavMeshQueries3D::region_iteration_get_closest_point_info(**region_iteration, random_point);
+		CHECK(result.point.is_equal_approx(random_point));
+	}
+
+	Ref<NavRegionIteration3D> empty_region_iteration;
+	empty_region_iteration.instantiate();
+	CHECK_EQ(NavMeshQueries3D::region_iteration_get_random_point(**empty_region_iteration, 1, true), Vector3());
+	CHECK_EQ(NavMeshQueries3D::region_iteration_get_closest_point_info(**empty_region_iteration, Vector3(1, 2, 3)).point, Vector3());
+}
+
+} // namespace TestNavMeshQueries3D
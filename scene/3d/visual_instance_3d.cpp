@@ -91,7 +91,12 @@ void VisualInstance3D::_notification(int p_what) {
 			// ToDo : Can we turn off notify transform for physics interpolated cases?
 			if (_is_vi_visible() && !(is_inside_tree() && get_tree()->is_physics_interpolation_enabled()) && !_is_using_identity_transform()) {
 				// Physics interpolation global off, always send.
-				RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+				if (is_inside_tree()) {
+					// Sent together with the other transforms changed during this flush.
+					get_tree()->queue_instance_transform(instance, get_global_transform());
+				} else {
+					RenderingServer::get_singleton()->instance_set_transform(instance, get_global_transform());
+				}
 			}
 		} break;
 
@@ -209,6 +214,10 @@ VisualInstance3D::VisualInstance3D() {
 
 VisualInstance3D::~VisualInstance3D() {
 	ERR_FAIL_NULL(RenderingServer::get_singleton());
+	if (SceneTree::get_singleton()) {
+		// Freed while flushing transforms, don't send the queued one.
+		SceneTree::get_singleton()->cancel_instance_transform(instance);
+	}
 	RenderingServer::get_singleton()->free(instance);
 }
 
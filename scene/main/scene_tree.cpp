@@ -192,6 +192,12 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	// Only batch on the main thread, and only from the outermost flush.
+	bool batch = !instance_xform_batching && Thread::is_main_thread();
+	if (batch) {
+		instance_xform_batching = true;
+	}
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -200,6 +206,56 @@ void SceneTree::flush_transform_notifications() {
 		n = nx;
 		node->notification(NOTIFICATION_TRANSFORM_CHANGED);
 	}
+
+	if (batch) {
+		instance_xform_batching = false;
+		_flush_instance_transforms();
+	}
+}
+
+void SceneTree::queue_instance_transform(RID p_instance, const Transform3D &p_transform) {
+	// Check the thread first, the batching flag is only ever touched from the main thread.
+	if (Thread::is_main_thread() && instance_xform_batching) {
+		instance_xform_batch_rids.push_back(p_instance);
+		instance_xform_batch_transforms.push_back(p_transform);
+	} else {
+		RS::get_singleton()->instance_set_transform(p_instance, p_transform);
+	}
+}
+
+void SceneTree::cancel_instance_transform(RID p_instance) {
+	if (!Thread::is_main_thread() || !instance_xform_batching) {
+		return;
+	}
+
+	// The instance is about to be freed, and the free reaches the server before the batch.
+	int to = 0;
+	for (int i = 0; i < instance_xform_batch_rids.size(); i++) {
+		if (instance_xform_batch_rids[i] == p_instance) {
+			continue;
+		}
+		if (to != i) {
+			instance_xform_batch_rids.write[to] = instance_xform_batch_rids[i];
+			instance_xform_batch_transforms.write[to] = instance_xform_batch_transforms[i];
+		}
+		to++;
+	}
+	instance_xform_batch_rids.resize(to);
+	instance_xform_batch_transforms.resize(to);
+}
+
+void SceneTree::_flush_instance_transforms() {
+	if (instance_xform_batch_rids.is_empty()) {
+		return;
+	}
+
+	if (instance_xform_batch_rids.size() == 1) {
+		RS::get_singleton()->instance_set_transform(instance_xform_batch_rids[0], instance_xform_batch_transforms[0]);
+	} else {
+		RS::get_singleton()->instance_set_transforms(instance_xform_batch_rids, instance_xform_batch_transforms);
+	}
+	instance_xform_batch_rids.clear();
+	instance_xform_batch_transforms.clear();
 }
 
 bool SceneTree::is_accessibility_enabled() const {
@@ -255,6 +255,13 @@ private:
 
 	SelfList<Node>::List xform_change_list;
 
+	// Instance transforms collected while flushing transform notifications,
+	// sent to the RenderingServer as a single batch.
+	bool instance_xform_batching = false;
+	Vector<RID> instance_xform_batch_rids;
+	Vector<Transform3D> instance_xform_batch_transforms;
+	void _flush_instance_transforms();
+
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
 #endif
@@ -330,6 +337,8 @@ public:
 	}
 
 	void flush_transform_notifications();
+	void queue_instance_transform(RID p_instance, const Transform3D &p_transform);
+	void cancel_instance_transform(RID p_instance);
 
 	bool is_accessibility_enabled() const;
 	bool is_accessibility_supported() const;
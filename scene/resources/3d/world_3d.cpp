@@ -72,6 +72,8 @@ RID World3D::get_navigation_map() const {
 		NavigationServer3D::get_singleton()->map_set_use_edge_connections(navigation_map, GLOBAL_GET("navigation/3d/use_edge_connections"));
 		NavigationServer3D::get_singleton()->map_set_edge_connection_margin(navigation_map, GLOBAL_GET("navigation/3d/default_edge_connection_margin"));
 		NavigationServer3D::get_singleton()->map_set_link_connection_radius(navigation_map, GLOBAL_GET("navigation/3d/default_link_connection_radius"));
+		NavigationServer3D::get_singleton()->map_set_use_hierarchical_pathfinding(navigation_map, GLOBAL_GET("navigation/3d/use_hierarchical_pathfinding"));
+		NavigationServer3D::get_singleton()->map_set_hierarchical_cluster_size(navigation_map, GLOBAL_GET("navigation/3d/hierarchical_cluster_size"));
 	}
 	return navigation_map;
 }
@@ -30,8 +30,22 @@
 
 #include "compressed_texture.h"
 
+#include "core/config/project_settings.h"
 #include "scene/resources/bit_map.h"
 
+// Shared by all the textures streaming their mipmaps, textures can be loaded from any thread.
+static BinaryMutex streaming_mutex;
+static SelfList<CompressedTexture2D>::List streaming_lru; // Least recently requested first.
+static CompressedTexture2D::StreamingStats streaming_stats;
+
+struct CompressedTexture2D::StreamingRequest {
+	ObjectID texture;
+	String path;
+	uint64_t data_offset = 0;
+	int size_limit = 0;
+	uint32_t generation = 0;
+};
+
 Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit) {
 	alpha_cache.unref();
 
@@ -75,7 +89,14 @@ Error CompressedTexture2D::_load_data(const String &p_path, int &r_width, int &r
 	r_request_normal = false;
 
 #endif
-	if (!(df & FORMAT_BIT_STREAM)) {
+	image_data_offset = f->get_position();
+	uint32_t data_format = f->get_32();
+	image_size.width = f->get_16();
+	image_size.height = f->get_16();
+	f->seek(image_data_offset);
+
+	// Skipping the larger mipmaps is only possible when they are stored separately.
+	if (!(df & FORMAT_BIT_HAS_MIPMAPS) || data_format == DATA_FORMAT_BASIS_UNIVERSAL) {
 		p_size_limit = 0;
 	}
 
@@ -135,7 +156,14 @@ Error CompressedTexture2D::load(const String &p_path) {
 	bool request_roughness;
 	int mipmap_limit;
 
-	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit);
+	_clear_streaming();
+
+	int mip_tail_size = 0;
+	if (GLOBAL_GET("rendering/textures/streaming/enabled")) {
+		mip_tail_size = GLOBAL_GET("rendering/textures/streaming/mip_tail_size");
+	}
+
+	Error err = _load_data(p_path, lw, lh, image, request_3d, request_normal, request_roughness, mipmap_limit, mip_tail_size);
 	if (err) {
 		return err;
 	}
@@ -155,6 +183,18 @@ Error CompressedTexture2D::load(const String &p_path) {
 	path_to_file = p_path;
 	format = image->get_format();
 
+	int mip_level = _get_mip_level_for_size(image->get_width(), image->get_height());
+	if (mip_level > 0) {
+		mip_tail = image;
+		mip_tail_level = mip_level;
+		resident_mip_level = mip_level;
+		requested_mip_level = mip_level;
+
+		MutexLock lock(streaming_mutex);
+		streaming_lru.add_last(&streaming_list);
+		streaming_stats.streaming_textures++;
+	}
+
 	if (get_path().is_empty()) {
 		//temporarily set path if no path set for resource, helps find errors
 		RenderingServer::get_singleton()->texture_set_path(texture, p_path);
@@ -215,6 +255,7 @@ void CompressedTexture2D::draw(RID p_canvas_item, const Point2 &p_pos, const Col
 	if ((w | h) == 0) {
 		return;
 	}
+	_request_mip_level_for_scale(1.0);
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, Rect2(p_pos, Size2(w, h)), texture, false, p_modulate, p_transpose);
 }
 
@@ -222,6 +263,9 @@ void CompressedTexture2D::draw_rect(RID p_canvas_item, const Rect2 &p_rect, bool
 	if ((w | h) == 0) {
 		return;
 	}
+	if (mip_tail.is_valid() && p_rect.has_area()) {
+		_request_mip_level_for_scale(p_tile ? 1.0 : MIN(w / Math::abs(p_rect.size.width), h / Math::abs(p_rect.size.height)));
+	}
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect(p_canvas_item, p_rect, texture, p_tile, p_modulate, p_transpose);
 }
 
@@ -229,6 +273,9 @@ void CompressedTexture2D::draw_rect_region(RID p_canvas_item, const Rect2 &p_rec
 	if ((w | h) == 0) {
 		return;
 	}
+	if (mip_tail.is_valid() && p_rect.has_area()) {
+		_request_mip_level_for_scale(MIN(Math::abs(p_src_rect.size.width / p_rect.size.width), Math::abs(p_src_rect.size.height / p_rect.size.height)));
+	}
 	RenderingServer::get_singleton()->canvas_item_add_texture_rect_region(p_canvas_item, p_rect, texture, p_src_rect, p_modulate, p_transpose, p_clip_uv);
 }
 
@@ -278,6 +325,179 @@ bool CompressedTexture2D::is_pixel_opaque(int p_x, int p_y) const {
 	return true;
 }
 
+bool CompressedTexture2D::is_streaming() const {
+	return mip_tail.is_valid();
+}
+
+int CompressedTexture2D::get_resident_mip_level() const {
+	return resident_mip_level;
+}
+
+void CompressedTexture2D::request_mip_level(int p_mip_level) const {
+	if (mip_tail.is_null()) {
+		return;
+	}
+
+	MutexLock lock(streaming_mutex);
+
+	// Recently requested textures are evicted last.
+	streaming_lru.remove(&streaming_list);
+	streaming_lru.add_last(&streaming_list);
+
+	p_mip_level = CLAMP(p_mip_level, 0, mip_tail_level);
+	if (p_mip_level >= requested_mip_level) {
+		return;
+	}
+	requested_mip_level = p_mip_level;
+
+	if (streaming_task == WorkerThreadPool::INVALID_TASK_ID) {
+		_start_streaming();
+	}
+}
+
+CompressedTexture2D::StreamingStats CompressedTexture2D::get_streaming_stats() {
+	MutexLock lock(streaming_mutex);
+	return streaming_stats;
+}
+
+int CompressedTexture2D::_get_mip_level_for_size(int p_width, int p_height) const {
+	int mip_level = 0;
+	while (mip_level < 31 && (MAX(image_size.width >> mip_level, 1) > p_width || MAX(image_size.height >> mip_level, 1) > p_height)) {
+		mip_level++;
+	}
+	return mip_level;
+}
+
+void CompressedTexture2D::_request_mip_level_for_scale(real_t p_texels_per_pixel) const {
+	if (mip_tail.is_null()) {
+		return;
+	}
+	int mip_level = 0;
+	if (p_texels_per_pixel > 1.0) {
+		mip_level = Math::floor(Math::log2(p_texels_per_pixel));
+	}
+	if (mip_level < requested_mip_level) {
+		request_mip_level(mip_level);
+	}
+}
+
+void CompressedTexture2D::_start_streaming() const {
+	StreamingRequest *request = memnew(StreamingRequest);
+	request->texture = get_instance_id();
+	request->path = path_to_file;
+	request->data_offset = image_data_offset;
+	request->size_limit = MAX(MAX(image_size.width >> requested_mip_level, 1), MAX(image_size.height >> requested_mip_level, 1));
+	request->generation = streaming_generation;
+
+	streaming_stats.pending_requests++;
+	streaming_task = WorkerThreadPool::get_singleton()->add_native_task(&CompressedTexture2D::_streaming_task, request, false, SNAME("CompressedTexture2DStreaming"));
+}
+
+void CompressedTexture2D::_streaming_task(void *p_userdata) {
+	StreamingRequest *request = static_cast<StreamingRequest *>(p_userdata);
+
+	Ref<Image> image;
+	Ref<FileAccess> f = FileAccess::open(request->path, FileAccess::READ);
+	if (f.is_valid()) {
+		f->seek(request->data_offset);
+		image = load_image_from_file(f, request->size_limit);
+	}
+
+	callable_mp_static(&CompressedTexture2D::_streaming_finished).call_deferred(uint64_t(request->texture), image, request->generation);
+	memdelete(request);
+}
+
+void CompressedTexture2D::_streaming_finished(uint64_t p_texture, const Ref<Image> &p_image, uint32_t p_generation) {
+	CompressedTexture2D *texture = ObjectDB::get_instance<CompressedTexture2D>(ObjectID(p_texture));
+	if (!texture) {
+		return;
+	}
+
+	MutexLock lock(streaming_mutex);
+	if (texture->streaming_generation != p_generation || texture->streaming_task == WorkerThreadPool::INVALID_TASK_ID) {
+		return; // Reloaded in the meantime.
+	}
+
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(texture->streaming_task);
+	texture->streaming_task = WorkerThreadPool::INVALID_TASK_ID;
+	streaming_stats.pending_requests--;
+
+	if (p_image.is_null() || p_image->is_empty() || p_image->get_format() != texture->format) {
+		texture->requested_mip_level = texture->resident_mip_level;
+		ERR_FAIL_MSG(vformat("Unable to stream mipmaps from file: %s.", texture->path_to_file));
+	}
+
+	int mip_level = texture->_get_mip_level_for_size(p_image->get_width(), p_image->get_height());
+	if (mip_level < texture->resident_mip_level) {
+		texture->_set_resident_image(p_image, mip_level);
+		streaming_stats.streamed_in++;
+		_enforce_streaming_budget(texture);
+	}
+
+	if (texture->requested_mip_level < texture->resident_mip_level) {
+		texture->_start_streaming(); // Requested again while loading.
+	} else {
+		texture->requested_mip_level = texture->resident_mip_level;
+	}
+}
+
+void CompressedTexture2D::_enforce_streaming_budget(const CompressedTexture2D *p_keep) {
+	streaming_stats.memory_budget = uint64_t(int(GLOBAL_GET("rendering/textures/streaming/memory_budget_mb"))) * 1024 * 1024;
+
+	SelfList<CompressedTexture2D> *E = streaming_lru.first();
+	while (E && streaming_stats.streamed_memory > streaming_stats.memory_budget) {
+		CompressedTexture2D *texture = E->self();
+		E = E->next();
+		if (texture == p_keep || texture->streamed_size == 0) {
+			continue;
+		}
+
+		// Drop back to the mip tail, which is kept in memory.
+		texture->_set_resident_image(texture->mip_tail, texture->mip_tail_level);
+		texture->requested_mip_level = texture->mip_tail_level;
+		streaming_stats.evicted++;
+	}
+}
+
+void CompressedTexture2D::_set_resident_image(const Ref<Image> &p_image, int p_mip_level) const {
+	RID new_texture = RS::get_singleton()->texture_2d_create(p_image);
+	RS::get_singleton()->texture_replace(texture, new_texture);
+	if (w || h) {
+		RS::get_singleton()->texture_set_size_override(texture, w, h);
+	}
+	alpha_cache.unref();
+
+	streaming_stats.streamed_memory -= streamed_size;
+	streamed_size = p_mip_level < mip_tail_level ? p_image->get_data_size() - mip_tail->get_data_size() : 0;
+	streaming_stats.streamed_memory += streamed_size;
+	resident_mip_level = p_mip_level;
+}
+
+void CompressedTexture2D::_clear_streaming() {
+	if (streaming_task != WorkerThreadPool::INVALID_TASK_ID) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(streaming_task);
+	}
+
+	MutexLock lock(streaming_mutex);
+	if (streaming_task != WorkerThreadPool::INVALID_TASK_ID) {
+		streaming_task = WorkerThreadPool::INVALID_TASK_ID;
+		streaming_stats.pending_requests--;
+	}
+	streaming_generation++;
+
+	if (streaming_list.in_list()) {
+		streaming_lru.remove(&streaming_list);
+		streaming_stats.streaming_textures--;
+	}
+	streaming_stats.streamed_memory -= streamed_size;
+	streamed_size = 0;
+
+	mip_tail.unref();
+	mip_tail_level = 0;
+	resident_mip_level = 0;
+	requested_mip_level = 0;
+}
+
 void CompressedTexture2D::reload_from_file() {
 	String path = get_path();
 	if (!path.is_resource_file()) {
@@ -313,7 +533,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 		for (uint32_t i = 0; i < mipmaps + 1; i++) {
 			uint32_t size = f->get_32();
 
-			if (p_size_limit > 0 && i < (mipmaps - 1) && (sw > p_size_limit || sh > p_size_limit)) {
+			if (p_size_limit > 0 && i < mipmaps && (sw > p_size_limit || sh > p_size_limit)) {
 				//can't load this due to size limit
 				sw = MAX(sw >> 1, 1);
 				sh = MAX(sh >> 1, 1);
@@ -321,18 +541,28 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				continue;
 			}
 
-			Vector<uint8_t> pv;
-			pv.resize(size);
-			{
-				uint8_t *wr = pv.ptrw();
-				f->get_buffer(wr, size);
-			}
-
 			Ref<Image> img;
-			if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
-				img = Image::png_unpacker(pv);
-			} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
-				img = Image::webp_unpacker(pv);
+			// Decode straight from the file mapping if the file can be mapped, to skip the intermediate buffer.
+			Span<uint8_t> mapped = f->get_buffer_mapped(size);
+			if (!mapped.is_empty()) {
+				if (data_format == DATA_FORMAT_PNG && Image::_png_mem_unpacker_func) {
+					img = Image::_png_mem_unpacker_func(mapped.ptr(), mapped.size());
+				} else if (data_format == DATA_FORMAT_WEBP && Image::_webp_mem_loader_func) {
+					img = Image::_webp_mem_loader_func(mapped.ptr(), mapped.size());
+				}
+			} else {
+				Vector<uint8_t> pv;
+				pv.resize(size);
+				{
+					uint8_t *wr = pv.ptrw();
+					f->get_buffer(wr, size);
+				}
+
+				if (data_format == DATA_FORMAT_PNG && Image::png_unpacker) {
+					img = Image::png_unpacker(pv);
+				} else if (data_format == DATA_FORMAT_WEBP && Image::webp_unpacker) {
+					img = Image::webp_unpacker(pv);
+				}
 			}
 
 			if (img.is_null() || img->is_empty()) {
@@ -387,7 +617,7 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 				}
 			}
 
-			image->set_data(w, h, true, mipmap_images[0]->get_format(), img_data);
+			image->set_data(mipmap_images[0]->get_width(), mipmap_images[0]->get_height(), true, mipmap_images[0]->get_format(), img_data);
 			return image;
 		}
 
@@ -402,14 +632,19 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			f->seek(f->get_position() + size);
 			return Ref<Image>();
 		}
-		Vector<uint8_t> pv;
-		pv.resize(size);
-		{
-			uint8_t *wr = pv.ptrw();
-			f->get_buffer(wr, size);
-		}
 		Ref<Image> img;
-		img = Image::basis_universal_unpacker(pv);
+		Span<uint8_t> mapped = f->get_buffer_mapped(size);
+		if (!mapped.is_empty()) {
+			img = Image::basis_universal_unpacker_ptr(mapped.ptr(), mapped.size());
+		} else {
+			Vector<uint8_t> pv;
+			pv.resize(size);
+			{
+				uint8_t *wr = pv.ptrw();
+				f->get_buffer(wr, size);
+			}
+			img = Image::basis_universal_unpacker(pv);
+		}
 		if (img.is_null() || img->is_empty()) {
 			ERR_FAIL_COND_V(img.is_null() || img->is_empty(), Ref<Image>());
 		}
@@ -424,13 +659,14 @@ Ref<Image> CompressedTexture2D::load_image_from_file(Ref<FileAccess> f, int p_si
 			int tw, th;
 			int ofs = Image::get_image_mipmap_offset_and_dimensions(w, h, format, i, tw, th);
 
-			if (p_size_limit > 0 && i < mipmaps && (p_size_limit > tw || p_size_limit > th)) {
-				if (ofs) {
-					f->seek(f->get_position() + ofs);
-				}
+			if (p_size_limit > 0 && i < mipmaps && (tw > p_size_limit || th > p_size_limit)) {
 				continue; //oops, size limit enforced, go to next
 			}
 
+			if (ofs) {
+				f->seek(f->get_position() + ofs);
+			}
+
 			Vector<uint8_t> data;
 			data.resize(size - ofs);
 
@@ -452,10 +688,19 @@ void CompressedTexture2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("load", "path"), &CompressedTexture2D::load);
 	ClassDB::bind_method(D_METHOD("get_load_path"), &CompressedTexture2D::get_load_path);
 
+	ClassDB::bind_method(D_METHOD("is_streaming"), &CompressedTexture2D::is_streaming);
+	ClassDB::bind_method(D_METHOD("get_resident_mip_level"), &CompressedTexture2D::get_resident_mip_level);
+	ClassDB::bind_method(D_METHOD("request_mip_level", "mip_level"), &CompressedTexture2D::request_mip_level);
+
 	ADD_PROPERTY(PropertyInfo(Variant::STRING, "load_path", PROPERTY_HINT_FILE, "*.ctex"), "load", "get_load_path");
 }
 
+CompressedTexture2D::CompressedTexture2D() :
+		streaming_list(this) {
+}
+
 CompressedTexture2D::~CompressedTexture2D() {
+	_clear_streaming();
 	if (texture.is_valid()) {
 		ERR_FAIL_NULL(RenderingServer::get_singleton());
 		RS::get_singleton()->free(texture);
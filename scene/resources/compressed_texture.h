@@ -31,6 +31,8 @@
 #pragma once
 
 #include "core/io/resource_loader.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/templates/self_list.h"
 #include "scene/resources/texture.h"
 
 class BitMap;
@@ -59,6 +61,15 @@ public:
 		FORMAT_BIT_DETECT_ROUGNESS = 1 << 27,
 	};
 
+	struct StreamingStats {
+		uint64_t streamed_memory = 0; // Memory used by the mipmaps loaded above the mip tails.
+		uint64_t memory_budget = 0;
+		uint32_t streaming_textures = 0;
+		uint32_t pending_requests = 0;
+		uint32_t streamed_in = 0;
+		uint32_t evicted = 0;
+	};
+
 private:
 	String path_to_file;
 	mutable RID texture;
@@ -67,6 +78,30 @@ private:
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
 
+	// Mipmap streaming: only the mip tail is loaded with the texture, the larger mipmaps are loaded on request.
+	struct StreamingRequest;
+
+	mutable SelfList<CompressedTexture2D> streaming_list;
+	Ref<Image> mip_tail;
+	int mip_tail_level = 0;
+	Size2i image_size; // Size of the largest mipmap stored in the file.
+	uint64_t image_data_offset = 0;
+	mutable int resident_mip_level = 0;
+	mutable int requested_mip_level = 0;
+	mutable uint64_t streamed_size = 0;
+	mutable uint32_t streaming_generation = 0;
+	mutable WorkerThreadPool::TaskID streaming_task = WorkerThreadPool::INVALID_TASK_ID;
+
+	static void _streaming_task(void *p_userdata);
+	static void _streaming_finished(uint64_t p_texture, const Ref<Image> &p_image, uint32_t p_generation);
+	static void _enforce_streaming_budget(const CompressedTexture2D *p_keep);
+
+	int _get_mip_level_for_size(int p_width, int p_height) const;
+	void _request_mip_level_for_scale(real_t p_texels_per_pixel) const;
+	void _start_streaming() const;
+	void _set_resident_image(const Ref<Image> &p_image, int p_mip_level) const;
+	void _clear_streaming();
+
 	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
 	virtual void reload_from_file() override;
 
@@ -106,6 +141,13 @@ public:
 
 	virtual Ref<Image> get_image() const override;
 
+	bool is_streaming() const;
+	int get_resident_mip_level() const;
+	void request_mip_level(int p_mip_level) const;
+
+	static StreamingStats get_streaming_stats();
+
+	CompressedTexture2D();
 	~CompressedTexture2D();
 };
 
@@ -241,6 +241,9 @@ public:
 	EXBIND1RC(Vector<Vector3>, space_get_contacts, RID)
 	EXBIND1RC(int, space_get_contact_count, RID)
 
+	EXBIND1RC(Vector<uint8_t>, space_save_snapshot, RID)
+	EXBIND2R(bool, space_restore_snapshot, RID, const Vector<uint8_t> &)
+
 	/* AREA API */
 
 	//EXBIND0RID(area);
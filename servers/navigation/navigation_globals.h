@@ -46,6 +46,8 @@ constexpr const char *const NAV_MESH_CELL_SIZE_HINT = "0.001,100,0.001,or_greate
 constexpr float EDGE_CONNECTION_MARGIN = 0.25f;
 constexpr float LINK_CONNECTION_RADIUS = 1.0f;
 constexpr int path_search_max_polygons = 4096;
+constexpr float HIERARCHICAL_CLUSTER_SIZE = 32.0f;
+constexpr int PATH_QUERY_QUEUE_BUDGET = 256;
 
 // Agent.
 
@@ -62,6 +62,12 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_edge_connection_margin", "map"), &NavigationServer3D::map_get_edge_connection_margin);
 	ClassDB::bind_method(D_METHOD("map_set_link_connection_radius", "map", "radius"), &NavigationServer3D::map_set_link_connection_radius);
 	ClassDB::bind_method(D_METHOD("map_get_link_connection_radius", "map"), &NavigationServer3D::map_get_link_connection_radius);
+	ClassDB::bind_method(D_METHOD("map_set_use_hierarchical_pathfinding", "map", "enabled"), &NavigationServer3D::map_set_use_hierarchical_pathfinding);
+	ClassDB::bind_method(D_METHOD("map_get_use_hierarchical_pathfinding", "map"), &NavigationServer3D::map_get_use_hierarchical_pathfinding);
+	ClassDB::bind_method(D_METHOD("map_set_hierarchical_cluster_size", "map", "cluster_size"), &NavigationServer3D::map_set_hierarchical_cluster_size);
+	ClassDB::bind_method(D_METHOD("map_get_hierarchical_cluster_size", "map"), &NavigationServer3D::map_get_hierarchical_cluster_size);
+	ClassDB::bind_method(D_METHOD("map_set_path_query_queue_budget", "map", "budget"), &NavigationServer3D::map_set_path_query_queue_budget);
+	ClassDB::bind_method(D_METHOD("map_get_path_query_queue_budget", "map"), &NavigationServer3D::map_get_path_query_queue_budget);
 	ClassDB::bind_method(D_METHOD("map_get_path", "map", "origin", "destination", "optimize", "navigation_layers"), &NavigationServer3D::map_get_path, DEFVAL(1));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_to_segment", "map", "start", "end", "use_collision"), &NavigationServer3D::map_get_closest_point_to_segment, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point", "map", "to_point"), &NavigationServer3D::map_get_closest_point);
@@ -81,6 +87,7 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer3D::map_get_random_point);
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result", "callback"), &NavigationServer3D::query_path, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_async", "parameters", "result", "callback"), &NavigationServer3D::query_path_async, DEFVAL(Callable()));
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer3D::region_create);
 	ClassDB::bind_method(D_METHOD("region_get_iteration_id", "region"), &NavigationServer3D::region_get_iteration_id);
@@ -202,6 +209,8 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("parse_source_geometry_data", "navigation_mesh", "source_geometry_data", "root_node", "callback"), &NavigationServer3D::parse_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data", "navigation_mesh", "source_geometry_data", "callback"), &NavigationServer3D::bake_from_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data_async", "navigation_mesh", "source_geometry_data", "callback"), &NavigationServer3D::bake_from_source_geometry_data_async, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("bake_tiles_from_source_geometry_data", "navigation_mesh", "source_geometry_data", "changed_aabb", "callback"), &NavigationServer3D::bake_tiles_from_source_geometry_data, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("bake_tiles_from_source_geometry_data_async", "navigation_mesh", "source_geometry_data", "changed_aabb", "callback"), &NavigationServer3D::bake_tiles_from_source_geometry_data_async, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("is_baking_navigation_mesh", "navigation_mesh"), &NavigationServer3D::is_baking_navigation_mesh);
 #endif // _3D_DISABLED
 
@@ -234,6 +243,8 @@ void NavigationServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(INFO_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(INFO_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_QUERY_QUEUE_SIZE);
+	BIND_ENUM_CONSTANT(INFO_PATH_QUERY_LATENCY);
 }
 
 NavigationServer3D *NavigationServer3D::get_singleton() {
@@ -251,6 +262,9 @@ NavigationServer3D::NavigationServer3D() {
 	GLOBAL_DEF("navigation/3d/use_edge_connections", true);
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::FLOAT, "navigation/3d/default_edge_connection_margin", PROPERTY_HINT_RANGE, "0.01,10,0.001,or_greater"), NavigationDefaults3D::EDGE_CONNECTION_MARGIN);
 	GLOBAL_DEF_BASIC(PropertyInfo(Variant::FLOAT, "navigation/3d/default_link_connection_radius", PROPERTY_HINT_RANGE, "0.01,10,0.001,or_greater"), NavigationDefaults3D::LINK_CONNECTION_RADIUS);
+	GLOBAL_DEF("navigation/3d/use_hierarchical_pathfinding", false);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "navigation/3d/hierarchical_cluster_size", PROPERTY_HINT_RANGE, "1,1000,0.01,or_greater,suffix:m"), NavigationDefaults3D::HIERARCHICAL_CLUSTER_SIZE);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "navigation/3d/path_query_queue_budget", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), NavigationDefaults3D::PATH_QUERY_QUEUE_BUDGET);
 
 #ifdef DEBUG_ENABLED
 #ifndef DISABLE_DEPRECATED
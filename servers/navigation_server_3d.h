@@ -84,6 +84,16 @@ public:
 	virtual void map_set_link_connection_radius(RID p_map, real_t p_connection_radius) = 0;
 	virtual real_t map_get_link_connection_radius(RID p_map) const = 0;
 
+	virtual void map_set_use_hierarchical_pathfinding(RID p_map, bool p_enabled) = 0;
+	virtual bool map_get_use_hierarchical_pathfinding(RID p_map) const = 0;
+
+	virtual void map_set_hierarchical_cluster_size(RID p_map, real_t p_cluster_size) = 0;
+	virtual real_t map_get_hierarchical_cluster_size(RID p_map) const = 0;
+
+	/// Set the maximum number of queued path queries processed by each physics step of the map.
+	virtual void map_set_path_query_queue_budget(RID p_map, int p_budget) = 0;
+	virtual int map_get_path_query_queue_budget(RID p_map) const = 0;
+
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) = 0;
 
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const = 0;
@@ -278,6 +288,7 @@ public:
 	/* QUERY API */
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
 
 	/* NAVMESH BAKE API */
 
@@ -285,6 +296,8 @@ public:
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
+	virtual void bake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback = Callable()) = 0;
+	virtual void bake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_changed_aabb, const Callable &p_callback = Callable()) = 0;
 	virtual bool is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const = 0;
 	virtual String get_baking_navigation_mesh_state_msg(Ref<NavigationMesh> p_navigation_mesh) const = 0;
 #endif // _3D_DISABLED
@@ -326,6 +339,8 @@ public:
 		INFO_EDGE_CONNECTION_COUNT,
 		INFO_EDGE_FREE_COUNT,
 		INFO_OBSTACLE_COUNT,
+		INFO_PATH_QUERY_QUEUE_SIZE,
+		INFO_PATH_QUERY_LATENCY,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) const = 0;
@@ -307,6 +307,9 @@ public:
 	virtual Vector<Vector3> space_get_contacts(RID p_space) const = 0;
 	virtual int space_get_contact_count(RID p_space) const = 0;
 
+	virtual Vector<uint8_t> space_save_snapshot(RID p_space) const = 0;
+	virtual bool space_restore_snapshot(RID p_space, const Vector<uint8_t> &p_snapshot) = 0;
+
 	//missing space parameters
 
 	/* AREA API */
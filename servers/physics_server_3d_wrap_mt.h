@@ -127,6 +127,9 @@ public:
 		return physics_server_3d->space_get_contact_count(p_space);
 	}
 
+	FUNC1RC(Vector<uint8_t>, space_save_snapshot, RID);
+	FUNC2R(bool, space_restore_snapshot, RID, const Vector<uint8_t> &);
+
 	/* AREA API */
 
 	//FUNC0RID(area);
@@ -996,6 +996,18 @@ void RendererSceneCull::instance_set_transform(RID p_instance, const Transform3D
 	_instance_queue_update(instance, true);
 }
 
+void RendererSceneCull::instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+
+	const RID *instances = p_instances.ptr();
+	const Transform3D *transforms = p_transforms.ptr();
+	for (int i = 0; i < p_instances.size(); i++) {
+		// Skip invalid instances without dropping the rest of the batch.
+		ERR_CONTINUE_MSG(!instance_owner.owns(instances[i]), vformat("Invalid instance at index %d of the transform batch.", i));
+		instance_set_transform(instances[i], transforms[i]);
+	}
+}
+
 void RendererSceneCull::instance_attach_object_instance_id(RID p_instance, ObjectID p_id) {
 	Instance *instance = instance_owner.get_or_null(p_instance);
 	ERR_FAIL_NULL(instance);
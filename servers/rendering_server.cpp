@@ -2086,6 +2086,19 @@ void RenderingServer::_particles_set_trail_bind_poses(RID p_particles, const Typ
 	particles_set_trail_bind_poses(p_particles, tbposes);
 }
 
+void RenderingServer::_instance_set_transforms(const TypedArray<RID> &p_instances, const TypedArray<Transform3D> &p_transforms) {
+	ERR_FAIL_COND(p_instances.size() != p_transforms.size());
+	Vector<RID> instances;
+	Vector<Transform3D> transforms;
+	instances.resize(p_instances.size());
+	transforms.resize(p_transforms.size());
+	for (int i = 0; i < p_instances.size(); i++) {
+		instances.write[i] = p_instances[i];
+		transforms.write[i] = p_transforms[i];
+	}
+	instance_set_transforms(instances, transforms);
+}
+
 String RenderingServer::get_current_rendering_driver_name() const {
 	// Needs to remain in OS, since it's actually OS that interacts with it, but it's better exposed here.
 	return ::OS::get_singleton()->get_current_rendering_driver_name();
@@ -3183,6 +3196,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_pivot_data", "instance", "sorting_offset", "use_aabb_center"), &RenderingServer::instance_set_pivot_data);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_transforms", "instances", "transforms"), &RenderingServer::_instance_set_transforms);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &RenderingServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_override_material", "instance", "surface", "material"), &RenderingServer::instance_set_surface_override_material);
@@ -3615,6 +3629,10 @@ void RenderingServer::init() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/webp_compression/compression_method", PROPERTY_HINT_RANGE, "0,6,1"), 2);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/textures/webp_compression/lossless_compression_factor", PROPERTY_HINT_RANGE, "0,100,1"), 25);
 
+	GLOBAL_DEF("rendering/textures/streaming/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/streaming/mip_tail_size", PROPERTY_HINT_RANGE, "1,4096,1,suffix:px"), 128);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/textures/streaming/memory_budget_mb", PROPERTY_HINT_RANGE, "1,65536,1,suffix:MiB"), 512);
+
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/limits/time/time_rollover_secs", PROPERTY_HINT_RANGE, "1,10000,1,or_greater,suffix:s"), 3600);
 
 	GLOBAL_DEF_RST("rendering/lights_and_shadows/use_physical_light_units", false);
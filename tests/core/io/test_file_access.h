@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/io/file_access.h"
+#include "core/io/file_access_memory.h"
 #include "tests/test_macros.h"
 #include "tests/test_utils.h"
 
@@ -107,6 +108,49 @@ TEST_CASE("[FileAccess] Get as UTF-8 String") {
 	CHECK(s_cr_nocr == "Hello darknessMy old friendI've come to talkWith you again");
 }
 
+TEST_CASE("[FileAccess] Get mapped buffer") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("testdata.csv"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+	const Vector<uint8_t> reference = f->get_buffer(f->get_length());
+	REQUIRE(reference.size() > 16);
+
+	f->seek(5);
+	Span<uint8_t> mapped = f->get_buffer_mapped(10);
+#ifdef UNIX_ENABLED
+	REQUIRE_FALSE(mapped.is_empty());
+#endif
+	if (mapped.is_empty()) {
+		// Backends without mapping support must leave the cursor untouched.
+		CHECK_EQ(f->get_position(), 5u);
+	} else {
+		CHECK_EQ(mapped.size(), 10u);
+		CHECK_EQ(memcmp(mapped.ptr(), reference.ptr() + 5, 10), 0);
+		CHECK_EQ(f->get_position(), 15u);
+		CHECK_EQ(f->get_8(), reference[15]);
+	}
+
+	f->seek(reference.size() - 4);
+	CHECK(f->get_buffer_mapped(8).is_empty());
+	CHECK_EQ(f->get_position(), uint64_t(reference.size() - 4));
+
+	Ref<FileAccess> fw = FileAccess::open(TestUtils::get_data_path("mapped_buffer_new.bin"), FileAccess::WRITE_READ);
+	REQUIRE(fw.is_valid());
+	fw->store_buffer(reference);
+	fw->seek(0);
+	CHECK_MESSAGE(fw->get_buffer_mapped(4).is_empty(), "Files opened for writing should not be mapped.");
+	fw->close();
+	DirAccess::remove_file_or_error(TestUtils::get_data_path("mapped_buffer_new.bin"));
+
+	Ref<FileAccessMemory> fm;
+	fm.instantiate();
+	fm->open_custom(reference.ptr(), reference.size());
+	fm->seek(2);
+	mapped = fm->get_buffer_mapped(6);
+	CHECK_EQ(mapped.ptr(), reference.ptr() + 2);
+	CHECK_EQ(mapped.size(), 6u);
+	CHECK_EQ(fm->get_position(), 8u);
+}
+
 TEST_CASE("[FileAccess] Get/Store floating point values") {
 	// BigEndian Hex: 0x40490E56
 	// LittleEndian Hex: 0x560E4940
@@ -470,4 +470,83 @@ TEST_CASE("[Image] Convert image") {
 	CHECK_MESSAGE(image2->get_data() == image_data, "Image conversion to invalid type (Image::FORMAT_MAX + 1) should not alter image.");
 }
 
+TEST_CASE("[Image] Processing large images") {
+	// Large enough to be split across worker threads, with a size that isn't a multiple of the band count.
+	const int width = 602;
+	const int height = 301;
+	PackedByteArray source_data;
+	source_data.resize(width * height * 4);
+	for (int i = 0; i < source_data.size(); i++) {
+		source_data.write[i] = (i * 7 + (i / (width * 4)) * 13) & 0xff;
+	}
+	const Ref<Image> source = Image::create_from_data(width, height, false, Image::FORMAT_RGBA8, source_data);
+
+	SUBCASE("Premultiply alpha") {
+		Ref<Image> image = source->duplicate();
+		image->premultiply_alpha();
+		const uint8_t *r = image->ptr();
+		bool matches = true;
+		for (int i = 0; i < width * height * 4; i += 4) {
+			for (int c = 0; c < 3; c++) {
+				matches = matches && r[i + c] == ((uint16_t(source_data[i + c]) * uint16_t(source_data[i + 3]) + 255U) >> 8);
+			}
+			matches = matches && r[i + 3] == source_data[i + 3];
+		}
+		CHECK_MESSAGE(matches, "All rows should be premultiplied.");
+	}
+
+	SUBCASE("Convert") {
+		Ref<Image> image = source->duplicate();
+		image->convert(Image::FORMAT_RGB8);
+		const uint8_t *r = image->ptr();
+		bool matches = true;
+		for (int i = 0; i < width * height; i++) {
+			for (int c = 0; c < 3; c++) {
+				matches = matches && r[i * 3 + c] == source_data[i * 4 + c];
+			}
+		}
+		CHECK_MESSAGE(matches, "All rows should be converted.");
+	}
+
+	SUBCASE("Generate mipmaps") {
+		Ref<Image> image = source->duplicate();
+		image->crop(512, 256);
+		image->generate_mipmaps();
+		const Ref<Image> mip = image->get_image_from_mipmap(1);
+		REQUIRE(mip->get_size() == Vector2i(256, 128));
+		bool matches = true;
+		for (int y = 0; y < 128; y++) {
+			for (int x = 0; x < 256; x++) {
+				for (int c = 0; c < 4; c++) {
+					const uint32_t sum = source_data[((y * 2) * width + x * 2) * 4 + c] + source_data[((y * 2) * width + x * 2 + 1) * 4 + c] + source_data[((y * 2 + 1) * width + x * 2) * 4 + c] + source_data[((y * 2 + 1) * width + x * 2 + 1) * 4 + c];
+					matches = matches && mip->ptr()[(y * 256 + x) * 4 + c] == ((sum + 2) >> 2);
+				}
+			}
+		}
+		CHECK_MESSAGE(matches, "All rows of the mipmap should be averaged from the previous level.");
+	}
+
+	SUBCASE("Resize") {
+		Ref<Image> image = source->duplicate();
+		image->resize(width * 2, height * 2, Image::INTERPOLATE_NEAREST);
+		bool matches = true;
+		for (int y = 0; y < height * 2; y++) {
+			for (int x = 0; x < width * 2; x++) {
+				matches = matches && image->get_pixel(x, y) == source->get_pixel(x / 2, y / 2);
+			}
+		}
+		CHECK_MESSAGE(matches, "All rows should be resized.");
+
+		const Ref<Image> uniform = Image::create_empty(width, height, false, Image::FORMAT_RGBA8);
+		uniform->fill(Color::from_rgba8(10, 20, 30, 40));
+		for (int i = 0; i < 5; i++) {
+			Ref<Image> resized = uniform->duplicate();
+			resized->resize(700, 500, static_cast<Image::Interpolation>(i));
+			const Ref<Image> expected = Image::create_empty(700, 500, false, Image::FORMAT_RGBA8);
+			expected->fill(Color::from_rgba8(10, 20, 30, 40));
+			CHECK_MESSAGE(resized->get_data() == expected->get_data(), vformat("All rows should be resized with interpolation %d.", i));
+		}
+	}
+}
+
 } // namespace TestImage
@@ -239,6 +239,76 @@ TEST_CASE("[JSON] Parsing objects (dictionaries)") {
 			"The parsed JSON should contain the expected values.");
 }
 
+TEST_CASE("[JSON] Parsing from a buffer") {
+	const String source = String::utf8(R"( {"name": "Godot Engine", "is_free": true, "bugs": null, "apples": {"red": 500, "green": 0, "blue": -20}, "float": -1.25e2, "big": 12345678901234567, "text": "Tab\t\"quoted\" é 😀 ünïcödé", "nested": [[1, [2]], [], {}]} )");
+
+	JSON string_json;
+	REQUIRE(string_json.parse(source) == OK);
+
+	JSON buffer_json;
+	REQUIRE(buffer_json.parse_buffer(source.to_utf8_buffer()) == OK);
+	CHECK_MESSAGE(
+			buffer_json.get_data() == string_json.get_data(),
+			"Parsing from a buffer should give the same result as parsing from a string.");
+	CHECK_MESSAGE(
+			buffer_json.get_parsed_text().is_empty(),
+			"Parsing from a buffer should not keep the text.");
+
+	ERR_PRINT_OFF
+	CHECK(buffer_json.parse_buffer(String("[1, 2,\n 3 4]").to_utf8_buffer()) == ERR_PARSE_ERROR);
+	CHECK(buffer_json.get_error_line() == 1);
+	CHECK(buffer_json.get_error_message() == "Expected ','");
+	CHECK(buffer_json.parse_buffer(String("[1] 2").to_utf8_buffer()) == ERR_PARSE_ERROR);
+	CHECK(buffer_json.get_error_message() == "Expected 'EOF'");
+	CHECK(buffer_json.get_data() == Variant());
+	CHECK(buffer_json.parse_buffer(String("\"unterminated").to_utf8_buffer()) == ERR_PARSE_ERROR);
+	CHECK(buffer_json.get_error_message() == "Unterminated string");
+	CHECK(buffer_json.parse_buffer(String("nope").to_utf8_buffer()) == ERR_PARSE_ERROR);
+	ERR_PRINT_ON
+}
+
+TEST_CASE("[JSON] Parsing from a buffer with a schema") {
+	const String source = R"({"name": "mesh", "count": 3, "visible": true, "vertices": [0.5, -1, 2e1], "indices": [0, 1, 2], "frames": [[1, 2], [3]], "tags": ["a", "b"], "extra": [1, "x"]})";
+
+	Dictionary schema;
+	schema["name"] = Variant::STRING;
+	schema["count"] = Variant::INT;
+	schema["visible"] = Variant::BOOL;
+	schema["vertices"] = Variant::PACKED_FLOAT32_ARRAY;
+	schema["indices"] = Variant::PACKED_INT32_ARRAY;
+	Array frames_schema;
+	frames_schema.push_back(Variant::PACKED_INT64_ARRAY);
+	schema["frames"] = frames_schema;
+	schema["tags"] = Variant::PACKED_STRING_ARRAY;
+
+	JSON json;
+	REQUIRE(json.parse_buffer(source.to_utf8_buffer(), schema) == OK);
+	const Dictionary data = json.get_data();
+
+	CHECK(data["name"] == "mesh");
+	CHECK(data["count"].get_type() == Variant::INT);
+	CHECK(int(data["count"]) == 3);
+	CHECK(data["visible"] == Variant(true));
+	CHECK(data["vertices"].get_type() == Variant::PACKED_FLOAT32_ARRAY);
+	CHECK(data["vertices"] == Variant(PackedFloat32Array{ 0.5, -1, 20 }));
+	CHECK(data["indices"] == Variant(PackedInt32Array{ 0, 1, 2 }));
+	const Array frames = data["frames"];
+	REQUIRE(frames.size() == 2);
+	CHECK(frames[0] == Variant(PackedInt64Array{ 1, 2 }));
+	CHECK(frames[1] == Variant(PackedInt64Array{ 3 }));
+	CHECK(data["tags"] == Variant(PackedStringArray{ "a", "b" }));
+	CHECK_MESSAGE(
+			data["extra"].get_type() == Variant::ARRAY,
+			"Values without a schema should be parsed as usual.");
+
+	ERR_PRINT_OFF
+	CHECK(json.parse_buffer(String(R"({"vertices": [1, "2"]})").to_utf8_buffer(), schema) == ERR_PARSE_ERROR);
+	CHECK(json.get_error_message() == "Expected number");
+	CHECK(json.parse_buffer(String(R"({"name": 1})").to_utf8_buffer(), schema) == ERR_PARSE_ERROR);
+	CHECK(json.get_error_message() == "Expected string");
+	ERR_PRINT_ON
+}
+
 TEST_CASE("[JSON] Parsing escape sequences") {
 	// Only certain escape sequences are valid according to the JSON specification.
 	// Others must result in a parsing error instead.
@@ -317,6 +387,17 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 	}
 }
 
+TEST_CASE("[JSON] Stringify into a StringBuilder") {
+	Dictionary dictionary;
+	dictionary["key"] = Array{ 1, "two", 3.5 };
+
+	StringBuilder builder;
+	builder.append("prefix:");
+	JSON::stringify_to(builder, dictionary, "", true, false);
+	CHECK(builder.as_string() == "prefix:" + JSON::stringify(dictionary));
+	CHECK(builder.as_string() == R"(prefix:{"key":[1,"two",3.5]})");
+}
+
 TEST_CASE("[JSON] Serialization") {
 	JSON json;
 
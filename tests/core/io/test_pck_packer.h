@@ -116,4 +116,63 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			f->get_length() <= 27000,
 			"The generated non-empty PCK file shouldn't be too large.");
 }
+TEST_CASE("[PCKPacker] Pack and read back compressed files") {
+	// Build some redundant files, similar to text resources.
+	Vector<String> source_paths;
+	uint64_t source_size = 0;
+	for (int i = 0; i < 4; i++) {
+		const String source_path = TestUtils::get_temp_path(vformat("compressed_source_%d.tres", i));
+		Ref<FileAccess> f = FileAccess::open(source_path, FileAccess::WRITE);
+		REQUIRE(f.is_valid());
+		f->store_line("[gd_resource type=\"Resource\" format=3]");
+		for (int j = 0; j < 2000 * (i + 1); j++) {
+			f->store_line(vformat("metadata/entry_%d = Vector3(%d, %d, %d)", j, j, i, j * i));
+		}
+		source_size += f->get_length();
+		source_paths.push_back(source_path);
+	}
+
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	REQUIRE(pck_packer.pck_start(output_pck_path) == OK);
+	pck_packer.set_compress_files(true);
+	for (int i = 0; i < source_paths.size(); i++) {
+		CHECK(pck_packer.add_file(vformat("compressed_test/file_%d.tres", i), source_paths[i]) == OK);
+	}
+	CHECK(pck_packer.flush() == OK);
+
+	Ref<FileAccess> pck = FileAccess::open(output_pck_path, FileAccess::READ);
+	REQUIRE(pck.is_valid());
+	CHECK_MESSAGE(
+			pck->get_length() < source_size / 4,
+			"The compressed PCK file should be much smaller than its contents.");
+	pck.unref();
+
+	REQUIRE(PackedData::get_singleton()->add_pack(output_pck_path, true, 0) == OK);
+
+	for (int i = 0; i < source_paths.size(); i++) {
+		const String path = vformat("res://compressed_test/file_%d.tres", i);
+		const Vector<uint8_t> expected = FileAccess::get_file_as_bytes(source_paths[i]);
+		CHECK(PackedData::get_singleton()->get_size(path.trim_prefix("res://")) == expected.size());
+
+		Ref<FileAccess> f = PackedData::get_singleton()->try_open_path(path);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() == (uint64_t)expected.size());
+		CHECK(f->get_buffer(expected.size()) == expected);
+
+		// Random reads, some of them crossing frame boundaries.
+		uint32_t state = 1234 + i;
+		for (int j = 0; j < 64; j++) {
+			state = state * 1103515245 + 12345;
+			const uint64_t from = state % expected.size();
+			const uint64_t length = MIN((uint64_t)(state % 100000) + 1, expected.size() - from);
+			f->seek(from);
+			const Vector<uint8_t> read = f->get_buffer(length);
+			REQUIRE(read.size() == (int64_t)length);
+			CHECK(memcmp(read.ptr(), expected.ptr() + from, length) == 0);
+		}
+
+		PackedData::get_singleton()->remove_path(path);
+	}
+}
 } // namespace TestPCKPacker
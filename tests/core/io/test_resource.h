@@ -30,7 +30,9 @@
 
 #pragma once
 
+#include "core/io/file_access.h"
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/os/os.h"
@@ -628,4 +630,115 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	// Break circular reference to avoid memory leak
 	resource_c->remove_meta("next");
 }
+TEST_CASE("[Resource] Loading binary resources with sub-threads") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Array children;
+	Ref<Resource> previous;
+	for (int i = 0; i < 64; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		child->set_meta("index", i);
+		PackedInt32Array data;
+		data.resize(i + 1);
+		data.fill(i);
+		child->set_meta("data", data);
+		if (previous.is_valid()) {
+			child->set_meta("previous", previous);
+		}
+		children.push_back(child);
+		previous = child;
+	}
+	resource->set_meta("children", children);
+
+	const String save_path = TestUtils::get_temp_path("resource_sub_threads.res");
+	CHECK(ResourceSaver::save(resource, save_path) == OK);
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+
+	Error err = FAILED;
+	Ref<Resource> loaded_serial = loader->load(save_path, save_path, &err, false, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	CHECK(err == OK);
+	err = FAILED;
+	Ref<Resource> loaded_threaded = loader->load(save_path, save_path, &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+	CHECK(err == OK);
+
+	REQUIRE(loaded_serial.is_valid());
+	REQUIRE(loaded_threaded.is_valid());
+	CHECK(loaded_threaded->get_name() == "Root");
+
+	const Array serial_children = loaded_serial->get_meta("children");
+	const Array threaded_children = loaded_threaded->get_meta("children");
+	REQUIRE(serial_children.size() == 64);
+	REQUIRE(threaded_children.size() == 64);
+	for (int i = 0; i < 64; i++) {
+		const Ref<Resource> serial_child = serial_children[i];
+		const Ref<Resource> threaded_child = threaded_children[i];
+		CHECK(threaded_child->get_name() == serial_child->get_name());
+		CHECK(int(threaded_child->get_meta("index")) == i);
+		CHECK(threaded_child->get_meta("data") == serial_child->get_meta("data"));
+		if (i > 0) {
+			CHECK_MESSAGE(
+					threaded_child->get_meta("previous") == threaded_children[i - 1],
+					"References between sub-resources should point to the resources of the same load.");
+		}
+	}
+}
+
+TEST_CASE("[Resource] Binary resources with large property values") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	Array children;
+	for (int i = 0; i < 4; i++) {
+		Ref<Resource> child = memnew(Resource);
+		child->set_name(vformat("Child %d", i));
+		PackedByteArray large;
+		large.resize(100000 + i);
+		for (int j = 0; j < large.size(); j++) {
+			large.write[j] = (j + i) & 0xff;
+		}
+		child->set_meta("small_before", i);
+		child->set_meta("large", large);
+		child->set_meta("small_after", vformat("After %d", i));
+		children.push_back(child);
+	}
+	resource->set_meta("children", children);
+
+	// Without the flag the property table is left out, so older versions can still read the file.
+	const String save_path = TestUtils::get_temp_path("resource_large_properties.res");
+	const String table_save_path = TestUtils::get_temp_path("resource_large_properties_table.res");
+	CHECK(ResourceSaver::save(resource, save_path) == OK);
+	CHECK(ResourceSaver::save(resource, table_save_path, ResourceSaver::FLAG_BINARY_PROPERTY_TABLE) == OK);
+
+	for (const String &path : { save_path, table_save_path }) {
+		Ref<FileAccess> f = FileAccess::open(path, FileAccess::READ);
+		REQUIRE(f.is_valid());
+		f->seek(20); // Magic, endianness, 64-bit flag and engine version come first.
+		CHECK(f->get_32() == (path == save_path ? 6u : 7u));
+	}
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+
+	for (int pass = 0; pass < 4; pass++) {
+		const String &path = pass < 2 ? save_path : table_save_path;
+		const bool threaded = pass % 2;
+		Error err = FAILED;
+		Ref<Resource> loaded = loader->load(path, path, &err, threaded, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+		CHECK(err == OK);
+		REQUIRE(loaded.is_valid());
+
+		const Array loaded_children = loaded->get_meta("children");
+		REQUIRE(loaded_children.size() == 4);
+		for (int i = 0; i < 4; i++) {
+			const Ref<Resource> loaded_child = loaded_children[i];
+			const Ref<Resource> child = children[i];
+			CHECK(loaded_child->get_name() == child->get_name());
+			CHECK(int(loaded_child->get_meta("small_before")) == i);
+			CHECK(loaded_child->get_meta("large") == child->get_meta("large"));
+			CHECK(loaded_child->get_meta("small_after") == child->get_meta("small_after"));
+		}
+	}
+}
 } // namespace TestResource
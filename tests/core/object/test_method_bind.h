@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/object/class_db.h"
+#include "core/variant/variant_internal.h"
 
 #include "tests/test_macros.h"
 
@@ -109,6 +110,19 @@ public:
 		test_valid[TEST_METHOD_OBJECT_CAST] = p_object->value == 1;
 	}
 
+	const String *string_arg = nullptr;
+	String string_arg_value;
+	const PackedByteArray *byte_array_arg = nullptr;
+
+	void test_method_string_ref(const String &p_string) {
+		string_arg = &p_string;
+		string_arg_value = p_string;
+	}
+
+	void test_method_byte_array_ref(const PackedByteArray &p_array) {
+		byte_array_arg = &p_array;
+	}
+
 	static void _bind_methods() {
 		ClassDB::bind_method(D_METHOD("test_method"), &MethodBindTester::test_method);
 		ClassDB::bind_method(D_METHOD("test_method_args"), &MethodBindTester::test_method_args);
@@ -120,6 +134,8 @@ public:
 		ClassDB::bind_method(D_METHOD("test_methodrc_args"), &MethodBindTester::test_methodrc_args);
 		ClassDB::bind_method(D_METHOD("test_method_default_args"), &MethodBindTester::test_method_default_args, DEFVAL(9) /* wrong on purpose */, DEFVAL(4), DEFVAL(5));
 		ClassDB::bind_method(D_METHOD("test_method_object_cast", "object"), &MethodBindTester::test_method_object_cast);
+		ClassDB::bind_method(D_METHOD("test_method_string_ref", "string"), &MethodBindTester::test_method_string_ref);
+		ClassDB::bind_method(D_METHOD("test_method_byte_array_ref", "array"), &MethodBindTester::test_method_byte_array_ref);
 	}
 
 	virtual void run_tests() {
@@ -171,4 +187,32 @@ TEST_CASE("[MethodBind] check all method binds") {
 
 	memdelete(mbt);
 }
+
+TEST_CASE("[MethodBind] Refcounted arguments are passed by reference") {
+	MethodBindTester *mbt = memnew(MethodBindTester);
+	Callable::CallError ce;
+
+	// The method should see the value stored in the Variant, not a copy of it.
+	Variant string = String("Godot");
+	const Variant *string_args[1] = { &string };
+	mbt->callp("test_method_string_ref", string_args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(mbt->string_arg == VariantGetInternalPtr<String>::get_ptr(&string));
+	CHECK(mbt->string_arg_value == "Godot");
+
+	Variant byte_array = PackedByteArray({ 1, 2, 3 });
+	const Variant *byte_array_args[1] = { &byte_array };
+	mbt->callp("test_method_byte_array_ref", byte_array_args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(mbt->byte_array_arg == VariantGetInternalPtr<PackedByteArray>::get_ptr(&byte_array));
+
+	// Other types are still converted.
+	Variant string_name = StringName("Engine");
+	const Variant *string_name_args[1] = { &string_name };
+	mbt->callp("test_method_string_ref", string_name_args, 1, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(mbt->string_arg_value == "Engine");
+
+	memdelete(mbt);
+}
 } // namespace TestMethodBind
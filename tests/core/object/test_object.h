@@ -33,6 +33,7 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/os/thread.h"
 
 #include "tests/test_macros.h"
 
@@ -314,6 +315,25 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class _SignalCounter : public Object {
+public:
+	Object *emitter = nullptr;
+	_SignalCounter *connect_on_emit = nullptr;
+	int count = 0;
+
+	void on_signal() {
+		count++;
+	}
+
+	void on_signal_reconnect() {
+		count++;
+		emitter->disconnect("my_custom_signal", callable_mp(this, &_SignalCounter::on_signal_reconnect));
+		if (connect_on_emit) {
+			emitter->connect("my_custom_signal", callable_mp(connect_on_emit, &_SignalCounter::on_signal));
+		}
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -431,6 +451,38 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Connecting and disconnecting while emitting should only affect later emissions") {
+		_SignalCounter reconnecting;
+		_SignalCounter connected_on_emit;
+		_SignalCounter persistent;
+		_SignalCounter one_shot;
+		reconnecting.emitter = &object;
+		reconnecting.connect_on_emit = &connected_on_emit;
+
+		object.connect("my_custom_signal", callable_mp(&reconnecting, &_SignalCounter::on_signal_reconnect));
+		object.connect("my_custom_signal", callable_mp(&persistent, &_SignalCounter::on_signal));
+		object.connect("my_custom_signal", callable_mp(&one_shot, &_SignalCounter::on_signal), Object::CONNECT_ONE_SHOT);
+
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(reconnecting.count == 1);
+		CHECK(connected_on_emit.count == 0);
+		CHECK(persistent.count == 1);
+		CHECK(one_shot.count == 1);
+
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(reconnecting.count == 1);
+		CHECK(connected_on_emit.count == 1);
+		CHECK(persistent.count == 2);
+		CHECK(one_shot.count == 1);
+
+		object.disconnect("my_custom_signal", callable_mp(&persistent, &_SignalCounter::on_signal));
+		CHECK(object.emit_signal("my_custom_signal") == OK);
+		CHECK(connected_on_emit.count == 2);
+		CHECK(persistent.count == 2);
+
+		object.disconnect("my_custom_signal", callable_mp(&connected_on_emit, &_SignalCounter::on_signal));
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
@@ -594,4 +646,78 @@ TEST_CASE("[Object] Destruction at the end of the call chain is safe") {
 			"Object was tail-deleted without crashes.");
 }
 
+struct ObjectDBLookupData {
+	const LocalVector<Object *> *objects = nullptr;
+	const LocalVector<ObjectID> *ids = nullptr;
+	SafeFlag exit;
+	SafeNumeric<uint32_t> errors;
+};
+
+static void _objectdb_lookup_thread(void *p_userdata) {
+	ObjectDBLookupData *data = (ObjectDBLookupData *)p_userdata;
+	while (!data->exit.is_set()) {
+		for (uint32_t i = 0; i < data->ids->size(); i++) {
+			Object *object = ObjectDB::get_instance((*data->ids)[i]);
+			// Even objects are kept alive, odd ones may be freed at any time, but never resolve to a different object.
+			if (i % 2 == 0 ? object != (*data->objects)[i] : (object != nullptr && object != (*data->objects)[i])) {
+				data->errors.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] ObjectDB lookups while objects are created and freed") {
+	// Enough objects to need several slot chunks.
+	const uint32_t object_count = OBJECTDB_SLOT_CHUNK_SIZE * 3;
+
+	LocalVector<Object *> objects;
+	LocalVector<ObjectID> ids;
+	for (uint32_t i = 0; i < object_count; i++) {
+		objects.push_back(memnew(Object));
+		ids.push_back(objects[i]->get_instance_id());
+	}
+
+	bool all_found = true;
+	for (uint32_t i = 0; i < object_count; i++) {
+		all_found = all_found && ObjectDB::get_instance(ids[i]) == objects[i];
+	}
+	CHECK_MESSAGE(all_found, "All objects should be found by their ID.");
+
+	ObjectDBLookupData data;
+	data.objects = &objects;
+	data.ids = &ids;
+
+	Thread threads[4];
+	for (Thread &thread : threads) {
+		thread.start(_objectdb_lookup_thread, &data);
+	}
+
+	// Free the odd objects, and create new ones that reuse their slots.
+	LocalVector<Object *> new_objects;
+	for (uint32_t i = 1; i < object_count; i += 2) {
+		memdelete(objects[i]);
+		new_objects.push_back(memnew(Object));
+	}
+
+	data.exit.set();
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK_MESSAGE(data.errors.get() == 0, "Lookups from other threads should only return the object with the requested ID, or null if it was freed.");
+
+	bool freed_found = false;
+	for (uint32_t i = 1; i < object_count; i += 2) {
+		freed_found = freed_found || ObjectDB::get_instance(ids[i]) != nullptr;
+	}
+	CHECK_MESSAGE(!freed_found, "Freed objects should not be found by their ID.");
+
+	for (Object *object : new_objects) {
+		memdelete(object);
+	}
+	for (uint32_t i = 0; i < object_count; i += 2) {
+		memdelete(objects[i]);
+	}
+}
+
 } // namespace TestObject
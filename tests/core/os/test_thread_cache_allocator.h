@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*  test_thread_cache_allocator.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/thread.h"
+#include "core/os/thread_cache_allocator.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestThreadCacheAllocator {
+
+TEST_CASE("[ThreadCacheAllocator] Size classes") {
+	CHECK(ThreadCacheAllocator::get_size_class(1) == 0);
+	CHECK(ThreadCacheAllocator::get_size_class(16) == 0);
+	CHECK(ThreadCacheAllocator::get_size_class(17) == 1);
+	CHECK(ThreadCacheAllocator::get_size_class(128) == 7);
+	CHECK(ThreadCacheAllocator::get_size_class(129) == 8);
+	CHECK(ThreadCacheAllocator::get_size_class(ThreadCacheAllocator::MAX_SMALL_SIZE) == ThreadCacheAllocator::SIZE_CLASS_COUNT - 1);
+
+	bool sizes_fit = true;
+	for (size_t size = 1; size <= ThreadCacheAllocator::MAX_SMALL_SIZE; size++) {
+		const uint32_t size_class = ThreadCacheAllocator::get_size_class(size);
+		const size_t class_size = ThreadCacheAllocator::get_size_class_size(size_class);
+		// The class must fit the size, and the previous one must not.
+		sizes_fit = sizes_fit && class_size >= size && (size_class == 0 || ThreadCacheAllocator::get_size_class_size(size_class - 1) < size) && class_size % 16 == 0;
+	}
+	CHECK_MESSAGE(sizes_fit, "Every size should map to the smallest size class that fits it.");
+}
+
+TEST_CASE("[ThreadCacheAllocator] Allocate, reallocate and free") {
+	const size_t sizes[] = { 1, 24, 200, 4000, ThreadCacheAllocator::MAX_SMALL_SIZE, ThreadCacheAllocator::MAX_SMALL_SIZE + 1, 100000 };
+
+	for (size_t size : sizes) {
+		uint8_t *mem = (uint8_t *)ThreadCacheAllocator::alloc(size);
+		REQUIRE(mem != nullptr);
+		CHECK_MESSAGE(uintptr_t(mem) % 16 == 0, "Blocks should be 16-byte aligned.");
+		for (size_t i = 0; i < size; i++) {
+			mem[i] = uint8_t(i * 7);
+		}
+
+		for (size_t new_size : sizes) {
+			uint8_t *new_mem = (uint8_t *)ThreadCacheAllocator::realloc(mem, size, new_size);
+			REQUIRE(new_mem != nullptr);
+			bool preserved = true;
+			for (size_t i = 0; i < MIN(size, new_size); i++) {
+				preserved = preserved && new_mem[i] == uint8_t(i * 7);
+			}
+			CHECK_MESSAGE(preserved, "Reallocation should keep the contents.");
+
+			mem = (uint8_t *)ThreadCacheAllocator::realloc(new_mem, new_size, size);
+			for (size_t i = 0; i < size; i++) {
+				mem[i] = uint8_t(i * 7);
+			}
+		}
+
+		ThreadCacheAllocator::free(mem, size);
+	}
+}
+
+struct CrossThreadData {
+	LocalVector<uint64_t *> blocks;
+};
+
+static void _free_blocks_thread(void *p_userdata) {
+	CrossThreadData *data = (CrossThreadData *)p_userdata;
+	for (uint64_t *block : data->blocks) {
+		ThreadCacheAllocator::free(block, sizeof(uint64_t) * 4);
+	}
+}
+
+TEST_CASE("[ThreadCacheAllocator] Blocks freed by other threads are reused") {
+	// Allocate more blocks than fit in a thread cache, so they go through the shared pool.
+	const uint32_t block_count = 2000;
+
+	CrossThreadData data;
+	for (uint32_t i = 0; i < block_count; i++) {
+		uint64_t *block = (uint64_t *)ThreadCacheAllocator::alloc(sizeof(uint64_t) * 4);
+		block[0] = i;
+		block[3] = i;
+		data.blocks.push_back(block);
+	}
+
+	bool intact = true;
+	for (uint32_t i = 0; i < block_count; i++) {
+		intact = intact && data.blocks[i][0] == i && data.blocks[i][3] == i;
+	}
+	CHECK_MESSAGE(intact, "Blocks should not overlap.");
+
+	Thread thread;
+	thread.start(_free_blocks_thread, &data);
+	thread.wait_to_finish();
+
+	// The exited thread gave its blocks back, they can be used from here again.
+	for (uint32_t i = 0; i < block_count; i++) {
+		data.blocks[i] = (uint64_t *)ThreadCacheAllocator::alloc(sizeof(uint64_t) * 4);
+		data.blocks[i][0] = i;
+	}
+	for (uint64_t *block : data.blocks) {
+		ThreadCacheAllocator::free(block, sizeof(uint64_t) * 4);
+	}
+}
+
+} // namespace TestThreadCacheAllocator
@@ -560,4 +560,174 @@ TEST_CASE("[CommandQueue] Test Parameter Passing Semantics") {
 
 	sts.destroy_threads();
 }
+
+class MultiProducerState {
+public:
+	static const int PRODUCER_COUNT = 8;
+	static const int COMMANDS_PER_PRODUCER = 1000;
+
+	CommandQueueMT command_queue;
+	LocalVector<int> received[PRODUCER_COUNT];
+	LocalVector<int> baton_received;
+	SafeNumeric<int> baton;
+	SafeFlag done;
+
+	void receive(int p_producer, int p_index) {
+		received[p_producer].push_back(p_index);
+	}
+	void receive_baton(int p_value) {
+		baton_received.push_back(p_value);
+	}
+	int twice(int p_value) {
+		return p_value * 2;
+	}
+
+	struct ProducerData {
+		MultiProducerState *state = nullptr;
+		int index = 0;
+		int wrong_returns = 0;
+	};
+
+	static void producer_loop(void *p_userdata) {
+		ProducerData *data = static_cast<ProducerData *>(p_userdata);
+		MultiProducerState *state = data->state;
+		for (int i = 0; i < COMMANDS_PER_PRODUCER; i++) {
+			state->command_queue.push(state, &MultiProducerState::receive, data->index, i);
+			if (i % 100 == 0) {
+				int ret = 0;
+				state->command_queue.push_and_ret(state, &MultiProducerState::twice, &ret, i);
+				if (ret != i * 2) {
+					data->wrong_returns++;
+				}
+			}
+		}
+
+		// Pass a baton around the producers. Each push happens after the previous
+		// one on another thread, so the values must be received in order.
+		for (int i = 0; i < 10; i++) {
+			int value = i * PRODUCER_COUNT + data->index;
+			while (state->baton.get() != value) {
+				Thread::yield();
+			}
+			state->command_queue.push(state, &MultiProducerState::receive_baton, value);
+			state->baton.set(value + 1);
+		}
+	}
+
+	static void consumer_loop(void *p_userdata) {
+		MultiProducerState *state = static_cast<MultiProducerState *>(p_userdata);
+		while (!state->done.is_set()) {
+			state->command_queue.flush_if_pending();
+			Thread::yield();
+		}
+		state->command_queue.flush_all();
+	}
+};
+
+TEST_CASE("[CommandQueue] Multiple producers keep push order") {
+	MultiProducerState state;
+	Thread consumer;
+	consumer.start(&MultiProducerState::consumer_loop, &state);
+
+	Thread producers[MultiProducerState::PRODUCER_COUNT];
+	MultiProducerState::ProducerData producer_data[MultiProducerState::PRODUCER_COUNT];
+	for (int i = 0; i < MultiProducerState::PRODUCER_COUNT; i++) {
+		producer_data[i].state = &state;
+		producer_data[i].index = i;
+		producers[i].start(&MultiProducerState::producer_loop, &producer_data[i]);
+	}
+	for (int i = 0; i < MultiProducerState::PRODUCER_COUNT; i++) {
+		producers[i].wait_to_finish();
+	}
+
+	state.command_queue.sync();
+	state.done.set();
+	consumer.wait_to_finish();
+
+	for (int i = 0; i < MultiProducerState::PRODUCER_COUNT; i++) {
+		CHECK(producer_data[i].wrong_returns == 0);
+		REQUIRE(state.received[i].size() == MultiProducerState::COMMANDS_PER_PRODUCER);
+		bool in_order = true;
+		for (int j = 0; j < MultiProducerState::COMMANDS_PER_PRODUCER; j++) {
+			in_order = in_order && state.received[i][j] == j;
+		}
+		CHECK_MESSAGE(in_order, "Commands from a single producer should run in push order.");
+	}
+
+	REQUIRE(state.baton_received.size() == 10 * MultiProducerState::PRODUCER_COUNT);
+	bool baton_in_order = true;
+	for (uint32_t i = 0; i < state.baton_received.size(); i++) {
+		baton_in_order = baton_in_order && state.baton_received[i] == (int)i;
+	}
+	CHECK_MESSAGE(baton_in_order, "Commands pushed one after another from different producers should run in that order.");
+}
+class IdleProducerState {
+public:
+	CommandQueueMT command_queue;
+	int received = 0; // Only touched by the flushing main thread.
+	SafeFlag pushed_first;
+	SafeFlag push_again;
+	SafeFlag pushed_again;
+
+	void receive() {
+		received++;
+	}
+
+	static void push_once(void *p_userdata) {
+		IdleProducerState *state = static_cast<IdleProducerState *>(p_userdata);
+		state->command_queue.push(state, &IdleProducerState::receive);
+	}
+
+	// Stays alive while its producer is retired, then pushes through its stale cache entry.
+	static void push_twice(void *p_userdata) {
+		IdleProducerState *state = static_cast<IdleProducerState *>(p_userdata);
+		state->command_queue.push(state, &IdleProducerState::receive);
+		state->pushed_first.set();
+		while (!state->push_again.is_set()) {
+			Thread::yield();
+		}
+		state->command_queue.push(state, &IdleProducerState::receive);
+		state->pushed_again.set();
+	}
+};
+
+TEST_CASE("[CommandQueue] Idle producers are retired") {
+	IdleProducerState state;
+
+	Thread long_lived;
+	long_lived.start(&IdleProducerState::push_twice, &state);
+	Thread short_lived[4];
+	for (Thread &thread : short_lived) {
+		thread.start(&IdleProducerState::push_once, &state);
+	}
+	for (Thread &thread : short_lived) {
+		thread.wait_to_finish();
+	}
+	while (!state.pushed_first.is_set()) {
+		Thread::yield();
+	}
+
+	state.command_queue.flush_all();
+	CHECK(state.received == 5);
+	CHECK(state.command_queue.get_producer_count() == 5);
+
+	// Only the main thread keeps pushing.
+	for (uint32_t i = 0; i < CommandQueueMT::PRODUCER_RETIRE_FLUSHES; i++) {
+		state.command_queue.push(&state, &IdleProducerState::receive);
+		state.command_queue.flush_all();
+	}
+	CHECK(state.received == 5 + (int)CommandQueueMT::PRODUCER_RETIRE_FLUSHES);
+	CHECK(state.command_queue.get_producer_count() == 1);
+
+	state.push_again.set();
+	while (!state.pushed_again.is_set()) {
+		Thread::yield();
+	}
+	state.command_queue.flush_all();
+	CHECK(state.received == 6 + (int)CommandQueueMT::PRODUCER_RETIRE_FLUSHES);
+	CHECK(state.command_queue.get_producer_count() == 2);
+
+	long_lived.wait_to_finish();
+}
+
 } // namespace TestCommandQueue
@@ -0,0 +1,174 @@
+/**************************************************************************/
+/*  test_frame_arena.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/frame_arena.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/rb_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Allocations are aligned and rewound by scopes") {
+	FrameArena arena;
+	{
+		FrameArena::Scope scope(arena);
+		uint8_t *a = (uint8_t *)arena.alloc(3);
+		uint8_t *b = (uint8_t *)arena.alloc(5);
+		CHECK(((uintptr_t)a % alignof(max_align_t)) == 0);
+		CHECK(((uintptr_t)b % alignof(max_align_t)) == 0);
+		CHECK(b >= a + 3);
+
+		uint8_t *c = nullptr;
+		{
+			FrameArena::Scope inner_scope(arena);
+			c = (uint8_t *)arena.alloc(16);
+		}
+		// The inner scope released its allocation, so the next one reuses it.
+		CHECK(arena.alloc(16) == c);
+	}
+
+	{
+		FrameArena::Scope scope(arena);
+		// Allocations bigger than a chunk get a chunk of their own.
+		void *big = arena.alloc(256 * 1024);
+		CHECK(big != nullptr);
+		CHECK(arena.get_chunk_count() == 2);
+	}
+
+	const size_t capacity = arena.get_capacity();
+	{
+		FrameArena::Scope scope(arena);
+		arena.alloc(128);
+		arena.alloc(256 * 1024);
+	}
+	CHECK_MESSAGE(arena.get_capacity() == capacity, "Memory from previous scopes should be reused.");
+
+	arena.clear();
+	CHECK(arena.get_chunk_count() == 0);
+	CHECK(arena.get_capacity() == 0);
+}
+
+TEST_CASE("[FrameArena] Realloc grows the last allocation in place") {
+	FrameArena arena;
+	FrameArena::Scope scope(arena);
+
+	int *a = (int *)arena.alloc(4 * sizeof(int));
+	for (int i = 0; i < 4; i++) {
+		a[i] = i;
+	}
+	CHECK(arena.realloc(a, 4 * sizeof(int), 64 * sizeof(int)) == a);
+
+	int *b = (int *)arena.alloc(sizeof(int));
+	int *a2 = (int *)arena.realloc(a, 64 * sizeof(int), 128 * sizeof(int));
+	CHECK_MESSAGE(a2 != a, "Only the last allocation can grow in place.");
+	CHECK(a2 != b);
+	for (int i = 0; i < 4; i++) {
+		CHECK(a2[i] == i);
+	}
+}
+
+TEST_CASE("[FrameArena] Allocations from outer scopes") {
+	FrameArena arena;
+	FrameArena::Scope scope(arena);
+
+	void *outer = arena.alloc(16);
+	CHECK_FALSE(arena.is_from_outer_scope(outer));
+	{
+		FrameArena::Scope inner_scope(arena);
+		void *inner = arena.alloc(16);
+		CHECK(arena.is_from_outer_scope(outer));
+		CHECK_FALSE(arena.is_from_outer_scope(inner));
+
+		// Only growing is a problem, shrinking keeps the allocation where it is.
+		CHECK(arena.realloc(outer, 16, 8) == outer);
+
+		void *big = arena.alloc(256 * 1024);
+		CHECK(arena.is_from_outer_scope(outer));
+		CHECK_FALSE(arena.is_from_outer_scope(big));
+	}
+	CHECK_FALSE(arena.is_from_outer_scope(outer));
+}
+
+TEST_CASE("[FrameArena] Containers") {
+	FrameArena::Scope scope;
+
+	FrameLocalVector<int> vector;
+	for (int i = 0; i < 10000; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == 10000);
+	CHECK(vector[0] == 0);
+	CHECK(vector[9999] == 9999);
+	vector.erase(5);
+	CHECK(vector.size() == 9999);
+	CHECK(vector[5] == 6);
+
+	HashMap<int, String, HashMapHasherDefault, HashMapComparatorDefault<int>, FrameArenaTypedAllocator<HashMapElement<int, String>>> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, itos(i));
+	}
+	CHECK(map.size() == 100);
+	CHECK(map[42] == "42");
+	map.erase(42);
+	CHECK_FALSE(map.has(42));
+
+	RBMap<int, int, Comparator<int>, FrameArenaAllocator> rb_map;
+	rb_map.insert(2, 20);
+	rb_map.insert(1, 10);
+	CHECK(rb_map.front()->key() == 1);
+	CHECK(rb_map[2] == 20);
+}
+
+#ifdef DEBUG_ENABLED
+TEST_CASE("[FrameArena] No heap allocations once the arena is warm") {
+	auto frame = []() {
+		FrameArena::Scope scope;
+		FrameLocalVector<Vector3> points;
+		FrameLocalVector<uint32_t> indices;
+		for (uint32_t i = 0; i < 5000; i++) {
+			points.push_back(Vector3(i, i, i));
+			indices.push_back(i);
+		}
+		return points.size() + indices.size();
+	};
+
+	frame();
+	const uint64_t mem_usage = Memory::get_mem_usage();
+	for (int i = 0; i < 10; i++) {
+		CHECK(frame() == 10000);
+	}
+	CHECK(Memory::get_mem_usage() == mem_usage);
+}
+#endif // DEBUG_ENABLED
+
+} // namespace TestFrameArena
@@ -0,0 +1,204 @@
+/**************************************************************************/
+/*  test_ordered_hash_map.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/templates/ordered_hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestOrderedHashMap {
+
+TEST_CASE("[OrderedHashMap] List initialization") {
+	OrderedHashMap<int, String> map{ { 0, "A" }, { 1, "B" }, { 2, "C" }, { 3, "D" }, { 4, "E" } };
+
+	CHECK(map.size() == 5);
+	CHECK(map[0] == "A");
+	CHECK(map[1] == "B");
+	CHECK(map[2] == "C");
+	CHECK(map[3] == "D");
+	CHECK(map[4] == "E");
+}
+
+TEST_CASE("[OrderedHashMap] Insert and overwrite element") {
+	OrderedHashMap<int, int> map;
+	OrderedHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+
+	map.insert(42, 1234);
+	CHECK(map.size() == 1);
+	CHECK(map[42] == 1234);
+}
+
+TEST_CASE("[OrderedHashMap] Erase") {
+	OrderedHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(43, 85);
+
+	CHECK(map.erase(42));
+	CHECK_FALSE(map.erase(42));
+	CHECK_FALSE(map.has(42));
+	CHECK(map.has(43));
+	CHECK(map.size() == 1);
+	CHECK(map.begin()->key == 43);
+}
+
+TEST_CASE("[OrderedHashMap] Insertion order is kept when erasing and growing") {
+	// Go past SMALL_SIZE so the index table is used.
+	for (int count : { 6, 100, 1000 }) {
+		OrderedHashMap<int, int> map;
+		for (int i = 0; i < count; i++) {
+			map.insert(count - i, i);
+		}
+		for (int i = 0; i < count; i += 2) {
+			CHECK(map.erase(count - i));
+		}
+		for (int i = 0; i < count; i++) {
+			map.insert(-i, i);
+		}
+
+		LocalVector<int> expected;
+		for (int i = 1; i < count; i += 2) {
+			expected.push_back(count - i);
+		}
+		for (int i = 0; i < count; i++) {
+			expected.push_back(-i);
+		}
+
+		CHECK(map.size() == expected.size());
+		uint32_t index = 0;
+		bool order_kept = true;
+		for (const KeyValue<int, int> &E : map) {
+			order_kept = order_kept && index < expected.size() && E.key == expected[index];
+			index++;
+		}
+		CHECK(order_kept);
+		CHECK(map.get_by_index(0).key == expected[0]);
+		CHECK(map.get_by_index(expected.size() - 1).key == expected[expected.size() - 1]);
+
+		for (int i = 0; i < count; i++) {
+			CHECK(map.has(count - i) == (i % 2 == 1));
+			CHECK(map.has(-i));
+		}
+	}
+}
+
+TEST_CASE("[OrderedHashMap] Used as a queue") {
+	OrderedHashMap<int, int> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(i, i);
+	}
+	for (int i = 10; i < 10000; i++) {
+		map.insert(i, i);
+		map.erase(i - 10);
+	}
+
+	CHECK(map.size() == 10);
+	CHECK(map.get_capacity() <= 32);
+	CHECK(map.begin()->key == 9990);
+	CHECK(map.has(9999));
+	CHECK_FALSE(map.has(9989));
+}
+
+TEST_CASE("[OrderedHashMap] Sort") {
+	OrderedHashMap<int, String> map;
+	for (int i = 0; i < 50; i++) {
+		map.insert((i * 37) % 50, itos(i));
+	}
+	map.erase(10);
+	map.sort_custom<KeyValueSort<int, String>>();
+
+	int previous = -1;
+	for (const KeyValue<int, String> &E : map) {
+		CHECK(E.key > previous);
+		previous = E.key;
+	}
+	CHECK(map.size() == 49);
+	CHECK(map.has(20));
+	CHECK_FALSE(map.has(10));
+}
+
+TEST_CASE("[OrderedHashMap] Copy") {
+	OrderedHashMap<int, String> map;
+	for (int i = 0; i < 20; i++) {
+		map.insert(i, itos(i));
+	}
+	map.erase(3);
+
+	OrderedHashMap<int, String> copy = map;
+	CHECK(copy.size() == 19);
+	CHECK_FALSE(copy.has(3));
+	CHECK(copy[19] == "19");
+	CHECK(copy.get_by_index(3).key == 4);
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(copy.size() == 19);
+}
+
+TEST_CASE("[OrderedHashMap] Values keep their address") {
+	OrderedHashMap<int, String> map;
+	String *first = &map[0];
+	*first = "0";
+	const String *kept = map.getptr(0);
+
+	// Grow past the small size and through several pages, erasing and sorting on the way.
+	for (int i = 1; i < 200; i++) {
+		map.insert(i, itos(i));
+		if (i % 3 == 0) {
+			map.erase(i - 1);
+		}
+	}
+	struct ReverseSort {
+		bool operator()(const KeyValue<int, String> &p_a, const KeyValue<int, String> &p_b) const { return p_a.key > p_b.key; }
+	};
+	map.sort_custom<ReverseSort>();
+	for (int i = 200; i < 300; i++) {
+		map[i] = itos(i);
+	}
+
+	CHECK(first == kept);
+	CHECK(map.getptr(0) == first);
+	CHECK(*first == "0");
+	CHECK(map.get_by_index(map.size() - 1).key == 0);
+
+	// Erased slots are reused.
+	String *erased = map.getptr(1);
+	map.erase(1);
+	CHECK(&map[1] == erased);
+}
+
+} // namespace TestOrderedHashMap
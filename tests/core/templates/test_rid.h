@@ -251,6 +251,83 @@ TEST_CASE("[RID_Owner] Thread safety") {
 		tester.test();
 	}
 }
+
+TEST_CASE("[RID_Owner] Concurrent allocation, lookup and free") {
+	struct Tester {
+		RID_Owner<uint64_t, true> rid_owner{ 64 * sizeof(uint64_t) };
+		// Last RID made by each thread, so others can look it up while it may be freed.
+		TightLocalVector<std::atomic<uint64_t>> published;
+		std::atomic<uint32_t> errors = 0;
+	} tester;
+
+	const uint32_t thread_count = CLAMP(OS::get_singleton()->get_processor_count(), 2, 8);
+	tester.published.resize(thread_count);
+	for (std::atomic<uint64_t> &rid : tester.published) {
+		rid.store(0, std::memory_order_relaxed);
+	}
+
+	TightLocalVector<Thread> threads;
+	threads.resize(thread_count);
+	SafeNumeric<uint32_t> next_thread_idx;
+
+	struct ThreadData {
+		Tester *tester = nullptr;
+		SafeNumeric<uint32_t> *next_thread_idx = nullptr;
+	} thread_data{ &tester, &next_thread_idx };
+
+	for (Thread &thread : threads) {
+		thread.start(
+				[](void *p_data) {
+					ThreadData *td = (ThreadData *)p_data;
+					Tester &t = *td->tester;
+					const uint32_t self_idx = td->next_thread_idx->postincrement();
+					const uint32_t count = t.published.size();
+
+					LocalVector<RID> mine;
+					for (uint64_t i = 0; i < 4000; i++) {
+						const uint64_t value = (uint64_t(self_idx) << 32) | i;
+						RID rid = t.rid_owner.make_rid(value);
+						mine.push_back(rid);
+						t.published[self_idx].store(rid.get_id(), std::memory_order_relaxed);
+
+						const uint64_t *data = t.rid_owner.get_or_null(rid);
+						if (!data || *data != value || !t.rid_owner.owns(rid)) {
+							t.errors.fetch_add(1, std::memory_order_relaxed);
+						}
+
+						// Others' RIDs may be freed at any time, so only check the lookups don't misbehave.
+						RID other = RID::from_uint64(t.published[(self_idx + i) % count].load(std::memory_order_relaxed));
+						t.rid_owner.owns(other);
+
+						if (i % 3 == 0) {
+							RID freed = mine[mine.size() / 2];
+							mine.remove_at_unordered(mine.size() / 2);
+							t.rid_owner.free(freed);
+							if (t.rid_owner.owns(freed) || t.rid_owner.get_or_null(freed)) {
+								t.errors.fetch_add(1, std::memory_order_relaxed);
+							}
+						}
+					}
+
+					t.published[self_idx].store(0, std::memory_order_relaxed);
+					for (const RID &rid : mine) {
+						const uint64_t *data = t.rid_owner.get_or_null(rid);
+						if (!data || (*data >> 32) != self_idx) {
+							t.errors.fetch_add(1, std::memory_order_relaxed);
+						}
+						t.rid_owner.free(rid);
+					}
+				},
+				&thread_data);
+	}
+
+	for (Thread &thread : threads) {
+		thread.wait_to_finish();
+	}
+
+	CHECK(tester.errors.load() == 0);
+	CHECK(tester.rid_owner.get_rid_count() == 0);
+}
 #endif // THREADS_ENABLED
 
 } // namespace TestRID
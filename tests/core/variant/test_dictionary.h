@@ -539,6 +539,63 @@ TEST_CASE("[Dictionary] Order and find") {
 	CHECK_EQ(d.find_key("does not exist"), Variant());
 }
 
+TEST_CASE("[Dictionary] Order is kept when erasing and growing") {
+	Dictionary d;
+	for (int i = 0; i < 100; i++) {
+		d[i] = i * 2;
+	}
+	for (int i = 0; i < 100; i += 3) {
+		d.erase(i);
+	}
+	d[-1] = -2;
+
+	int previous = -1;
+	for (const KeyValue<Variant, Variant> &kv : d) {
+		const int key = kv.key;
+		if (key == -1) {
+			CHECK(kv.value == Variant(-2));
+			continue;
+		}
+		CHECK(key % 3 != 0);
+		CHECK(key > previous);
+		CHECK(kv.value == Variant(key * 2));
+		previous = key;
+	}
+	CHECK(d.size() == 67);
+	CHECK(d.get_key_at_index(0) == Variant(1));
+	CHECK(d.get_value_at_index(1) == Variant(4));
+	CHECK(d.get_key_at_index(66) == Variant(-1));
+}
+
+TEST_CASE("[Dictionary] Values keep their address when growing") {
+	// GDExtension bindings hold on to the pointer returned by operator[].
+	Dictionary d;
+	Variant *value = &d["key"];
+	*value = 1;
+	for (int i = 0; i < 100; i++) {
+		d[i] = i;
+	}
+	d.sort();
+
+	CHECK(&d["key"] == value);
+	CHECK(d.getptr("key") == value);
+	CHECK(*value == Variant(1));
+}
+
+TEST_CASE("[Dictionary] String and StringName keys are interchangeable") {
+	Dictionary d;
+	d[StringName("name")] = 1;
+	d["other"] = 2;
+
+	CHECK(d.has("name"));
+	CHECK(d.has(StringName("other")));
+	CHECK(d[StringName("other")] == Variant(2));
+
+	d["name"] = 3;
+	CHECK(d.size() == 2);
+	CHECK(d[StringName("name")] == Variant(3));
+}
+
 TEST_CASE("[Dictionary] Typed copying") {
 	TypedDictionary<int, int> d1;
 	d1[0] = 1;
@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/variant/variant.h"
+#include "core/variant/variant_internal.h"
 #include "core/variant/variant_parser.h"
 
 #include "tests/test_macros.h"
@@ -74,6 +75,62 @@ TEST_CASE("[Variant] Writer and parser integer") {
 	CHECK_MESSAGE(b64_int_parsed == 9223372036854775807, "The result should be clamped to max value.");
 }
 
+TEST_CASE("[Variant] Parser gives the same result with and without read ahead") {
+	// Long enough for tokens to cross the read ahead buffer boundary.
+	String source = "[PackedFloat32Array(";
+	for (int i = 0; i < 3000; i++) {
+		source += vformat(i % 7 == 0 ? "%d.%de-%d,\n" : (i % 5 == 0 ? " -%d.%d, " : "%d.%d,"), i, i % 10, i % 3);
+	}
+	source += "inf, -inf, 1e, 2.5e+, 3E3 ), PackedInt32Array(1,-2 ,\t3, 2147483647), PackedVector3Array(1, 2.5, -3), PackedInt64Array(), identifier_123, Vector2(1, 2), \"text\", 9223372036854775807]";
+
+	Variant with_read_ahead;
+	String with_read_ahead_error;
+	int with_read_ahead_line = 0;
+	VariantParser::StreamString stream_with_read_ahead;
+	stream_with_read_ahead.s = source;
+	VariantParser::Token token;
+	VariantParser::get_token(&stream_with_read_ahead, token, with_read_ahead_line, with_read_ahead_error);
+	CHECK(VariantParser::parse_value(token, with_read_ahead, &stream_with_read_ahead, with_read_ahead_line, with_read_ahead_error) == OK);
+
+	Variant without_read_ahead;
+	String without_read_ahead_error;
+	int without_read_ahead_line = 0;
+	VariantParser::StreamString stream_without_read_ahead(false);
+	stream_without_read_ahead.s = source;
+	VariantParser::get_token(&stream_without_read_ahead, token, without_read_ahead_line, without_read_ahead_error);
+	CHECK(VariantParser::parse_value(token, without_read_ahead, &stream_without_read_ahead, without_read_ahead_line, without_read_ahead_error) == OK);
+
+	CHECK(with_read_ahead == without_read_ahead);
+	CHECK(with_read_ahead_line == without_read_ahead_line);
+	const Array parsed = with_read_ahead;
+	REQUIRE(parsed.size() == 9);
+	CHECK(PackedFloat32Array(parsed[0]).size() == 3005);
+	CHECK(parsed[1] == Variant(PackedInt32Array{ 1, -2, 3, 2147483647 }));
+	CHECK(parsed[4] == "identifier_123");
+
+	// Errors are reported the same way.
+	for (const String &invalid : { String("PackedInt32Array(1, 2, )"), String("PackedFloat32Array(1 2)"), String("PackedFloat32Array(1, ;comment\n 2)") }) {
+		Variant result;
+		String error;
+		int line = 0;
+		VariantParser::StreamString stream;
+		stream.s = invalid;
+		const Error err = VariantParser::parse(&stream, result, error, line);
+
+		Variant slow_result;
+		String slow_error;
+		int slow_line = 0;
+		VariantParser::StreamString slow_stream(false);
+		slow_stream.s = invalid;
+		const Error slow_err = VariantParser::parse(&slow_stream, slow_result, slow_error, slow_line);
+
+		CHECK(err == slow_err);
+		CHECK(error == slow_error);
+		CHECK(line == slow_line);
+		CHECK(result == slow_result);
+	}
+}
+
 TEST_CASE("[Variant] Writer and parser Variant::FLOAT") {
 	// Variant::FLOAT is always 64-bit (C++ double).
 	// This is the maximum non-infinity double-precision float.
@@ -2245,4 +2302,60 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+TEST_CASE("[Variant] Move construction from refcounted types") {
+	String string = "Godot Engine";
+	const char32_t *string_data = string.ptr();
+	Variant string_variant = std::move(string);
+	CHECK(string.is_empty());
+	CHECK(VariantGetInternalPtr<String>::get_ptr(&string_variant)->ptr() == string_data);
+
+	PackedInt32Array array = { 1, 2, 3 };
+	const int32_t *array_data = array.ptr();
+	Variant array_variant = std::move(array);
+	CHECK(array.is_empty());
+	CHECK(VariantGetInternalPtr<PackedInt32Array>::get_ptr(&array_variant)->ptr() == array_data);
+}
+
+TEST_CASE("[Variant] Packed array math") {
+	PackedFloat32Array a = { 1.0, 2.0, 3.0 };
+	PackedFloat32Array b = { 4.0, -5.0, 6.0 };
+	Variant va = a;
+
+	CHECK_EQ(PackedFloat32Array(va.call("add", b)), PackedFloat32Array({ 5.0, -3.0, 9.0 }));
+	CHECK_EQ(PackedFloat32Array(va.call("subtract", b)), PackedFloat32Array({ -3.0, 7.0, -3.0 }));
+	CHECK_EQ(PackedFloat32Array(va.call("multiply", b)), PackedFloat32Array({ 4.0, -10.0, 18.0 }));
+	CHECK_EQ(PackedFloat32Array(va.call("scale", 2.0)), PackedFloat32Array({ 2.0, 4.0, 6.0 }));
+	CHECK_EQ(PackedFloat32Array(va.call("fma", 2.0, b)), PackedFloat32Array({ 6.0, -1.0, 12.0 }));
+	CHECK_EQ(PackedFloat32Array(va.call("lerp", b, 0.5)), PackedFloat32Array({ 2.5, -1.5, 4.5 }));
+	CHECK_EQ(PackedFloat32Array(va.call("clamp", 1.5, 2.5)), PackedFloat32Array({ 1.5, 2.0, 2.5 }));
+	CHECK_EQ(PackedFloat32Array(va.call("min", b)), PackedFloat32Array({ 1.0, -5.0, 3.0 }));
+	CHECK_EQ(PackedFloat32Array(va.call("max", b)), PackedFloat32Array({ 4.0, 2.0, 6.0 }));
+	CHECK_EQ(double(va.call("dot", b)), doctest::Approx(12.0));
+	// The operator still concatenates.
+	CHECK_EQ(PackedFloat32Array(Variant::evaluate(Variant::OP_ADD, va, b)).size(), 6);
+
+	ERR_PRINT_OFF;
+	CHECK(PackedFloat32Array(va.call("add", PackedFloat32Array({ 1.0 }))).is_empty());
+	ERR_PRINT_ON;
+
+	PackedVector3Array v = { Vector3(1, 2, 3), Vector3(-1, 0, 2) };
+	PackedVector3Array w = { Vector3(2, 2, 2), Vector3(1, 1, 1) };
+	Variant vv = v;
+
+	CHECK_EQ(PackedVector3Array(vv.call("add", w)), PackedVector3Array({ Vector3(3, 4, 5), Vector3(0, 1, 3) }));
+	CHECK_EQ(PackedVector3Array(vv.call("multiply", w)), PackedVector3Array({ Vector3(2, 4, 6), Vector3(-1, 0, 2) }));
+	CHECK_EQ(PackedVector3Array(vv.call("fma", 2.0, w)), PackedVector3Array({ Vector3(4, 6, 8), Vector3(-1, 1, 5) }));
+	CHECK_EQ(PackedVector3Array(vv.call("clamp", Vector3(0, 0, 0), Vector3(2, 2, 2))), PackedVector3Array({ Vector3(1, 2, 2), Vector3(0, 0, 2) }));
+	CHECK_EQ(PackedFloat64Array(vv.call("dot", w)), PackedFloat64Array({ 12.0, 1.0 }));
+
+	Basis basis(Vector3(0, 2, 0), Vector3(2, 0, 0), Vector3(0, 0, 2));
+	PackedVector3Array transformed = Variant::evaluate(Variant::OP_MULTIPLY, basis, vv);
+	REQUIRE_EQ(transformed.size(), 2);
+	CHECK_EQ(transformed[0], basis.xform(v[0]));
+	CHECK_EQ(transformed[1], basis.xform(v[1]));
+	PackedVector3Array inverse_transformed = Variant::evaluate(Variant::OP_MULTIPLY, vv, basis);
+	REQUIRE_EQ(inverse_transformed.size(), 2);
+	CHECK_EQ(inverse_transformed[0], basis.xform_inv(v[0]));
+}
+
 } // namespace TestVariant
@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*  test_editor_file_system.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "editor/file_system/editor_file_system.h"
+
+#include "tests/test_macros.h"
+
+namespace TestEditorFileSystem {
+
+static EditorFileSystem::ImportFile make_import_file(const String &p_path, const String &p_importer, int p_order, bool p_threaded, uint64_t p_import_usec = 0) {
+	EditorFileSystem::ImportFile file;
+	file.path = p_path;
+	file.importer = p_importer;
+	file.order = p_order;
+	file.threaded = p_threaded;
+	file.import_usec = p_import_usec;
+	return file;
+}
+
+TEST_CASE("[EditorFileSystem] Import stages") {
+	Vector<EditorFileSystem::ImportFile> files;
+	files.push_back(make_import_file("res://a.png", "texture", 0, true));
+	files.push_back(make_import_file("res://b.wav", "wav", 0, true));
+	files.push_back(make_import_file("res://c.custom", "custom_plugin", 0, false));
+	files.push_back(make_import_file("res://d.glb", "scene", 100, false));
+	files.push_back(make_import_file("res://e.blend", "scene", 100, false));
+	files.push_back(make_import_file("res://f.png", "texture", 200, true));
+	files.push_back(make_import_file("res://g.png", "texture", 300, true));
+	files.push_back(make_import_file("res://group.atlas", "texture_atlas", 300, true));
+	files.sort();
+
+	auto find = [&](const String &p_path) {
+		for (int i = 0; i < files.size(); i++) {
+			if (files[i].path == p_path) {
+				return i;
+			}
+		}
+		return -1;
+	};
+
+	HashSet<String> skip_files;
+	skip_files.insert("res://group.atlas");
+
+	SUBCASE("With threads") {
+		LocalVector<EditorFileSystem::ImportStage> stages;
+		EditorFileSystem::get_import_stages(files, skip_files, true, stages);
+		REQUIRE(stages.size() == 4);
+
+		// Threaded importers share a stage, other importers run on their own after them.
+		CHECK(stages[0].threaded_files.size() == 2);
+		CHECK(stages[0].threaded_files.has(find("res://a.png")));
+		CHECK(stages[0].threaded_files.has(find("res://b.wav")));
+		CHECK(stages[0].main_thread_files.size() == 1);
+		CHECK(stages[0].main_thread_files.has(find("res://c.custom")));
+
+		// Later import orders come in later stages.
+		CHECK(stages[1].threaded_files.is_empty());
+		CHECK(stages[1].main_thread_files.size() == 2);
+		CHECK(stages[1].main_thread_files.has(find("res://d.glb")));
+		CHECK(stages[1].main_thread_files.has(find("res://e.blend")));
+
+		// A single threaded file isn't worth a group task, and skipped files don't count.
+		CHECK(stages[2].threaded_files.is_empty());
+		CHECK(stages[2].main_thread_files.size() == 1);
+		CHECK(stages[2].main_thread_files.has(find("res://f.png")));
+		CHECK(stages[3].threaded_files.is_empty());
+		CHECK(stages[3].main_thread_files.size() == 1);
+		CHECK(stages[3].main_thread_files.has(find("res://g.png")));
+	}
+
+	SUBCASE("Without threads") {
+		LocalVector<EditorFileSystem::ImportStage> stages;
+		EditorFileSystem::get_import_stages(files, skip_files, false, stages);
+		REQUIRE(stages.size() == 4);
+		for (const EditorFileSystem::ImportStage &stage : stages) {
+			CHECK(stage.threaded_files.is_empty());
+		}
+		CHECK(stages[0].main_thread_files.size() == 3);
+		CHECK(stages[1].main_thread_files.size() == 2);
+
+		// Main thread files keep the sorted order.
+		for (const EditorFileSystem::ImportStage &stage : stages) {
+			for (uint32_t i = 1; i < stage.main_thread_files.size(); i++) {
+				CHECK(stage.main_thread_files[i - 1] < stage.main_thread_files[i]);
+			}
+		}
+	}
+}
+
+TEST_CASE("[EditorFileSystem] Import times report") {
+	CHECK(EditorFileSystem::get_import_times_report(Vector<EditorFileSystem::ImportFile>(), 0).is_empty());
+
+	Vector<EditorFileSystem::ImportFile> files;
+	files.push_back(make_import_file("res://a.png", "texture", 0, true, 500000));
+	files.push_back(make_import_file("res://b.png", "texture", 0, true, 250000));
+	files.push_back(make_import_file("res://c.glb", "scene", 100, false, 2000000));
+	files.push_back(make_import_file("res://d.wav", "wav", 0, true, 10000));
+
+	const Vector<String> lines = EditorFileSystem::get_import_times_report(files, 2500000).split("\n");
+	REQUIRE(lines.size() == 4);
+	CHECK(lines[0] == "Imported 4 files in 2.50 s.");
+	// Slowest importer first.
+	CHECK(lines[1] == "  scene: 1 files, 2.00 s.");
+	CHECK(lines[2] == "  texture: 2 files, 0.75 s.");
+	CHECK(lines[3] == "  wav: 1 files, 0.01 s.");
+}
+
+} // namespace TestEditorFileSystem
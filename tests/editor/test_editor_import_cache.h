@@ -0,0 +1,126 @@
+/**************************************************************************/
+/*  test_editor_import_cache.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "editor/file_system/editor_import_cache.h"
+#include "editor/import/resource_importer_image.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestEditorImportCache {
+
+class FormatVersionImporter : public ResourceImporterImage {
+public:
+	int format_version = 0;
+
+	virtual int get_format_version() const override { return format_version; }
+};
+
+static void write_file(const String &p_path, const String &p_contents) {
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE);
+	REQUIRE(f.is_valid());
+	f->store_string(p_contents);
+}
+
+TEST_CASE("[EditorImportCache] Keys, hits and misses") {
+	const String cache_dir = TestUtils::get_temp_path("import_cache");
+	Ref<DirAccess> da = DirAccess::open(cache_dir);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+	}
+
+	EditorImportCache cache;
+	cache.set_cache_dir(cache_dir);
+	REQUIRE(cache.is_enabled());
+
+	const String source = TestUtils::get_temp_path("import_cache_source.png");
+	write_file(source, "Not decoded by the image importer.");
+	const ResourceUID::ID uid = 1234;
+
+	Ref<FormatVersionImporter> importer;
+	importer.instantiate();
+	REQUIRE(importer->can_cache_import(HashMap<StringName, Variant>()));
+
+	List<ResourceImporter::ImportOption> options;
+	options.push_back(ResourceImporter::ImportOption(PropertyInfo(Variant::INT, "quality"), 1));
+	HashMap<StringName, Variant> params;
+	params["quality"] = 1;
+
+	const String key = cache.get_key(source, uid, importer, options, params);
+	REQUIRE_FALSE(key.is_empty());
+	CHECK(cache.get_key(source, uid, importer, options, params) == key);
+
+	SUBCASE("Changing an option, the format version or the source changes the key") {
+		params["quality"] = 2;
+		CHECK(cache.get_key(source, uid, importer, options, params) != key);
+		params["quality"] = 1;
+
+		importer->format_version = 1;
+		CHECK(cache.get_key(source, uid, importer, options, params) != key);
+		importer->format_version = 0;
+
+		CHECK(cache.get_key(source, uid + 1, importer, options, params) != key);
+
+		write_file(source, "Different contents.");
+		CHECK(cache.get_key(source, uid, importer, options, params) != key);
+	}
+
+	SUBCASE("A restored entry matches a fresh import") {
+		const String fresh_base = TestUtils::get_temp_path("import_cache_fresh");
+		const String restored_base = TestUtils::get_temp_path("import_cache_restored");
+		DirAccess::remove_absolute(restored_base + ".image");
+
+		List<String> variants;
+		Variant meta;
+		CHECK_FALSE(cache.restore(key, restored_base, &variants, &meta));
+		CHECK(cache.get_misses() == 1);
+
+		// Left over from an earlier import, must not end up in the cache entry.
+		write_file(fresh_base + ".stale", "Stale");
+		REQUIRE(importer->import(uid, source, fresh_base, params, &variants, nullptr, &meta) == OK);
+		cache.store(key, fresh_base, importer->get_save_extension(), variants, meta, 1000);
+
+		CHECK(cache.restore(key, restored_base, &variants, &meta));
+		CHECK(cache.get_hits() == 1);
+		CHECK(FileAccess::get_file_as_bytes(restored_base + ".image") == FileAccess::get_file_as_bytes(fresh_base + ".image"));
+		CHECK_FALSE(FileAccess::exists(restored_base + ".stale"));
+
+		// A different key still misses.
+		params["quality"] = 2;
+		CHECK_FALSE(cache.restore(cache.get_key(source, uid, importer, options, params), restored_base, &variants, &meta));
+		CHECK(cache.get_misses() == 2);
+	}
+}
+
+} // namespace TestEditorImportCache
@@ -0,0 +1,142 @@
+/**************************************************************************/
+/*  test_compressed_texture.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "core/object/message_queue.h"
+#include "core/os/os.h"
+#include "scene/resources/compressed_texture.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestCompressedTexture {
+
+static String save_uncompressed_ctex(const Ref<Image> &p_image, const String &p_name) {
+	const String path = TestUtils::get_temp_path(p_name);
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+	f->store_8('G');
+	f->store_8('S');
+	f->store_8('T');
+	f->store_8('2');
+	f->store_32(CompressedTexture2D::FORMAT_VERSION);
+	f->store_32(p_image->get_width());
+	f->store_32(p_image->get_height());
+	f->store_32(p_image->has_mipmaps() ? CompressedTexture2D::FORMAT_BIT_HAS_MIPMAPS : 0);
+	for (int i = 0; i < 4; i++) {
+		f->store_32(0); // Mipmap limit and reserved.
+	}
+
+	f->store_32(CompressedTexture2D::DATA_FORMAT_IMAGE);
+	f->store_16(p_image->get_width());
+	f->store_16(p_image->get_height());
+	f->store_32(p_image->get_mipmap_count());
+	f->store_32(p_image->get_format());
+	f->store_buffer(p_image->get_data());
+	return path;
+}
+
+static void wait_for_mip_level(const Ref<CompressedTexture2D> &p_texture, int p_mip_level) {
+	for (int i = 0; i < 1000 && p_texture->get_resident_mip_level() != p_mip_level; i++) {
+		OS::get_singleton()->delay_usec(1000);
+		MessageQueue::get_singleton()->flush();
+	}
+}
+
+TEST_CASE("[SceneTree][CompressedTexture2D] Mipmap streaming") {
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", true);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/mip_tail_size", 64);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/memory_budget_mb", 2);
+
+	// 512×512 RGBA8 with mipmaps takes about 1.3 MiB, so only one of them fits in the budget.
+	Ref<Image> image = Image::create_empty(512, 512, true, Image::FORMAT_RGBA8);
+	image->fill(Color(1, 0, 0));
+	const String path_a = save_uncompressed_ctex(image, "streaming_a.ctex");
+	const String path_b = save_uncompressed_ctex(image, "streaming_b.ctex");
+
+	const CompressedTexture2D::StreamingStats stats_before = CompressedTexture2D::get_streaming_stats();
+
+	Ref<CompressedTexture2D> texture_a;
+	texture_a.instantiate();
+	REQUIRE(texture_a->load(path_a) == OK);
+	Ref<CompressedTexture2D> texture_b;
+	texture_b.instantiate();
+	REQUIRE(texture_b->load(path_b) == OK);
+
+	SUBCASE("Only the mip tail is loaded up front") {
+		CHECK(texture_a->is_streaming());
+		CHECK(texture_a->get_resident_mip_level() == 3);
+		CHECK(texture_a->get_width() == 512);
+		CHECK(texture_a->get_height() == 512);
+		CHECK(texture_a->get_image()->get_width() == 64);
+		CHECK(texture_a->get_image()->has_mipmaps());
+		CHECK(CompressedTexture2D::get_streaming_stats().streaming_textures == stats_before.streaming_textures + 2);
+	}
+
+	SUBCASE("Mipmaps are streamed in on request and evicted over budget") {
+		texture_a->request_mip_level(0);
+		wait_for_mip_level(texture_a, 0);
+		CHECK(texture_a->get_resident_mip_level() == 0);
+		CHECK(texture_a->get_image()->get_width() == 512);
+		CHECK(texture_a->get_image()->get_pixel(256, 256).is_equal_approx(Color(1, 0, 0)));
+
+		CompressedTexture2D::StreamingStats stats = CompressedTexture2D::get_streaming_stats();
+		CHECK(stats.streamed_in == stats_before.streamed_in + 1);
+		CHECK(stats.streamed_memory > stats_before.streamed_memory);
+		CHECK(stats.pending_requests == 0);
+
+		texture_b->request_mip_level(1);
+		wait_for_mip_level(texture_b, 1);
+		CHECK(texture_b->get_resident_mip_level() == 1);
+		CHECK(texture_b->get_image()->get_width() == 256);
+
+		// Both don't fit, the least recently requested texture falls back to its mip tail.
+		texture_b->request_mip_level(0);
+		wait_for_mip_level(texture_b, 0);
+		CHECK(texture_b->get_resident_mip_level() == 0);
+		CHECK(texture_a->get_resident_mip_level() == 3);
+		CHECK(texture_a->get_image()->get_width() == 64);
+
+		stats = CompressedTexture2D::get_streaming_stats();
+		CHECK(stats.evicted == stats_before.evicted + 1);
+		CHECK(stats.streamed_memory <= stats.memory_budget);
+	}
+
+	texture_a.unref();
+	texture_b.unref();
+	CHECK(CompressedTexture2D::get_streaming_stats().streamed_memory == stats_before.streamed_memory);
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", false);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/mip_tail_size", 128);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/memory_budget_mb", 512);
+}
+
+} // namespace TestCompressedTexture
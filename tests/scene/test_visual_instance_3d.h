@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  test_visual_instance_3d.h                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "scene/3d/visual_instance_3d.h"
+#include "scene/main/window.h"
+#include "servers/rendering/renderer_scene_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+#include "tests/test_tools.h"
+
+namespace TestVisualInstance3D {
+
+static Transform3D get_instance_transform(RID p_instance) {
+	RendererSceneCull *scene_cull = static_cast<RendererSceneCull *>(RenderingServerGlobals::scene);
+	return scene_cull->instance_owner.get_or_null(p_instance)->transform;
+}
+
+// Frees its target while transform notifications are being flushed, right after queuing the target's transform.
+class InstanceFreeingNode : public Node3D {
+	GDCLASS(InstanceFreeingNode, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED && target) {
+			target->notification(NOTIFICATION_TRANSFORM_CHANGED);
+			memdelete(target);
+			target = nullptr;
+		}
+	}
+
+public:
+	VisualInstance3D *target = nullptr;
+
+	InstanceFreeingNode() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][VisualInstance3D] Transforms are sent when flushing") {
+	Window *root = SceneTree::get_singleton()->get_root();
+	VisualInstance3D *first = memnew(VisualInstance3D);
+	VisualInstance3D *second = memnew(VisualInstance3D);
+	root->add_child(first);
+	root->add_child(second);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	first->set_position(Vector3(1, 2, 3));
+	second->set_position(Vector3(-4, 5, 6));
+	CHECK(get_instance_transform(first->get_instance()).origin == Vector3());
+
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK(get_instance_transform(first->get_instance()).origin == Vector3(1, 2, 3));
+	CHECK(get_instance_transform(second->get_instance()).origin == Vector3(-4, 5, 6));
+
+	memdelete(first);
+	memdelete(second);
+}
+
+TEST_CASE("[SceneTree][VisualInstance3D] Invalid instances in a transform batch are skipped") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	const RID first = rs->instance_create();
+	const RID freed = rs->instance_create();
+	const RID last = rs->instance_create();
+	rs->free(freed);
+
+	const Vector<RID> instances = { first, freed, last };
+	const Vector<Transform3D> transforms = {
+		Transform3D(Basis(), Vector3(1, 0, 0)),
+		Transform3D(Basis(), Vector3(2, 0, 0)),
+		Transform3D(Basis(), Vector3(3, 0, 0)),
+	};
+
+	ErrorDetector ed;
+	ERR_PRINT_OFF;
+	rs->instance_set_transforms(instances, transforms);
+	ERR_PRINT_ON;
+	CHECK(ed.has_error);
+	CHECK(get_instance_transform(first).origin == Vector3(1, 0, 0));
+	CHECK(get_instance_transform(last).origin == Vector3(3, 0, 0));
+
+	rs->free(first);
+	rs->free(last);
+}
+
+TEST_CASE("[SceneTree][VisualInstance3D] Node freed while its transform is queued") {
+	Window *root = SceneTree::get_singleton()->get_root();
+	InstanceFreeingNode *freeing = memnew(InstanceFreeingNode);
+	VisualInstance3D *freed = memnew(VisualInstance3D);
+	VisualInstance3D *kept = memnew(VisualInstance3D);
+	freeing->target = freed;
+	root->add_child(freeing);
+	root->add_child(freed);
+	root->add_child(kept);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	// Changed transforms are notified in reverse order, so `freeing` goes first and `kept` right after it.
+	freed->set_position(Vector3(1, 0, 0));
+	kept->set_position(Vector3(2, 0, 0));
+	freeing->set_position(Vector3(3, 0, 0));
+
+	ErrorDetector ed;
+	SceneTree::get_singleton()->flush_transform_notifications();
+	CHECK_FALSE(ed.has_error);
+	CHECK(freeing->target == nullptr);
+	CHECK(get_instance_transform(kept->get_instance()).origin == Vector3(2, 0, 0));
+
+	memdelete(freeing);
+	memdelete(kept);
+}
+
+} // namespace TestVisualInstance3D
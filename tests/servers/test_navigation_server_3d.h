@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/math/random_pcg.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/resources/3d/primitive_meshes.h"
 #include "servers/navigation_server_3d.h"
@@ -41,11 +42,16 @@ class CallableMock : public Object {
 	GDCLASS(CallableMock, Object);
 
 public:
+	void function0() {
+		function0_calls++;
+	}
+
 	void function1(Variant arg0) {
 		function1_calls++;
 		function1_latest_arg0 = arg0;
 	}
 
+	unsigned function0_calls{ 0 };
 	unsigned function1_calls{ 0 };
 	Variant function1_latest_arg0;
 };
@@ -824,6 +830,294 @@ TEST_SUITE("[Navigation3D]") {
 	}
 	*/
 
+	TEST_CASE("[NavigationServer3D] Server should find the same paths with hierarchical pathfinding as with the flat search") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(60.0, 0.001, 60.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+
+		// Pillars split the navigation mesh into enough polygons to span many clusters.
+		Array pillar_arr;
+		pillar_arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(pillar_arr, Vector3(2.0, 4.0, 2.0));
+		for (int x = -2; x <= 2; x++) {
+			for (int z = -2; z <= 2; z++) {
+				source_geometry->add_mesh_array(pillar_arr, Transform3D(Basis(), Vector3(x * 10.0 + 3.0, 2.0, z * 10.0 - 3.0)));
+			}
+		}
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID flat_map = navigation_server->map_create();
+		RID flat_region = navigation_server->region_create();
+		navigation_server->map_set_active(flat_map, true);
+		navigation_server->map_set_use_async_iterations(flat_map, false);
+		navigation_server->region_set_use_async_iterations(flat_region, false);
+		navigation_server->region_set_map(flat_region, flat_map);
+		navigation_server->region_set_navigation_mesh(flat_region, navigation_mesh);
+
+		RID hierarchical_map = navigation_server->map_create();
+		RID hierarchical_region = navigation_server->region_create();
+		navigation_server->map_set_active(hierarchical_map, true);
+		navigation_server->map_set_use_async_iterations(hierarchical_map, false);
+		navigation_server->map_set_use_hierarchical_pathfinding(hierarchical_map, true);
+		navigation_server->map_set_hierarchical_cluster_size(hierarchical_map, 8.0);
+		navigation_server->region_set_use_async_iterations(hierarchical_region, false);
+		navigation_server->region_set_map(hierarchical_region, hierarchical_map);
+		navigation_server->region_set_navigation_mesh(hierarchical_region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		CHECK_FALSE(navigation_server->map_get_use_hierarchical_pathfinding(flat_map));
+		CHECK(navigation_server->map_get_use_hierarchical_pathfinding(hierarchical_map));
+		CHECK_EQ(navigation_server->map_get_hierarchical_cluster_size(hierarchical_map), doctest::Approx(8.0));
+
+		SUBCASE("Long queries should reach the same positions with a comparable path length") {
+			RandomPCG rng(20231);
+			for (int i = 0; i < 64; i++) {
+				const Vector3 start_position(rng.random(-28.0f, 28.0f), 0.0, rng.random(-28.0f, 28.0f));
+				const Vector3 target_position(rng.random(-28.0f, 28.0f), 0.0, rng.random(-28.0f, 28.0f));
+
+				Vector<Vector3> flat_path = navigation_server->map_get_path(flat_map, start_position, target_position, true);
+				Vector<Vector3> hierarchical_path = navigation_server->map_get_path(hierarchical_map, start_position, target_position, true);
+				REQUIRE_FALSE(flat_path.is_empty());
+				REQUIRE_FALSE(hierarchical_path.is_empty());
+
+				CHECK(hierarchical_path[0].is_equal_approx(flat_path[0]));
+				CHECK(hierarchical_path[hierarchical_path.size() - 1].is_equal_approx(flat_path[flat_path.size() - 1]));
+
+				real_t flat_length = 0.0;
+				for (int j = 1; j < flat_path.size(); j++) {
+					flat_length += flat_path[j - 1].distance_to(flat_path[j]);
+				}
+				real_t hierarchical_length = 0.0;
+				for (int j = 1; j < hierarchical_path.size(); j++) {
+					hierarchical_length += hierarchical_path[j - 1].distance_to(hierarchical_path[j]);
+				}
+				CHECK_LE(hierarchical_length, flat_length * 1.2 + 0.01);
+			}
+		}
+
+		SUBCASE("Queries with non-matching navigation layer mask should yield empty result") {
+			CHECK(navigation_server->map_get_path(hierarchical_map, Vector3(-25, 0, -25), Vector3(25, 0, 25), true, 2).is_empty());
+		}
+
+		SUBCASE("Queries to an unreachable target should fall back to the flat search") {
+			RID flat_island = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(flat_island, false);
+			navigation_server->region_set_transform(flat_island, Transform3D(Basis(), Vector3(100, 0, 0)));
+			navigation_server->region_set_map(flat_island, flat_map);
+			navigation_server->region_set_navigation_mesh(flat_island, navigation_mesh);
+
+			RID hierarchical_island = navigation_server->region_create();
+			navigation_server->region_set_use_async_iterations(hierarchical_island, false);
+			navigation_server->region_set_transform(hierarchical_island, Transform3D(Basis(), Vector3(100, 0, 0)));
+			navigation_server->region_set_map(hierarchical_island, hierarchical_map);
+			navigation_server->region_set_navigation_mesh(hierarchical_island, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			Vector<Vector3> flat_path = navigation_server->map_get_path(flat_map, Vector3(-25, 0, -25), Vector3(120, 0, 20), true);
+			Vector<Vector3> hierarchical_path = navigation_server->map_get_path(hierarchical_map, Vector3(-25, 0, -25), Vector3(120, 0, 20), true);
+			CHECK_FALSE(flat_path.is_empty());
+			CHECK_EQ(hierarchical_path, flat_path);
+
+			navigation_server->free(hierarchical_island);
+			navigation_server->free(flat_island);
+		}
+
+		navigation_server->free(hierarchical_region);
+		navigation_server->free(hierarchical_map);
+		navigation_server->free(flat_region);
+		navigation_server->free(flat_map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should rebake only the changed navigation mesh tiles") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(8.0);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(60.0, 0.001, 60.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		REQUIRE_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		// The path crosses many tile seams, so it only reaches the target if the tiles are stitched together.
+		Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-25, 0, -25), Vector3(25, 0, 25), true);
+		REQUIRE_FALSE(path.is_empty());
+		CHECK_LT(path[path.size() - 1].distance_to(Vector3(25, 0, 25)), 0.5);
+
+		const auto get_far_polygons = [](const Ref<NavigationMesh> &p_navigation_mesh) {
+			Vector<Vector3> vertices = p_navigation_mesh->get_vertices();
+			LocalVector<Vector<Vector3>> polygons;
+			for (int i = 0; i < p_navigation_mesh->get_polygon_count(); i++) {
+				Vector<Vector3> polygon;
+				Vector3 centroid;
+				for (int index : p_navigation_mesh->get_polygon(i)) {
+					polygon.push_back(vertices[index]);
+					centroid += vertices[index];
+				}
+				if (centroid.x / polygon.size() < -10.0) {
+					polygons.push_back(polygon);
+				}
+			}
+			return polygons;
+		};
+		const auto get_surface_area = [](const Ref<NavigationMesh> &p_navigation_mesh) {
+			Vector<Vector3> vertices = p_navigation_mesh->get_vertices();
+			real_t surface_area = 0.0;
+			for (int i = 0; i < p_navigation_mesh->get_polygon_count(); i++) {
+				Vector<int> polygon = p_navigation_mesh->get_polygon(i);
+				for (int j = 2; j < polygon.size(); j++) {
+					surface_area += (vertices[polygon[j - 1]] - vertices[polygon[0]]).cross(vertices[polygon[j]] - vertices[polygon[0]]).length() * 0.5;
+				}
+			}
+			return surface_area;
+		};
+		LocalVector<Vector<Vector3>> far_polygons = get_far_polygons(navigation_mesh);
+		REQUIRE_FALSE(far_polygons.is_empty());
+
+		Array pillar_arr;
+		pillar_arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(pillar_arr, Vector3(2.0, 4.0, 2.0));
+		source_geometry->add_mesh_array(pillar_arr, Transform3D(Basis(), Vector3(20.0, 2.0, 20.0)));
+		navigation_server->bake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, AABB(Vector3(19.0, 0.0, 19.0), Vector3(2.0, 4.0, 2.0)), Callable());
+		REQUIRE_NE(navigation_mesh->get_polygon_count(), 0);
+
+		SUBCASE("Tiles away from the change should keep their polygons") {
+			LocalVector<Vector<Vector3>> rebaked_far_polygons = get_far_polygons(navigation_mesh);
+			REQUIRE_EQ(rebaked_far_polygons.size(), far_polygons.size());
+			for (uint32_t i = 0; i < far_polygons.size(); i++) {
+				CHECK_EQ(rebaked_far_polygons[i], far_polygons[i]);
+			}
+		}
+
+		SUBCASE("Rebaked tiles should match a full bake and stay connected to the kept tiles") {
+			Ref<NavigationMesh> full_navigation_mesh = memnew(NavigationMesh);
+			full_navigation_mesh->set_tile_size(8.0);
+			navigation_server->bake_from_source_geometry_data(full_navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(get_surface_area(navigation_mesh), doctest::Approx(get_surface_area(full_navigation_mesh)).epsilon(0.01));
+
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			path = navigation_server->map_get_path(map, Vector3(-25, 0, -25), Vector3(25, 0, 25), true);
+			REQUIRE_FALSE(path.is_empty());
+			CHECK_LT(path[path.size() - 1].distance_to(Vector3(25, 0, 25)), 0.5);
+
+			// The path has to go around the pillar.
+			path = navigation_server->map_get_path(map, Vector3(15, 0, 20), Vector3(25, 0, 20), true);
+			REQUIRE_FALSE(path.is_empty());
+			CHECK_LT(path[path.size() - 1].distance_to(Vector3(25, 0, 20)), 0.5);
+			real_t path_length = 0.0;
+			for (int i = 1; i < path.size(); i++) {
+				path_length += path[i - 1].distance_to(path[i]);
+			}
+			CHECK_GT(path_length, 10.1);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
+	TEST_CASE("[NavigationServer3D] Server should process queued path queries within the map budget") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(20.0, 0.001, 20.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->map_set_path_query_queue_budget(map, 2);
+		navigation_server->region_set_use_async_iterations(region, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		CHECK_EQ(navigation_server->map_get_path_query_queue_budget(map), 2);
+
+		// The first two queries are identical and share a single path search.
+		const Vector3 targets[5] = { Vector3(8, 0, 8), Vector3(8, 0, 8), Vector3(-8, 0, 8), Vector3(8, 0, -8), Vector3(-8, 0, -8) };
+
+		LocalVector<Ref<NavigationPathQueryParameters3D>> query_parameters;
+		LocalVector<Ref<NavigationPathQueryResult3D>> query_results;
+		CallableMock callback_mock;
+
+		for (uint32_t i = 0; i < 5; i++) {
+			Ref<NavigationPathQueryParameters3D> parameters;
+			parameters.instantiate();
+			parameters->set_map(map);
+			parameters->set_start_position(Vector3(-8, 0, -6));
+			parameters->set_target_position(targets[i]);
+			query_parameters.push_back(parameters);
+
+			Ref<NavigationPathQueryResult3D> result;
+			result.instantiate();
+			query_results.push_back(result);
+
+			navigation_server->query_path_async(parameters, result, callable_mp(&callback_mock, &CallableMock::function0));
+		}
+		CHECK_EQ(callback_mock.function0_calls, 0);
+		CHECK_EQ(query_results[0]->get_path().size(), 0);
+
+		navigation_server->physics_process(0.0);
+		CHECK_EQ(callback_mock.function0_calls, 2);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_QUEUE_SIZE), 3);
+		CHECK_NE(query_results[0]->get_path().size(), 0);
+		CHECK_EQ(query_results[0]->get_path(), query_results[1]->get_path());
+		CHECK_EQ(query_results[2]->get_path().size(), 0);
+
+		navigation_server->physics_process(0.0);
+		CHECK_EQ(callback_mock.function0_calls, 4);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_QUEUE_SIZE), 1);
+
+		navigation_server->physics_process(0.0);
+		CHECK_EQ(callback_mock.function0_calls, 5);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_QUEUE_SIZE), 0);
+		CHECK_GE(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_LATENCY), 0);
+
+		// Queued queries should find the same paths as immediate queries.
+		for (uint32_t i = 0; i < 5; i++) {
+			Ref<NavigationPathQueryResult3D> result;
+			result.instantiate();
+			navigation_server->query_path(query_parameters[i], result);
+			CHECK_EQ(query_results[i]->get_path(), result->get_path());
+			CHECK_EQ(query_results[i]->get_path_rids(), result->get_path_rids());
+			CHECK_EQ(query_results[i]->get_path_length(), doctest::Approx(result->get_path_length()));
+		}
+
+		navigation_server->physics_process(0.0);
+		CHECK_EQ(callback_mock.function0_calls, 5);
+		CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_QUERY_LATENCY), 0);
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	TEST_CASE("[NavigationServer3D] Server should simplify path properly") {
 		real_t simplify_epsilon = 0.2;
 		Vector<Vector3> source_path;
@@ -90,6 +90,7 @@
 #include "tests/core/object/test_object.h"
 #include "tests/core/object/test_undo_redo.h"
 #include "tests/core/os/test_os.h"
+#include "tests/core/os/test_thread_cache_allocator.h"
 #include "tests/core/string/test_fuzzy_search.h"
 #include "tests/core/string/test_node_path.h"
 #include "tests/core/string/test_string.h"
@@ -98,11 +99,13 @@
 #include "tests/core/templates/test_a_hash_map.h"
 #include "tests/core/templates/test_command_queue.h"
 #include "tests/core/templates/test_fixed_vector.h"
+#include "tests/core/templates/test_frame_arena.h"
 #include "tests/core/templates/test_hash_map.h"
 #include "tests/core/templates/test_hash_set.h"
 #include "tests/core/templates/test_list.h"
 #include "tests/core/templates/test_local_vector.h"
 #include "tests/core/templates/test_lru.h"
+#include "tests/core/templates/test_ordered_hash_map.h"
 #include "tests/core/templates/test_paged_array.h"
 #include "tests/core/templates/test_rid.h"
 #include "tests/core/templates/test_self_list.h"
@@ -124,6 +127,7 @@
 #include "tests/scene/test_bit_map.h"
 #include "tests/scene/test_button.h"
 #include "tests/scene/test_camera_2d.h"
+#include "tests/scene/test_compressed_texture.h"
 #include "tests/scene/test_control.h"
 #include "tests/scene/test_curve.h"
 #include "tests/scene/test_curve_2d.h"
@@ -154,6 +158,11 @@
 #include "tests/servers/test_text_server.h"
 #include "tests/test_validate_testing.h"
 
+#ifdef TOOLS_ENABLED
+#include "tests/editor/test_editor_file_system.h"
+#include "tests/editor/test_editor_import_cache.h"
+#endif // TOOLS_ENABLED
+
 #ifndef ADVANCED_GUI_DISABLED
 #include "tests/scene/test_code_edit.h"
 #include "tests/scene/test_color_picker.h"
@@ -178,6 +187,7 @@
 #include "tests/scene/test_primitives.h"
 #include "tests/scene/test_skeleton_3d.h"
 #include "tests/scene/test_sky.h"
+#include "tests/scene/test_visual_instance_3d.h"
 #endif // _3D_DISABLED
 
 #ifndef PHYSICS_3D_DISABLED